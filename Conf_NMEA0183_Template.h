@@ -41,6 +41,86 @@
 
 //-----------------------------------------------------------------------------
 
+//! Uncomment the following line to change the count of field delimiter positions recorded while receiving a frame (default 24, enough for all the sentences decoded by this library)
+//#define NMEA0183_FIELD_INDEX_SIZE  24 // Each position uses 1 byte in the NMEA0183_DecodeInput structure
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line to change the size of the frame buffer of the decoders, for longer proprietary or NMEA 4.x sentences (default 82+1, up to 255)
+//#define NMEA0183_FRAME_BUFFER_SIZE  ( 160+1 ) // Each decoder, previous frame and cached frame uses this size, the decoded data of an unknown sentence keeps its first 82 chars
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line to disable the SSE2/AVX2 checksum computation (automatically used when the compiler targets these instruction sets)
+//#define NMEA0183_NO_SIMD
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want to register decoders for sentences unknown by this library with NMEA0183_RegisterSentenceDecoder()
+//#define NMEA0183_USER_SENTENCE_DECODERS_COUNT  4 // This will add room for 4 registered sentence decoders
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want to select at runtime the sentences decoded by each decoder with NMEA0183_SetSentenceSubscription()
+//#define NMEA0183_SENTENCE_SUBSCRIPTION
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want to dispatch each sentence to its own handler (NMEA0183_DispatchFrame(), NMEA0183handlerDecoder class in C++)
+//#define NMEA0183_SENTENCE_HANDLERS
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want differential decoding: each decoder keeps the last frame of some sentences, an identical frame is not parsed again, only the changed fields of a frame are parsed again and they are reported
+//#define NMEA0183_DIFFERENTIAL_DECODING  4 // This will keep the last frame and decoded data of 4 sentences in each NMEA0183_DecodeInput and NMEA0183_FrameQueue
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the fields present in each sentence in the PresentFields bitmask of the decoded data (see NMEA0183_IS_FIELD_PRESENT())
+//#define NMEA0183_PRESENT_FIELDS // The bit of each field is set while it is parsed
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the time, date, coordinate and magnetic structures naturally aligned instead of packed (faster access and copies, but bigger structures)
+//#define NMEA0183_NATURAL_ALIGNMENT
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the waypoint IDs and the TXT message as views in the parsed frame instead of copies (see NMEA0183_StringViewToString())
+//#define NMEA0183_STRING_VIEWS // The frame shall stay available while the views are used
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want a cache of the last decoded frames, a frame identical to a frame in the cache is not parsed again. Set the count of frames kept by each decoder (one cache per NMEA0183_DecodeInput or NMEA0183_FrameQueue)
+//#define NMEA0183_FRAME_CACHE_SIZE  4 // Each frame kept uses about the size of NMEA0183_DecodedData plus a frame buffer
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the field and the offset where a sentence parser stopped with a parse error (see NMEA0183_PARSE_ERROR_OFFSET_Get())
+//#define NMEA0183_PARSE_ERROR_DIAGNOSTICS // The offset is in the context bits of the error returned by the sentence parsers, this is not costing anything while parsing a valid sentence
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want to decode lines in compact records (see NMEA0183_ProcessLineCompact())
+//#define NMEA0183_COMPACT_OUTPUT // Each record is a small header followed by the data of its sentence only, for batches of decoded lines packed in a buffer
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the receive timestamps of each frame read from a clock hook (see NMEA0183_SetReceiveClock()). Set the type of the timestamps
+//#define NMEA0183_RECEIVE_TIMESTAMPS  uint32_t // The clock is read when the '$' and the end delimiter of a frame are received, NMEA0183_ProcessFrame() copies the timestamps in the decoded data
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the ring framer: the frames are found in a ring buffer of the caller (DMA...) and parsed in place (see NMEA0183_RingFramer_GetFrame())
+//#define NMEA0183_RING_FRAMER // Only a frame that wraps around the end of the ring is copied before being parsed
+
+//-----------------------------------------------------------------------------
+
+//! Uncomment the following line if you want the frame queue decoder (ring of frame slots between the interrupt and the main loop). Shall be a power of 2
+//#define NMEA0183_FRAME_QUEUE_DEPTH  4 // This will add the NMEA0183_FrameQueue with 4 frame slots: 3 frames can wait to be processed while the next one is received
+
+//-----------------------------------------------------------------------------
+
 
 
 /******************************************************************************
@@ -122,5 +202,8 @@
 #if defined(NMEA0183_GPS_DECODER_CLASS) && !defined(NMEA0183_FLOAT_BASED_TOOLS)
 # error NMEA0183_GPS_DECODER_CLASS needs NMEA0183_FLOAT_BASED_TOOLS to work
 #endif
+#if defined(NMEA0183_FRAME_QUEUE_DEPTH) && ((NMEA0183_FRAME_QUEUE_DEPTH < 2) || ((NMEA0183_FRAME_QUEUE_DEPTH & (NMEA0183_FRAME_QUEUE_DEPTH - 1)) != 0))
+# error NMEA0183_FRAME_QUEUE_DEPTH shall be a power of 2 greater or equal to 2
+#endif
 //-----------------------------------------------------------------------------
 #endif /* CONF_NMEA0183_H */
\ No newline at end of file
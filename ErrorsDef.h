@@ -301,7 +301,8 @@ typedef enum
 #endif
   ERRORS_TABLE
 #undef X
-  ERR__ERRORS_MAX, // Keep last
+  ERR__ERRORS_MAX, // Keep here
+  ERR__ENUM_MAX_16BITS = 0xFFFF, // Here to force 16-bit enum, the errors with a context (see ERR_CONTEXTUALIZE()) are values of the enum
 } eERRORRESULT;
 
 #define X(eName, val, str) +1
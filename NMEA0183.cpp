@@ -15,6 +15,20 @@
 #    include <cstdint>
 #  endif
 #  include "NMEA0183.hpp"
+#endif
+#if !defined(NMEA0183_NO_SIMD)
+#  if defined(__AVX2__)
+#    define NMEA0183_SIMD_AVX2                                 // 32 bytes at a time
+#    include <immintrin.h>
+#  elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    define NMEA0183_SIMD_SSE2                                 // 16 bytes at a time
+#    include <emmintrin.h>
+#  endif
+#endif
+#if defined(_MSC_VER) && (defined(NMEA0183_FRAME_QUEUE_DEPTH) || defined(NMEA0183_SIMD_AVX2) || defined(NMEA0183_SIMD_SSE2))
+#  include <intrin.h>
+#endif
+#ifdef __cplusplus
 extern "C" {
 #endif
 //-----------------------------------------------------------------------------
@@ -29,7 +43,7 @@ extern "C" {
 /*! @brief Convert a string to int float
  * This function will stop parsing at first char not in '0'..'9', '.'
  * @param[in/out] **pStr Is the string to parse (the original pointer will be advanced) and returns the new position in the string, the field separator ',' or the end of the string
- * @param[in] max Is the max count of digit to extract. Set to 0 if no limit wanted. If >20 then it is the stop character
+ * @param[in] max Is the max count of digit to extract. Set to 0 if no limit wanted. If >20 then it is the stop character (shall not be a digit)
  * @param[in] digits Is the digit count to extract from the string after the decimal separator '.'
  * @return Returns the value extracted from string
  */
@@ -43,22 +57,243 @@ static int32_t __NMEA0183_StringToInt(char** pStr, size_t max, size_t digits);
  */
 static uint32_t __NMEA0183_HexStringToUint(char** pStr, size_t max);
 //-----------------------------------------------------------------------------
-/*! @brief Extract coordinate from string
- * This function will stop parsing at first parsing error
+/*! @brief Extract a char field from string
+ * This function will stop at the delimiter that ends the field if the field is empty, else after the char
  * @param[in] **pStr Is the string to parse (the original pointer will be advanced)
- * @param[out] *pData Is the coordinate extracted
- * @return Returns 'true' if the parse is successful else 'false'
+ * @return Returns the char of the field, or ' ' if the field is empty
+ */
+static char __NMEA0183_ExtractChar(char** pStr);
+/*! @brief Extract a unit field from string
+ * @param[in] **pStr Is the string to parse (the original pointer will be advanced)
+ * @param[in] unit Is the only char the field can have
+ * @return Returns 'true' if the field is the unit else 'false'
+ */
+static bool __NMEA0183_ExtractUnit(char** pStr, char unit);
+/*! @brief Extract the value field of a coordinate from string
+ * This function will stop at the delimiter that ends the field, the direction field is not extracted
+ * @param[in] **pStr Is the string to parse (the original pointer will be advanced)
+ * @param[out] *pData Is the coordinate extracted, its degree and minute are NMEA0183_NO_VALUE if the field is empty
+ */
+static void __NMEA0183_ExtractCoordinateValue(char** pStr, NMEA0183_Coordinate* pData);
+#ifdef NMEA0183_STRING_VIEWS
+/*! @brief Extract a string view from string
+ * This function will stop at the '*', or at the ',' if the field is not the last one. The chars are not copied
+ * @param[in] **pStr Is the string to parse (the original pointer will be advanced)
+ * @param[out] *pView Is the string view extracted
+ * @param[in] lastField Indicate that the field is the last one, only a '*' or a '\0' ends the field
  */
-static bool __NMEA0183_ExtractCoordinate(char** pStr, NMEA0183_Coordinate* pData);
-/*! @brief Extract time from string
- * This function will stop parsing at first parsing error
+static void __NMEA0183_ExtractStringView(char** pStr, NMEA0183_StringView* pView, bool lastField);
+#  define NMEA0183_EXTRACT_TEXT(pStr, text, size, lastField)  __NMEA0183_ExtractStringView((pStr), &(text), (lastField))  // Get a view of the text field
+#else
+/*! @brief Extract a text from string
+ * This function will stop at the '*', or at the ',' if the field is not the last one, or when the text is full. The chars are copied
  * @param[in] **pStr Is the string to parse (the original pointer will be advanced)
- * @param[out] *pData Is the time extracted
+ * @param[out] *pText Is the text extracted, with '\0' terminal
+ * @param[in] size Is the size of the text buffer
+ * @param[in] lastField Indicate that the field is the last one, only a '*' or a '\0' ends the field
+ */
+static void __NMEA0183_ExtractText(char** pStr, char* pText, size_t size, bool lastField);
+#  define NMEA0183_EXTRACT_TEXT(pStr, text, size, lastField)  __NMEA0183_ExtractText((pStr), &(text)[0], (size), (lastField)) // Copy the chars of the text field
+#endif
+//-----------------------------------------------------------------------------
+/*! @brief Field parser of a sentence
+ * The parser extracts one field of the sentence and stops on the delimiter that ends it (',' or '*'), the delimiter is checked by __NMEA0183_ParseFields().
+ * An optional field missing at the end of the sentence is given on the '*', the parser sets its default value
+ * @param[in/out] **pStr Is the first char of the field (the original pointer will be advanced) and returns the position of the delimiter that ends the field, or the char in error
+ * @param[in] field Is the index of the field, 0 for the first field after the address
+ * @param[out] *pData Is the data of the sentence to fill
  * @return Returns 'true' if the parse is successful else 'false'
  */
-static bool __NMEA0183_ExtractTime(char** pStr, NMEA0183_Time* pData);
+typedef bool (*NMEA0183_FieldParser_Func)(char** pStr, size_t field, void* pData);
+
+//! Fields of a sentence, parsed one by one by __NMEA0183_ParseFields()
+typedef struct NMEA0183_SentenceFields
+{
+  NMEA0183_FieldParser_Func fnParseField;             //!< Parser of a field of the sentence
+  uint8_t MinFields;                                  //!< Count of fields of the sentence without its optional fields
+  uint8_t MaxFields;                                  //!< Count of fields of the sentence with all its optional fields
+  const struct NMEA0183_SentenceFields* pShortFormat; //!< Older format of the sentence used when the sentence has less than MinFields fields, NULL if none
+  uint32_t DependentFields;                           //!< Fields that read or overwrite the data of other fields, they are always parsed (see NMEA0183_FieldsCursor.FieldsToParse)
+} NMEA0183_SentenceFields;
+
+//! Checksum of a line computed while its fields are parsed (see NMEA0183_ProcessLine())
+typedef struct NMEA0183_LineChecksum
+{
+  uint8_t CalcCRC;                                    //!< Checksum of the chars of the line before pNext
+  const char* pNext;                                  //!< Next char of the line to add to the checksum
+} NMEA0183_LineChecksum;
+
+//! Cursor on the fields of a sentence
+typedef struct NMEA0183_FieldsCursor
+{
+  const char* pSentence;                              //!< First field of the sentence (just after the ',' that ends the address field)
+  const char* pFrame;                                 //!< Start of the frame, the positions of the field index are relative to it
+  const uint8_t* pFieldPos;                           //!< Field index: position in the frame of each field delimiter ',', the first one ends the address field. NULL if there is no field index
+  size_t FieldPosCount;                               //!< Count of positions in the field index
+  uint32_t FieldsToParse;                             //!< Fields to parse, bit N for the field N (bit 31 for the fields 31 and more). The other fields keep the data already there (see the differential decoding)
+  NMEA0183_LineChecksum* pChecksum;                   //!< Checksum to compute with the chars of each field parsed, NULL if the checksum of the frame is already checked
+} NMEA0183_FieldsCursor;
+
+#define NMEA0183_PARSE_ALL_FIELDS  ( 0xFFFFFFFFu ) // FieldsToParse of a cursor to parse all the fields of the sentence
+#define NMEA0183_FIELDS_CURSOR(pSentence, pFrame, pFieldPos, count)  { (pSentence), (pFrame), (pFieldPos), (count), NMEA0183_PARSE_ALL_FIELDS, NULL } // Initializer of a NMEA0183_FieldsCursor
+
+/*! @brief Parse the fields of a sentence
+ * The field index of the cursor is used to jump to each field, the fields past the field index are found by scanning the sentence
+ * Only the fields of pCursor->FieldsToParse are parsed, the parse stops after the last one of them
+ * @param[in] *pFields Is the fields description of the sentence
+ * @param[in] *pCursor Is the cursor on the fields of the sentence
+ * @param[out] *pData Is the data of the sentence to fill
+ * @param[out] *pPresentFields Is where the bit of each field not empty is set while the field is parsed (the bits of the fields not parsed are kept), NULL if not needed
+ * @return Returns an #eERRORRESULT value enum
+ */
+static eERRORRESULT __NMEA0183_ParseFields(const NMEA0183_SentenceFields* pFields, const NMEA0183_FieldsCursor* pCursor, void* pData, uint32_t* pPresentFields);
+/*! @brief Parse the fields of a sentence without field index
+ * @param[in] *pFields Is the fields description of the sentence
+ * @param[in] *pSentence Is the first field of the sentence (just after the ',' that ends the address field)
+ * @param[out] *pData Is the data of the sentence to fill
+ * @return Returns an #eERRORRESULT value enum
+ */
+static eERRORRESULT __NMEA0183_ParseSentence(const NMEA0183_SentenceFields* pFields, const char* pSentence, void* pData);
+/*! @brief Add the chars of a line up to a position to the checksum computed while its fields are parsed
+ * @param[in/out] *pChecksum Is the checksum to update, its next char is moved to pEnd
+ * @param[in] *pEnd Is the first char not to add
+ */
+static void __NMEA0183_AddToChecksum(NMEA0183_LineChecksum* pChecksum, const char* pEnd);
+//-----------------------------------------------------------------------------
+/*! @brief Compute the checksum of a sentence up to the checksum delimiter and tokenize its fields in the same pass
+ * This function will stop at the first '*' character, or at the end of the buffer. Uses SSE2/AVX2 if available
+ * @param[in] *pData Is the buffer of characters to scan (after the '$')
+ * @param[in] size Is the count of characters in the buffer
+ * @param[in/out] *pCRC Is the checksum to update with the characters before the '*'
+ * @param[out] *pFieldPos Is where the position in the line of each ',' before the '*' is saved, the buffer being at position 1 after the '$' (can be NULL if maxFields is 0). Only the positions up to 255 are saved
+ * @param[in] maxFields Is the maximum count of positions to save in pFieldPos
+ * @param[out] *pFieldCount Is the count of positions saved in pFieldPos
+ * @return Returns the count of characters before the '*', or size if there is no '*'
+ */
+static size_t __NMEA0183_ChecksumToDelimiter(const char* pData, size_t size, uint8_t* pCRC, uint8_t* pFieldPos, size_t maxFields, size_t* pFieldCount);
+/*! @brief Check the start delimiter and the checksum of a line of a known length, and tokenize its fields in the same pass
+ * @param[in] *pLine Is the frame line to check (from '$' to the checksum, the \r\n terminal is optional)
+ * @param[in] length Is the count of characters of the line
+ * @param[out] *pPosCRC Is the position of the '*' in the line
+ * @param[out] *pSize Is the size of the frame, from the '$' to the last char of the checksum
+ * @param[out] *pFieldPos Is where the position in the line of each ',' is saved (can be NULL if maxFields is 0). Only the positions up to 255 are saved
+ * @param[in] maxFields Is the maximum count of positions to save in pFieldPos
+ * @param[out] *pFieldCount Is the count of positions saved in pFieldPos
+ * @return Returns an #eERRORRESULT value enum
+ */
+static eERRORRESULT __NMEA0183_CheckLine(const char* pLine, size_t length, size_t* pPosCRC, size_t* pSize, uint8_t* pFieldPos, size_t maxFields, size_t* pFieldCount);
+/*! @brief Check the start delimiter and the checksum of a line with '\0' terminal, and tokenize its fields in the same pass
+ * The line is scanned character per character up to the '*' or the '\0' terminal, so its length is not needed and no character past the '\0' is read
+ * @param[in] *pLine Is the frame line to check (from '$' to the checksum, the \r\n terminal is optional, with '\0' terminal)
+ * @param[out] *pPosCRC Is the position of the '*' in the line
+ * @param[out] *pSize Is the size of the frame, from the '$' to the last char of the checksum
+ * @param[out] *pFieldPos Is where the position in the line of each ',' is saved (can be NULL if maxFields is 0). Only the positions up to 255 are saved
+ * @param[in] maxFields Is the maximum count of positions to save in pFieldPos
+ * @param[out] *pFieldCount Is the count of positions saved in pFieldPos
+ * @return Returns an #eERRORRESULT value enum
+ */
+static eERRORRESULT __NMEA0183_CheckString(const char* pLine, size_t* pPosCRC, size_t* pSize, uint8_t* pFieldPos, size_t maxFields, size_t* pFieldCount);
+/*! @brief Check the checksum field of a line with '\0' terminal against the checksum calculated
+ * @param[in] *pLine Is the frame line to check (from '$' to the checksum, with '\0' terminal)
+ * @param[in] posCRC Is the position of the '*' in the line, or of the '\0' terminal if the line has no '*'
+ * @param[in] calcCRC Is the checksum calculated with the chars between the '$' and the '*'
+ * @param[out] *pSize Is the size of the frame, from the '$' to the last char of the checksum
+ * @return Returns an #eERRORRESULT value enum
+ */
+static eERRORRESULT __NMEA0183_CheckStringCRC(const char* pLine, size_t posCRC, uint8_t calcCRC, size_t* pSize);
+//-----------------------------------------------------------------------------
+#ifdef NMEA0183_USE_INPUT_BUFFER
+/*! @brief Compute the checksum of a run of frame characters
+ * This function will stop at the first '$', '*', '\r' or '\n' character, or at the end of the buffer
+ * @param[in] *pData Is the buffer of characters to scan
+ * @param[in] size Is the count of characters in the buffer
+ * @param[in/out] *pCRC Is the checksum to update with the characters of the run
+ * @return Returns the count of characters in the run
+ */
+static size_t __NMEA0183_ChecksumRun(const char* pData, size_t size, uint8_t* pCRC);
+/*! @brief Initialize an input buffer
+ * @param[out] *pInput Is the input buffer to initialize
+ */
+static void __NMEA0183_InitInputBuffer(NMEA0183_InputBuffer* pInput);
+/*! @brief Add a received character to an input buffer
+ * @param[in] *pInput Is the input buffer to use
+ * @param[in] data Is the character received
+ * @return Returns an #eERRORRESULT value enum
+ */
+static eERRORRESULT __NMEA0183_AddReceivedCharacter(NMEA0183_InputBuffer* pInput, char data);
+/*! @brief Add a field delimiter position to the field index of the frame
+ * @param[in] *pInput Is the input buffer to use
+ * @param[in] pos Is the position of the field delimiter ',' in the raw frame
+ */
+static void __NMEA0183_AddFieldDelimiter(NMEA0183_InputBuffer* pInput, size_t pos);
+/*! @brief End a frame cut by a start delimiter if its checksum is complete
+ * This is the case of a frame with a lost end delimiter: the frame is set ready to process before the start delimiter of the next frame is added
+ * @param[in] *pInput Is the input buffer to use
+ * @param[in] data Is the character received
+ * @return Returns 'true' if the frame is now ready to process else 'false'
+ */
+static bool __NMEA0183_EndCutFrame(NMEA0183_InputBuffer* pInput, char data);
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+/*! @brief Is the address of the frame subscribed by the decoder?
+ * This function shall be called when the first field delimiter ',' is received, before it is added to the raw frame
+ * @param[in] *pInput Is the input buffer to use
+ * @return Returns 'true' if the frame shall be accumulated else 'false'
+ */
+static bool __NMEA0183_IsSubscribed(const NMEA0183_InputBuffer* pInput);
+#  define NMEA0183_ADDRESS_RECEIVED(pInput)  ( (pInput)->FieldCount > 0 ) // The address is checked by NMEA0183_AddReceivedCharacter() before the frame characters can be added by runs
+#else
+#  define NMEA0183_ADDRESS_RECEIVED(pInput)  ( true )
+#endif
+#endif
+//-----------------------------------------------------------------------------
+#define NMEA0183_SWAR_ONES               ( 0x0101010101010101ull )                                                            // One in each byte of a 64-bits word
+#define NMEA0183_SWAR_HIGHS              ( 0x8080808080808080ull )                                                            // MSB of each byte of a 64-bits word
+#define NMEA0183_SWAR_HAS_ZERO(word)     ( ((word) - NMEA0183_SWAR_ONES) & ~(word) & NMEA0183_SWAR_HIGHS )                   // Not 0 if at least one byte of the word is 0
+#define NMEA0183_SWAR_HAS_BYTE(word,chr) NMEA0183_SWAR_HAS_ZERO((word) ^ (NMEA0183_SWAR_ONES * (uint8_t)(chr)))              // Not 0 if at least one byte of the word is 'chr'
+//-----------------------------------------------------------------------------
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+#  define NMEA0183_READ_CLOCK(pInput, timestamp)  do { if ((pInput)->fnClock != NULL) (pInput)->timestamp = (pInput)->fnClock((pInput)->pClockContext); } while(0) // Read the clock hook of the decoder if set
+#  define NMEA0183_COPY_TIMESTAMPS(pInput, pData)  do { (pData)->StartTimestamp = (pInput)->StartTimestamp; (pData)->EndTimestamp = (pInput)->EndTimestamp; } while(0)
+#else
+#  define NMEA0183_READ_CLOCK(pInput, timestamp)  do {} while(0)
+#  define NMEA0183_COPY_TIMESTAMPS(pInput, pData)  do {} while(0)
+#endif
+#if defined(NMEA0183_DIFFERENTIAL_DECODING) || defined(NMEA0183_FRAME_CACHE_SIZE)
+#  define NMEA0183_HISTORY_OF(pStruct)  ( &(pStruct)->History ) // Previous frames of a decoder or a frame queue
+#else
+#  define NMEA0183_HISTORY_OF(pStruct)  ( NULL )
+#endif
+#if defined(NMEA0183_FRAME_QUEUE_DEPTH) && !defined(NMEA0183_MEMORY_BARRIER)
+#  if defined(__GNUC__)
+#    define NMEA0183_MEMORY_BARRIER()  __sync_synchronize()    // Full memory barrier between the producer and the consumer of the frame queue
+#  elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#    define NMEA0183_MEMORY_BARRIER()  _ReadWriteBarrier()     // Compiler barrier, enough on x86/x64 where the stores are not reordered with other stores
+#  elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM64EC))
+#    define NMEA0183_MEMORY_BARRIER()  __dmb(_ARM64_BARRIER_ISH) // Hardware barrier, ARM64 reorders the memory accesses
+#  elif defined(_MSC_VER) && defined(_M_ARM)
+#    define NMEA0183_MEMORY_BARRIER()  __dmb(_ARM_BARRIER_ISH)   // Hardware barrier, ARM reorders the memory accesses
+#  else
+#    define NMEA0183_MEMORY_BARRIER()  do {} while(0)          // Single core MCU: the volatile indexes are enough. Define NMEA0183_MEMORY_BARRIER() in the configuration file if needed
+#  endif
+#endif
+//-----------------------------------------------------------------------------
+#if defined(NMEA0183_SIMD_AVX2) || defined(NMEA0183_SIMD_SSE2)
+#  if defined(_MSC_VER)
+static inline unsigned __NMEA0183_CountTrailingZeros(uint32_t value) { unsigned long Index; _BitScanForward(&Index, value); return (unsigned)Index; }
+#    define NMEA0183_CTZ(value)  __NMEA0183_CountTrailingZeros(value)     // Index of the first bit set (value shall not be 0)
+#  else
+#    define NMEA0183_CTZ(value)  (unsigned)__builtin_ctz(value)          // Index of the first bit set (value shall not be 0)
+#  endif
+#endif
 //-----------------------------------------------------------------------------
-#define NMEA0183_CHECK_FIELD_DELIMITER  do{ if (*pStr != NMEA0183_FIELD_DELIMITER) return ERR__PARSE_ERROR; ++pStr; } while(0) // Should be a ',' and go to the next character of the string
+#define NMEA0183_SENTENCE_FIELDS_POS  ( 1+5+1 ) // Position of the first field of a sentence with a 5 characters address: '$' + <Talker ID + Sentence ID> + ','
+//-----------------------------------------------------------------------------
+#ifdef NMEA0183_PARSE_ERROR_DIAGNOSTICS
+#  define NMEA0183_FIELD_ERROR          NMEA0183_PARSE_ERROR_AT(pStr - pSentence) // Parse error at the current character of the sentence parser
+#else
+#  define NMEA0183_FIELD_ERROR          ERR__PARSE_ERROR
+#endif
+#define NMEA0183_CHECK_FIELD_DELIMITER  do{ if (*pStr != NMEA0183_FIELD_DELIMITER) return NMEA0183_FIELD_ERROR; ++pStr; } while(0) // Should be a ',' and go to the next character of the string
 //-----------------------------------------------------------------------------
 
 
@@ -79,9 +314,80 @@ eERRORRESULT Init_NMEA0183(NMEA0183_DecodeInput* pDecoder)
 #endif
   //--- Initialize vars ---
   memset(pDecoder, 0, sizeof(NMEA0183_DecodeInput)); // Init GPS input structure
-  pDecoder->PosCRC = sizeof(pDecoder->CRC);          // Set that this is not the CRC for now
+  __NMEA0183_InitInputBuffer(NMEA0183_DECODER_INPUT(pDecoder));
+  return ERR_OK;
+}
+
+
+//=============================================================================
+// [STATIC] Initialize an input buffer
+//=============================================================================
+void __NMEA0183_InitInputBuffer(NMEA0183_InputBuffer* pInput)
+{
+  memset(pInput, 0, sizeof(NMEA0183_InputBuffer));
+  pInput->PosCRC = sizeof(pInput->CRC);              // Set that this is not the CRC for now
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+  pInput->SentenceMask = NMEA0183_SUBSCRIBE_ALL;     // Decode all sentences by default
+  pInput->TalkerFilter = NMEA0183_ANY_TALKER;
+#endif
+}
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+//=============================================================================
+// Set the sentences subscribed by the decoder
+//=============================================================================
+eERRORRESULT NMEA0183_SetSentenceSubscription(NMEA0183_DecodeInput* pDecoder, uint32_t sentenceMask, uint16_t talkerID)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pDecoder == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  NMEA0183_DECODER_INPUT(pDecoder)->SentenceMask = sentenceMask;
+  NMEA0183_DECODER_INPUT(pDecoder)->TalkerFilter = talkerID;
+  return ERR_OK;
+}
+#endif
+
+//=============================================================================
+// Get the count of resynchronizations of the decoder
+//=============================================================================
+eERRORRESULT NMEA0183_GetResyncCount(NMEA0183_DecodeInput* pDecoder, uint32_t* pCount)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pDecoder == NULL) || (pCount == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  *pCount = NMEA0183_DECODER_INPUT(pDecoder)->ResyncCount;
+  return ERR_OK;
+}
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+//=============================================================================
+// Set the clock hook of the decoder
+//=============================================================================
+eERRORRESULT NMEA0183_SetReceiveClock(NMEA0183_DecodeInput* pDecoder, NMEA0183_Clock_Func fnClock, void* pContext)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pDecoder == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  NMEA0183_DECODER_INPUT(pDecoder)->fnClock       = fnClock;
+  NMEA0183_DECODER_INPUT(pDecoder)->pClockContext = pContext;
+  return ERR_OK;
+}
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+//=============================================================================
+// Get the statistics of the decoded frames cache
+//=============================================================================
+eERRORRESULT NMEA0183_GetFrameCacheStatistics(NMEA0183_DecodeInput* pDecoder, uint32_t* pHits, uint32_t* pMisses)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pDecoder == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if (pHits   != NULL) *pHits   = pDecoder->History.CacheHits;
+  if (pMisses != NULL) *pMisses = pDecoder->History.CacheMisses;
   return ERR_OK;
 }
+#endif
 
 //-----------------------------------------------------------------------------
 
@@ -98,52 +404,147 @@ eERRORRESULT NMEA0183_AddReceivedCharacter(NMEA0183_DecodeInput* pDecoder, char
 #ifdef CHECK_NULL_PARAM
   if (pDecoder == NULL) return ERR__PARAMETER_ERROR;
 #endif
+  return __NMEA0183_AddReceivedCharacter(NMEA0183_DECODER_INPUT(pDecoder), data);
+}
+
+
+//=============================================================================
+// [STATIC] Add a received character to an input buffer
+//=============================================================================
+eERRORRESULT __NMEA0183_AddReceivedCharacter(NMEA0183_InputBuffer* pInput, char data)
+{
   eERRORRESULT Error = ERR_OK;
 
   //--- Checks ---
-  if (pDecoder->State == NMEA0183_IN_PROCESS) return ERR__BUSY; // The previous frame is being parced
+  if (pInput->State == NMEA0183_IN_PROCESS) return ERR__BUSY;   // The previous frame is being parced
 
   //--- Process character ---
   switch (data) // Do something with the current character received
   {
     case NMEA0183_START_DELIMITER: // Start a new frame
-      pDecoder->BufferPos = 0;                            // Initialize buffer position
-      pDecoder->PosCRC    = sizeof(pDecoder->CRC);        // Initialize to current char is for frame input
-      pDecoder->CurrCalcCRC = 0;                          // Initialize the current CRC calculus
-      if (pDecoder->State == NMEA0183_TO_PROCESS) Error = ERR__BUFFER_OVERRIDE; // The previous buffer does not have been processed but new data available
-      pDecoder->State = NMEA0183_ACCUMULATE;
+      if (pInput->State == NMEA0183_ACCUMULATE) ++pInput->ResyncCount;        // The end of the frame was lost, resume from the new frame
+      if (pInput->State == NMEA0183_TO_PROCESS) Error = ERR__BUFFER_OVERRIDE; // The previous buffer does not have been processed but new data available
+      pInput->BufferPos = 0;                              // Initialize buffer position
+      pInput->PosCRC    = sizeof(pInput->CRC);            // Initialize to current char is for frame input
+      pInput->CurrCalcCRC = 0;                            // Initialize the current CRC calculus
+      pInput->FieldCount  = 0;                            // Initialize the field index
+      pInput->State = NMEA0183_ACCUMULATE;
+      NMEA0183_READ_CLOCK(pInput, StartTimestamp);
       break;
 
     case NMEA0183_CHECKSUM_DELIMITER: // Next characters will be for CRC
-      pDecoder->PosCRC = 0;                               // Next will be the CRC value
+      pInput->PosCRC = 0;                                 // Next will be the CRC value
       break;
 
     case NMEA0183_END_CR_DELIMITER:
     case NMEA0183_END_LF_DELIMITER:
-      if (pDecoder->State != NMEA0183_WAIT_START)
-        pDecoder->State = NMEA0183_TO_PROCESS;            // Frame have to be processed as soon as possible (in the main loop). Not now, in case we are in an interrupt...
+      if (pInput->State == NMEA0183_ACCUMULATE)
+      {
+        pInput->State = NMEA0183_TO_PROCESS;              // Frame have to be processed as soon as possible (in the main loop). Not now, in case we are in an interrupt...
+        NMEA0183_READ_CLOCK(pInput, EndTimestamp);
+      }
       data = '\0';                                        // The data received is now a end of string character
       break;
 
+    case NMEA0183_START_ENCAPSULATION_DELIMITER:
+      if (pInput->State == NMEA0183_ACCUMULATE)
+      {
+        ++pInput->ResyncCount;
+        pInput->State = NMEA0183_WAIT_START;              // The end of the frame was lost, skip the encapsulation sentence
+        return Error;
+      }
+      // Else it is a frame char
+      // fall through
     default:
-      if (pDecoder->PosCRC < sizeof(pDecoder->CRC))       // In CRC?
+      if (pInput->PosCRC < sizeof(pInput->CRC))           // In CRC?
+      {
+        pInput->CRC[pInput->PosCRC] = (char)data;         // Set CRC char
+        ++pInput->PosCRC;                                 // Select next char
+      }
+      else
       {
-        pDecoder->CRC[pDecoder->PosCRC] = (char)data;     // Set CRC char
-        ++pDecoder->PosCRC;                               // Select next char
+        pInput->CurrCalcCRC ^= data;                      // Else compute CRC
+        if ((data == NMEA0183_FIELD_DELIMITER) && (pInput->State == NMEA0183_ACCUMULATE))
+        {
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+          if ((pInput->FieldCount == 0) && (__NMEA0183_IsSubscribed(pInput) == false))
+            pInput->State = NMEA0183_WAIT_START;          // Sentence not subscribed: skip the rest of the frame without checksum nor parsing
+          else
+#endif
+          __NMEA0183_AddFieldDelimiter(pInput, pInput->BufferPos);   // Save the position of the field for the parsing
+        }
       }
-      else pDecoder->CurrCalcCRC ^= data;                 // Else compute CRC
       break;
   }
 
   //--- Add char to raw frame buffer ---
-  if (pDecoder->State != NMEA0183_TO_PROCESS)
+  if (pInput->State != NMEA0183_TO_PROCESS)
+  {
+    if (pInput->BufferPos < NMEA0183_FRAME_BUFFER_SIZE)
+    {
+      pInput->RawFrame[pInput->BufferPos] = (char)data;     // Set Frame char
+      pInput->BufferPos++;                                  // Select next char
+    }
+    else if (pInput->State != NMEA0183_WAIT_START) Error = ERR__BUFFER_FULL;
+  }
+  return Error;
+}
+
+
+//=============================================================================
+// Add a buffer of NMEA0183 received characters
+//=============================================================================
+eERRORRESULT NMEA0183_AddReceivedBuffer(NMEA0183_DecodeInput* pDecoder, const char* pBuffer, size_t size, NMEA0183_FrameReady_Func fnFrameReady, void* pContext)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pDecoder == NULL) || (pBuffer == NULL) || (fnFrameReady == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  eERRORRESULT Error = ERR_OK;
+  NMEA0183_InputBuffer* pInput = NMEA0183_DECODER_INPUT(pDecoder);
+  const char* const pEnd = &pBuffer[size];
+
+  //--- Checks ---
+  if (pInput->State == NMEA0183_IN_PROCESS) return ERR__BUSY;   // The previous frame is being parced
+
+  //--- Process buffer ---
+  while (pBuffer < pEnd)
   {
-    if (pDecoder->BufferPos < NMEA0183_FRAME_BUFFER_SIZE)
+    if (pInput->State == NMEA0183_WAIT_START)                       // Outside a frame? Nothing to keep until the next '$'
     {
-      pDecoder->RawFrame[pDecoder->BufferPos] = (char)data; // Set Frame char
-      pDecoder->BufferPos++;                                // Select next char
+      const char* pStart = (const char*)memchr(pBuffer, NMEA0183_START_DELIMITER, (size_t)(pEnd - pBuffer));
+      if (pStart == NULL) break;                                    // No start of frame in the rest of the buffer
+      pBuffer = pStart;
+    }
+    else if ((pInput->State == NMEA0183_ACCUMULATE) && (pInput->PosCRC >= sizeof(pInput->CRC)) && NMEA0183_ADDRESS_RECEIVED(pInput))
+    {
+      //--- Add the run of frame characters at once ---
+      const size_t RunSize = __NMEA0183_ChecksumRun(pBuffer, (size_t)(pEnd - pBuffer), &pInput->CurrCalcCRC);
+      if (RunSize > 0)
+      {
+        const size_t Room = NMEA0183_FRAME_BUFFER_SIZE - pInput->BufferPos;
+        const size_t CopySize = (RunSize < Room ? RunSize : Room);
+        memcpy(&pInput->RawFrame[pInput->BufferPos], pBuffer, CopySize);     // Set Frame chars
+        const char* pField = (const char*)memchr(pBuffer, NMEA0183_FIELD_DELIMITER, CopySize);
+        while (pField != NULL)                                                // Save the position of each field of the run for the parsing
+        {
+          const size_t FieldOffset = (size_t)(pField - pBuffer);
+          __NMEA0183_AddFieldDelimiter(pInput, pInput->BufferPos + FieldOffset);
+          pField = (const char*)memchr(pField + 1, NMEA0183_FIELD_DELIMITER, CopySize - FieldOffset - 1);
+        }
+        pInput->BufferPos += CopySize;                                        // Select next char
+        if (CopySize < RunSize) Error = ERR__BUFFER_FULL;
+        pBuffer += RunSize;
+        continue;
+      }
     }
-    else if (pDecoder->State != NMEA0183_WAIT_START) Error = ERR__BUFFER_FULL;
+
+    //--- Delimiters and CRC characters ---
+    if (__NMEA0183_EndCutFrame(pInput, *pBuffer)) fnFrameReady(pDecoder, pContext);   // The end of the frame was lost but its checksum is complete, the start delimiter is processed next
+    const bool FrameWasReady = (pInput->State == NMEA0183_TO_PROCESS);
+    const eERRORRESULT CharError = __NMEA0183_AddReceivedCharacter(pInput, *pBuffer);
+    if (CharError != ERR_OK) Error = CharError;
+    ++pBuffer;
+    if ((FrameWasReady == false) && (pInput->State == NMEA0183_TO_PROCESS)) fnFrameReady(pDecoder, pContext);   // A new frame is complete
   }
   return Error;
 }
@@ -160,39 +561,51 @@ eERRORRESULT NMEA0183_AddReceivedCharacter(NMEA0183_DecodeInput* pDecoder, char
 //=============================================================================
 int32_t __NMEA0183_StringToInt(char** pStr, size_t max, size_t digits)
 {
+  static const uint32_t POW10[] = { 1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u };
   if (**pStr == '\0') return NMEA0183_NO_VALUE;    // Empty string? return error value
   bool Sign = (**pStr == '-');                     // Minus character? Save it
   if (Sign || (**pStr == '+')) ++(*pStr);          // Minus character or Plus character? Go to next one
   if (**pStr == '\0') return NMEA0183_NO_VALUE;    // Empty string? return error value
   if ((**pStr == NMEA0183_FIELD_DELIMITER) || (**pStr == NMEA0183_CHECKSUM_DELIMITER)) return NMEA0183_NO_VALUE; // If the field is empty, set no data
   size_t CharCount = (max == 0 ? NMEA0183_FRAME_BUFFER_SIZE : max); // If max = 0, then extract until ',', '*', or '\0'
-  int32_t Result = 0;
+  const char* pChar = *pStr;
+  uint32_t Result = 0;
 
-  //--- Extract value ---
-  bool PointFound = false;
+  //--- Extract int part ---
   while (CharCount > 0)
   {
-    if (**pStr == (char)max) break;                // Stop char found
-    if (**pStr != '.')
+    const uint32_t Digit = (uint32_t)(uint8_t)*pChar - '0';
+    if (Digit > 9) break;                          // If pChar[0] = '\0', '.' or other char, the result should be > 9 then break the while...
+    Result = (Result * 10u) + Digit;               // Add the unit value
+    --CharCount;
+    ++pChar;                                       // Next char
+  }
+  //--- Extract decimal part ---
+  while ((CharCount > 0) && (*pChar == '.') && (max != '.'))                // Stop char '.' found? The decimal part is not wanted
+  {
+    --CharCount;
+    ++pChar;                                       // Skip the '.'
+    const size_t DigitsMax = (CharCount < digits ? CharCount : digits);
+    size_t DigitsCount = 0;
+    while (DigitsCount < DigitsMax)                // Extract only the digits wanted
     {
-      if ((uint_fast8_t)(**pStr - '0') > 9) break; // If pStr[0] = '\0' or other char, the result should be > 9 then break the while...
-      if (PointFound)                              // Decrement digit only if the char '.' have been found
-      {
-        if (digits == 0) break;
-        --digits;
-      }
-      Result *= 10;                                // Multiply the int part by 10
-      Result += (int32_t)(**pStr - '0');           // Add the unit value
+      const uint32_t Digit = (uint32_t)(uint8_t)pChar[DigitsCount] - '0';
+      if (Digit > 9) break;
+      Result = (Result * 10u) + Digit;             // Add the unit value
+      ++DigitsCount;
     }
-    else PointFound = true;
-    --CharCount;
-    ++(*pStr);                                     // Next char
+    pChar += DigitsCount;
+    CharCount -= DigitsCount;
+    digits -= DigitsCount;
+    if ((CharCount > 0) && (digits == 0) && (((uint32_t)(uint8_t)*pChar - '0') <= 9)) break; // All digits wanted extracted, the other digits are ignored
   }
-  while (digits > 0) { Result *= 10; --digits; }   // Force multiplier to digits
+  *pStr = (char*)pChar;
+  while (digits > 9) { Result *= 10u; --digits; }  // Force multiplier to digits
+  Result *= POW10[digits];
   if (max == 0)
     while ((**pStr != NMEA0183_FIELD_DELIMITER) && (**pStr != NMEA0183_CHECKSUM_DELIMITER) && (**pStr != 0)) ++(*pStr); // Go to the end of the field or the end of the string
-  if (Sign) Result = -Result;                      // If negative value, then set negative IntPart as result
-  return Result;                                   // Return the new position
+  if (Sign) Result = 0u - Result;                  // If negative value, then set negative IntPart as result
+  return (int32_t)Result;                          // Return the new position
 }
 
 //-----------------------------------------------------------------------------
@@ -239,62 +652,187 @@ uint32_t __NMEA0183_HexStringToUint(char** pStr, size_t max)
 
 
 
-
-
-//**********************************************************************************************************************************************************
 //=============================================================================
-// [STATIC] Extract coordinate
+// [STATIC] Compute the checksum of a sentence up to the checksum delimiter
 //=============================================================================
-bool __NMEA0183_ExtractCoordinate(char** pStr, NMEA0183_Coordinate* pData)
+size_t __NMEA0183_ChecksumToDelimiter(const char* pData, size_t size, uint8_t* pCRC, uint8_t* pFieldPos, size_t maxFields, size_t* pFieldCount)
 {
-  if (**pStr != NMEA0183_FIELD_DELIMITER)                         // Value found?
+  size_t Pos = 0;
+  uint8_t CRC = *pCRC;
+  size_t FieldCount = 0;
+#define NMEA0183_SAVE_FIELDS(commas)                                                                  \
+  while (((commas) != 0) && (FieldCount < maxFields))                                                 \
+  {                                                                                                   \
+    const size_t FieldPos = 1 + Pos + NMEA0183_CTZ(commas);                                           \
+    if (FieldPos > 0xFF) { maxFields = FieldCount; break; }                                           \
+    pFieldPos[FieldCount++] = (uint8_t)FieldPos;                                                      \
+    (commas) &= (commas) - 1u;                                                                        \
+  }
+
+#if defined(NMEA0183_SIMD_AVX2)
+  //--- Process 32 characters at a time ---
+  const __m256i Star  = _mm256_set1_epi8(NMEA0183_CHECKSUM_DELIMITER);
+  const __m256i Comma = _mm256_set1_epi8(NMEA0183_FIELD_DELIMITER);
+  const __m256i Index = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+  __m256i WordCRC = _mm256_setzero_si256();
+  while (Pos < size)
   {
-    int32_t Value = __NMEA0183_StringToInt(pStr, '.', 0);         //*** Get degree and minute <(d)ddmm>
-    //--- Get Degree ---
-    pData->Degree = (uint8_t)(Value / 100);                       //    And save degree
-    //--- Get Minute ---
-    pData->Minute = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 7); //*** Get and save decimal minute <.mmmm[m][m][m]> (divide by 10^7 to get the real minute)*/
-    pData->Minute += ((Value % 100) * 10000000);                  //    And save minute with decimal minute
-    if (**pStr != NMEA0183_FIELD_DELIMITER) return false;         // Parsing: Should be a ','
-    ++(*pStr);                                                    // Parsing: Skip ','
+    __m256i Block;
+    if ((Pos + sizeof(__m256i)) <= size) Block = _mm256_loadu_si256((const __m256i*)&pData[Pos]);
+    else
+    {
+      char Last[sizeof(__m256i)] = { 0 };                                      // The last characters are completed with '\0' that do not change the checksum
+      memcpy(&Last[0], &pData[Pos], size - Pos);
+      Block = _mm256_loadu_si256((const __m256i*)&Last[0]);
+    }
+    const uint32_t Found = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(Block, Star));
+    if (FieldCount < maxFields)                                                // Tokenize the fields in the same pass
+    {
+      uint32_t Commas = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(Block, Comma));
+      if (Found != 0) Commas &= ((Found & (0u - Found)) - 1u);                 // Only the ',' before the first '*'
+      NMEA0183_SAVE_FIELDS(Commas);
+    }
+    if (Found != 0)                                                            // '*' in the block? Keep only the characters before it
+    {
+      const unsigned Count = NMEA0183_CTZ(Found);
+      WordCRC = _mm256_xor_si256(WordCRC, _mm256_and_si256(Block, _mm256_cmpgt_epi8(_mm256_set1_epi8((char)Count), Index)));
+      Pos += Count;
+      break;
+    }
+    WordCRC = _mm256_xor_si256(WordCRC, Block);                                // XOR is byte independent, fold the bytes later
+    Pos += sizeof(__m256i);
   }
-  else                                                            // else no value found
+  __m128i FoldCRC = _mm_xor_si128(_mm256_castsi256_si128(WordCRC), _mm256_extracti128_si256(WordCRC, 1));
+#elif defined(NMEA0183_SIMD_SSE2)
+  //--- Process 16 characters at a time ---
+  const __m128i Star  = _mm_set1_epi8(NMEA0183_CHECKSUM_DELIMITER);
+  const __m128i Comma = _mm_set1_epi8(NMEA0183_FIELD_DELIMITER);
+  const __m128i Index = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  __m128i FoldCRC = _mm_setzero_si128();
+  while (Pos < size)
   {
-    pData->Degree = (uint8_t)NMEA0183_NO_VALUE;
-    pData->Minute = (uint32_t)NMEA0183_NO_VALUE;
-    ++(*pStr);                                                    // Parsing: Skip ','
+    __m128i Block;
+    if ((Pos + sizeof(__m128i)) <= size) Block = _mm_loadu_si128((const __m128i*)&pData[Pos]);
+    else
+    {
+      char Last[sizeof(__m128i)] = { 0 };                                      // The last characters are completed with '\0' that do not change the checksum
+      memcpy(&Last[0], &pData[Pos], size - Pos);
+      Block = _mm_loadu_si128((const __m128i*)&Last[0]);
+    }
+    const uint32_t Found = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(Block, Star));
+    if (FieldCount < maxFields)                                                // Tokenize the fields in the same pass
+    {
+      uint32_t Commas = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(Block, Comma));
+      if (Found != 0) Commas &= ((Found & (0u - Found)) - 1u);                 // Only the ',' before the first '*'
+      NMEA0183_SAVE_FIELDS(Commas);
+    }
+    if (Found != 0)                                                            // '*' in the block? Keep only the characters before it
+    {
+      const unsigned Count = NMEA0183_CTZ(Found);
+      FoldCRC = _mm_xor_si128(FoldCRC, _mm_and_si128(Block, _mm_cmpgt_epi8(_mm_set1_epi8((char)Count), Index)));
+      Pos += Count;
+      break;
+    }
+    FoldCRC = _mm_xor_si128(FoldCRC, Block);                                   // XOR is byte independent, fold the bytes later
+    Pos += sizeof(__m128i);
   }
-  //--- Get Direction ---
-  if (**pStr != NMEA0183_FIELD_DELIMITER)                         // Value found?
+#endif
+#if defined(NMEA0183_SIMD_AVX2) || defined(NMEA0183_SIMD_SSE2)
+  FoldCRC = _mm_xor_si128(FoldCRC, _mm_srli_si128(FoldCRC, 8));              // Fold the 16 bytes into one
+  FoldCRC = _mm_xor_si128(FoldCRC, _mm_srli_si128(FoldCRC, 4));
+  FoldCRC = _mm_xor_si128(FoldCRC, _mm_srli_si128(FoldCRC, 2));
+  FoldCRC = _mm_xor_si128(FoldCRC, _mm_srli_si128(FoldCRC, 1));
+  CRC ^= (uint8_t)_mm_cvtsi128_si32(FoldCRC);
+  if (Pos > size) Pos = size;                                                  // The last block was not full
+#else
+  //--- Process character per character ---
+  while ((Pos < size) && (pData[Pos] != NMEA0183_CHECKSUM_DELIMITER))
   {
-    pData->Direction = **pStr;                                    //*** Get coordinate direction <N/S or E/W>
-    ++(*pStr);                                                    // Parsing: Skip <N/S or E/W>
+    if ((pData[Pos] == NMEA0183_FIELD_DELIMITER) && (FieldCount < maxFields))  // Tokenize the fields in the same pass
+    {
+      if ((1 + Pos) > 0xFF) maxFields = FieldCount;
+      else pFieldPos[FieldCount++] = (uint8_t)(1 + Pos);
+    }
+    CRC ^= (uint8_t)pData[Pos];
+    ++Pos;
   }
-  else pData->Direction = ' ';                                    // Else no direction
-  if (**pStr != NMEA0183_FIELD_DELIMITER) return false;           // Parsing: Should be a ','
-  ++(*pStr);                                                      // Parsing: Skip ','
-  return true;
+#endif
+#undef NMEA0183_SAVE_FIELDS
+  *pCRC = CRC;
+  *pFieldCount = FieldCount;
+  return Pos;
 }
 
+//-----------------------------------------------------------------------------
+
 
+
+#ifdef NMEA0183_USE_INPUT_BUFFER
 //=============================================================================
-// [STATIC] Extract time
+// [STATIC] Compute the checksum of a run of frame characters
 //=============================================================================
-bool __NMEA0183_ExtractTime(char** pStr, NMEA0183_Time* pData)
+size_t __NMEA0183_ChecksumRun(const char* pData, size_t size, uint8_t* pCRC)
 {
-  //--- Get Time ---
-  pData->Hour   = (uint8_t)__NMEA0183_StringToInt(pStr, 2, 0);    //*** Get and save hour <hh>
-  pData->Minute = (uint8_t)__NMEA0183_StringToInt(pStr, 2, 0);    //*** Get and save minute <mm>
-  pData->Second = (uint8_t)__NMEA0183_StringToInt(pStr, 2, 0);    //*** Get and save second <ss>
-  //--- Get milliseconds ---
-  if (**pStr == '.')                                              // If the next char is '.' then there is a millisecond value to get
+  size_t Pos = 0;
+  uint64_t WordCRC = 0;
+
+  //--- Process 8 characters at a time while there is no delimiter in them ---
+  while ((Pos + sizeof(uint64_t)) <= size)
+  {
+    uint64_t Word;
+    memcpy(&Word, &pData[Pos], sizeof(Word));                    // Unaligned load of the next 8 characters
+    const uint64_t Delimiters = NMEA0183_SWAR_HAS_BYTE(Word, NMEA0183_START_DELIMITER)  | NMEA0183_SWAR_HAS_BYTE(Word, NMEA0183_START_ENCAPSULATION_DELIMITER)
+                              | NMEA0183_SWAR_HAS_BYTE(Word, NMEA0183_CHECKSUM_DELIMITER)
+                              | NMEA0183_SWAR_HAS_BYTE(Word, NMEA0183_END_CR_DELIMITER) | NMEA0183_SWAR_HAS_BYTE(Word, NMEA0183_END_LF_DELIMITER);
+    if (Delimiters != 0) break;                                  // A delimiter is in the word, finish character per character
+    WordCRC ^= Word;                                             // XOR is byte independent, fold the bytes later
+    Pos += sizeof(Word);
+  }
+  WordCRC ^= (WordCRC >> 32);                                    // Fold the 8 bytes of the word into one
+  WordCRC ^= (WordCRC >> 16);
+  WordCRC ^= (WordCRC >>  8);
+  uint8_t CRC = *pCRC ^ (uint8_t)WordCRC;
+
+  //--- Process the remaining characters ---
+  while (Pos < size)
   {
-    pData->MilliS = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 3); //*** Get and save milliseconds <zzz>
-  } else pData->MilliS = (uint16_t)NMEA0183_NO_VALUE;             // else set no value
-  if (**pStr != NMEA0183_FIELD_DELIMITER) return false;           // Parsing: Should be a ','
-  ++(*pStr);                                                      // Parsing: Skip ','
+    const char Current = pData[Pos];
+    if ((Current == NMEA0183_START_DELIMITER)  || (Current == NMEA0183_START_ENCAPSULATION_DELIMITER) || (Current == NMEA0183_CHECKSUM_DELIMITER)
+     || (Current == NMEA0183_END_CR_DELIMITER) || (Current == NMEA0183_END_LF_DELIMITER)) break;
+    CRC ^= (uint8_t)Current;
+    ++Pos;
+  }
+  *pCRC = CRC;
+  return Pos;
+}
+
+
+//=============================================================================
+// [STATIC] Add a field delimiter position to the field index of the frame
+//=============================================================================
+void __NMEA0183_AddFieldDelimiter(NMEA0183_InputBuffer* pInput, size_t pos)
+{
+  if (pos >= NMEA0183_FRAME_BUFFER_SIZE) return;                                    // The delimiter will not be in the raw frame
+  if (pInput->FieldCount < NMEA0183_FIELD_INDEX_SIZE) pInput->FieldPos[pInput->FieldCount] = (uint8_t)pos;
+  if (pInput->FieldCount < 0xFF) ++pInput->FieldCount;                              // Count the field even if the index is full
+}
+
+
+//=============================================================================
+// [STATIC] End a frame cut by a start delimiter if its checksum is complete
+//=============================================================================
+bool __NMEA0183_EndCutFrame(NMEA0183_InputBuffer* pInput, char data)
+{
+  if ((data != NMEA0183_START_DELIMITER) && (data != NMEA0183_START_ENCAPSULATION_DELIMITER)) return false;
+  if (pInput->State != NMEA0183_ACCUMULATE) return false;
+  const size_t Pos = pInput->BufferPos;
+  if ((Pos < 3) || (pInput->RawFrame[Pos - 3] != NMEA0183_CHECKSUM_DELIMITER)) return false;   // The last chars of the frame shall be '*' and the 2 checksum chars
+  pInput->State = NMEA0183_TO_PROCESS;                                              // Same as an end delimiter received
+  NMEA0183_READ_CLOCK(pInput, EndTimestamp);
+  ++pInput->ResyncCount;
   return true;
 }
+#endif
 
 //-----------------------------------------------------------------------------
 
@@ -303,973 +841,2878 @@ bool __NMEA0183_ExtractTime(char** pStr, NMEA0183_Time* pData)
 
 
 //**********************************************************************************************************************************************************
-#ifdef NMEA0183_DECODE_AAM
 //=============================================================================
-// [STATIC] Process the AAM (Waypoint Arrival Alarm) sentence
+// Parse a decimal or fixed point value field
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessAAM(const char* pSentence, NMEA0183_AAMdata* pData)
-{ // Format: $--AAM,<Entered:A/V>,<Waypoint:A/V>,<Circle:r.rr[r][r]>,N,<WaypointID>*<CheckSum>
-  char* pStr = (char*)pSentence;
-  eERRORRESULT Error = ERR_OK;
-
-  //--- Get Status ---
-  pData->ArrivalStatus = *pStr;                                        //*** Get status of arrival: 'A' = arrival circle entered ; 'V' = arrival circle not entered
-  ++pStr;                                                              // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->PassedWaypoint = *pStr;                                       //*** Get status of the passed waypoint: 'A' = arrival circle entered ; 'V' = arrival circle not entered
-  ++pStr;                                                              // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Arrival circle radius ---
-  pData->CircleRadius = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4); //*** Get and save Arrival circle radius <Circle:r.rr[r][r]> (divide by 10^4 to get the circle radius in nautical miles)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'N') return ERR__PARSE_ERROR;                           // Parsing: Should be 'N'
-  ++pStr;                                                              // Parsing: Skip 'N'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Waypoint ID ---
-  size_t TxtPos = 0;
-  while (TxtPos < (NMEA0183_AAM_WAYPOINT_ID_MAX_SIZE-1))
-  {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-    pData->WaypointID[TxtPos] = *pStr;                                 //*** Get char
-    ++TxtPos;
-    ++pStr;
-  }
-  pData->WaypointID[TxtPos] = '\0';
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) Error = ERR__PARSE_ERROR;  // Should be a '*'
-  return Error;
+int32_t NMEA0183_ParseFieldInt(char** ppStr, size_t digits)
+{
+  return __NMEA0183_StringToInt(ppStr, 0, digits);
 }
-#endif
 
 
-
-#ifdef NMEA0183_DECODE_ALM
 //=============================================================================
-// [STATIC] Process the ALM (GPS Almanac Data) sentence
+// Parse an integer value field of a count of digits
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessALM(const char* pSentence, NMEA0183_ALMdata* pData)
-{ // Format: $--ALM,<Total:t>,<Curr:c>,<SatPRN:ss>,<WeekNum:[w][w][w]w>,<SV:vv>,<e:eeee>,<toa:yy>,<Sigma_i:iiii>,<OMEGADOT:dddd>,<rootA:rrrrrr>,<OMEGA:oooooo>,<OMEGA0:aaaaaa>,<Mo:mmmmmm>,<af0:aaa>,<af1:bbb>*<CheckSum>
-  char* pStr = (char*)pSentence;
-  uint32_t Value;
-
-  //--- Get message informations ---
-  pData->TotalSentence      =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save total sentence <t>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->SentenceNumber     =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save sequence number <c>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->SatellitePRNnumber =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save satellite PRN number <ss>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->GPSweekNumber      = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save GPS week number <[w][w][w]w>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get data ---
-  pData->SV_NAVhealth = (uint8_t)__NMEA0183_HexStringToUint(&pStr, ',');   //*** Get and save NAV+SV health <vv>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->e        = (uint16_t)__NMEA0183_HexStringToUint(&pStr, ',');      //*** Get and save inclination eccentricity <eeee>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->toa      =  (uint8_t)__NMEA0183_HexStringToUint(&pStr, ',');      //*** Get and save almanac reference time in seconds <yy>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->Sigma_i  =  (int16_t)__NMEA0183_HexStringToUint(&pStr, ',');      //*** Get and save inclination angle <iiii>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->OMEGADOT =  (int16_t)__NMEA0183_HexStringToUint(&pStr, ',');      //*** Get and save rate of right ascension <dddd>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->Root_A   = (uint32_t)__NMEA0183_HexStringToUint(&pStr, ',');      //*** Get and save root of semi-major axis <rrrrrr>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  Value = (uint32_t)__NMEA0183_HexStringToUint(&pStr, ',');                //*** Get 24-bit signed longitude of ascension node <oooooo>
-  pData->OMEGA = NMEA0183_DATA_EXTRACT_TO_SIGNED(int32_t, Value, 0, 24);   //*** Save 32-bit signed longitude of ascension node <oooooo>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  Value = (uint32_t)__NMEA0183_HexStringToUint(&pStr, ',');                //*** Get 24-bit signed argument of perigee <aaaaaa>
-  pData->OMEGA_0 = NMEA0183_DATA_EXTRACT_TO_SIGNED(int32_t, Value, 0, 24); //*** Save 32-bit signed argument of perigee <aaaaaa>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  Value = (uint32_t)__NMEA0183_HexStringToUint(&pStr, ',');                //*** Get 24-bit signed mean anomaly <mmmmmm>
-  pData->Mo = NMEA0183_DATA_EXTRACT_TO_SIGNED(int32_t, Value, 0, 24);      //*** Save 32-bit signed mean anomaly <mmmmmm>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  Value = (uint32_t)__NMEA0183_HexStringToUint(&pStr, ',');                //*** Get 11-bit clock parameter <aaa>
-  pData->af0 = NMEA0183_DATA_EXTRACT_TO_SIGNED(int16_t, Value, 0, 11);     //*** Save 16-bit clock parameter <aaa>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  Value = (uint32_t)__NMEA0183_HexStringToUint(&pStr, ',');                //*** Get 11-bit clock parameter <bbb>
-  pData->af1 = NMEA0183_DATA_EXTRACT_TO_SIGNED(int16_t, Value, 0, 11);     //*** Save 16-bit clock parameter <bbb>
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;       // Should be a '*'
-  return ERR_OK;
+int32_t NMEA0183_ParseFieldIntDigits(char** ppStr, size_t count)
+{
+  return __NMEA0183_StringToInt(ppStr, count, 0);
 }
-#endif
-
 
 
-#ifdef NMEA0183_DECODE_APB
 //=============================================================================
-// [STATIC] Process the APB (Heading/Track Controller (Autopilot) Sentence "B") sentence
+// Parse an hexadecimal value field
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessAPB(const char* pSentence, NMEA0183_APBdata* pData)
-{ // Format: $--APB,<Status:A/V>,<Status:A/V>,<Magnitude:m.m[m][m][m]>,<L/R>,<N/K>,<A/V>,<A/V>,<BOtoD:b[.b][b]>,<M/T>,<WaypointID>,<BCPtoD:c[.c][c]>,<M/T>,<H2StoD:h[.h][h]>,<M/T>,<FAA:A/D/E/M/S/N>*<CheckSum>
-  char* pStr = (char*)pSentence;
-
-  //--- Get Status ---
-  pData->Status1 = *pStr;                                             //*** Get status1 <A/V>
-  ++pStr;                                                             // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->Status2 = *pStr;                                             //*** Get status2 <A/V>
-  ++pStr;                                                             // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get magnitude of XTE ---
-  pData->MagnitudeXTE = (int32_t)__NMEA0183_StringToInt(&pStr, 0, 4); //*** Get magnitude of XTE (cross-track-error) <m.m[m][m][m]> (divide by 10^4 to get the real magnitude of XTE)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->DirectionSteer = *pStr;                                      //*** Get direction to steer <L/R>
-  ++pStr;                                                             // Parsing: Skip <L/R>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->XTEunit = *pStr;                                             //*** Get XTE unit <N/K>
-  ++pStr;                                                             // Parsing: Skip <N/K>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Status ---
-  pData->ArrivalStatus = *pStr;                                       //*** Get status of arrival: 'A' = arrival circle entered ; 'V' = arrival circle not entered
-  ++pStr;                                                             // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->PassedWaypoint = *pStr;                                      //*** Get status of the passed waypoint: 'A' = arrival circle entered ; 'V' = arrival circle not entered
-  ++pStr;                                                             // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Bearing origin ---
-  pData->BearingOriginToDest = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get bearing origin to destination <b[.b][b]> (divide by 10^2 to get the real bearing origin to destination)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->BearingOtoDunit = *pStr;                                     //*** Get bearing origin to destination unit: 'M' = magnetic ; 'T' = true
-  ++pStr;                                                             // Parsing: Skip <M/T>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Waypoint ID ---
-  size_t TxtPos = 0;
-  while (TxtPos < (NMEA0183_APB_WAYPOINT_ID_MAX_SIZE - 1))
-  {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_FIELD_DELIMITER)) break;
-    pData->WaypointID[TxtPos] = *pStr;                               //*** Get char
-    ++TxtPos;
-    ++pStr;
-  }
-  pData->WaypointID[TxtPos] = '\0';
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Bearing current position ---
-  pData->BearingCurPosToDest = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get bearing present position to destination <c[.c][c]> (divide by 10^2 to get the real bearing origin to destination)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->BearingCPtoDunit = *pStr;                                   //*** Get bearing present position to destination unit: 'M' = magnetic ; 'T' = true
-  ++pStr;                                                            // Parsing: Skip <M/T>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Heading to steer ---
-  pData->HeadingToSteerToDest = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get heading-to-steer to destination waypoint <h[.h][h]> (divide by 10^2 to get the real bearing origin to destination)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->H2StoDunit = *pStr;                                         //*** Get heading-to-steer to destination waypoint unit: 'M' = magnetic ; 'T' = true
-  ++pStr;                                                            // Parsing: Skip <M/T>
-
-  if (*pStr == NMEA0183_FIELD_DELIMITER)
-  {
-    //--- Get FAA mode (if available) ---
-    ++pStr;                                                          // Parsing: Skip ','
-    pData->FAAmode = *pStr;                                          //*** Get FAA mode <A/D/E/M/S/N>
-    ++pStr;                                                          // Parsing: Skip <A/D/E/M/S/N>
-  }
-  else pData->FAAmode = ' ';                                         //*** Set FAA mode not specified
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+uint32_t NMEA0183_ParseFieldHex(char** ppStr)
+{
+  return __NMEA0183_HexStringToUint(ppStr, NMEA0183_FIELD_DELIMITER);
 }
-#endif
-
 
 
-#ifdef NMEA0183_DECODE_BEC
 //=============================================================================
-// [STATIC] Process the BEC (Bearing and distance to waypoint - dead reckoning) sentence
+// Parse a time field
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessBEC(const char* pSentence, NMEA0183_BECdata* pData)
-{ // Format: $--BEC,<hhmmss.zzz>,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<BearingTrue:t[.t][t]>,T,<BearingMag:m[.m][m]>,M,<Distance:sss.ss[s][s]>,N,<WaypointID>*<CheckSum>
-  char* pStr = (char*)pSentence;
-
+void NMEA0183_ParseFieldTime(char** ppStr, NMEA0183_Time* pData)
+{
   //--- Get Time ---
-  if (__NMEA0183_ExtractTime(&pStr, &pData->Time) == false) return ERR__PARSE_ERROR; //*** Get time
-
-  //--- Get Latitude and Longitude ---
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->WaypointLat ) == false) return ERR__PARSE_ERROR; //*** Get latitude
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->WaypointLong) == false) return ERR__PARSE_ERROR; //*** Get longitude
-
-  //--- Get Bearing True ---
-  pData->BearingTrue     = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get bearing True <t[.t][t]> (divide by 10^2 to get the real bearing True)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'T') return ERR__PARSE_ERROR;                              // Parsing: Should be 'T'
-  ++pStr;                                                                 // Parsing: Skip 'T'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Bearing Magntic ---
-  pData->BearingMagnetic = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get bearing Magntic <m[.m][m]> (divide by 10^2 to get the real bearing Magntic)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                              // Parsing: Should be 'M'
-  ++pStr;                                                                 // Parsing: Skip 'M'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Distance ---
-  pData->Distance        = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4); //*** Get distance <sss.ss[s][s]> (divide by 10^4 to get the real distance)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'N') return ERR__PARSE_ERROR;                              // Parsing: Should be 'N'
-  ++pStr;                                                                 // Parsing: Skip 'N'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Waypoint ID ---
-  size_t TxtPos = 0;
-  while (TxtPos < (NMEA0183_BEC_WAYPOINT_ID_MAX_SIZE - 1))
+  pData->Hour   = (uint8_t)__NMEA0183_StringToInt(ppStr, 2, 0);    //*** Get and save hour <hh>
+  pData->Minute = (uint8_t)__NMEA0183_StringToInt(ppStr, 2, 0);    //*** Get and save minute <mm>
+  pData->Second = (uint8_t)__NMEA0183_StringToInt(ppStr, 2, 0);    //*** Get and save second <ss>
+  //--- Get milliseconds ---
+  if (**ppStr == '.')                                              // If the next char is '.' then there is a millisecond value to get
   {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-    pData->WaypointID[TxtPos] = *pStr;                               //*** Get char
-    ++TxtPos;
-    ++pStr;
-  }
-  pData->WaypointID[TxtPos] = '\0';
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+    pData->MilliS = (uint16_t)__NMEA0183_StringToInt(ppStr, 0, 3); //*** Get and save milliseconds <zzz>
+  } else pData->MilliS = (uint16_t)NMEA0183_NO_VALUE;              // else set no value
 }
-#endif
-
 
 
-#ifdef NMEA0183_DECODE_BOD
 //=============================================================================
-// [STATIC] Process the BOD (Bearing - Origin to Destination) sentence
+// Parse a date field
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessBOD(const char* pSentence, NMEA0183_BODdata* pData)
-{ // Format: $--BOD,<BearingTrue:t[.t][t]>,T,<BearingMag:m[.m][m]>,M,<DestWaypointID>,<OriginWaypointID>*<CheckSum>
-  char* pStr = (char*)pSentence;
-
-  //--- Get Bearing True ---
-  pData->BearingTrue = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);     //*** Get bearing True <t[.t][t]> (divide by 10^2 to get the real bearing True)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'T') return ERR__PARSE_ERROR;                              // Parsing: Should be 'T'
-  ++pStr;                                                                 // Parsing: Skip 'T'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Bearing Magntic ---
-  pData->BearingMagnetic = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get bearing Magntic <m[.m][m]> (divide by 10^2 to get the real bearing Magntic)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                              // Parsing: Should be 'M'
-  ++pStr;                                                                 // Parsing: Skip 'M'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Destination Waypoint ID ---
+void NMEA0183_ParseFieldDate(char** ppStr, NMEA0183_Date* pData)
+{
+  pData->Day   =  (uint8_t)__NMEA0183_StringToInt(ppStr, 2, 0);    //*** Get and save day <dd>
+  pData->Month =  (uint8_t)__NMEA0183_StringToInt(ppStr, 2, 0);    //*** Get and save month <mm>
+  pData->Year  = (uint16_t)__NMEA0183_StringToInt(ppStr, 2, 0);    //*** Get and save year <yy>
+}
+
+
+//=============================================================================
+// Parse a coordinate and its direction fields
+//=============================================================================
+bool NMEA0183_ParseFieldCoordinate(char** ppStr, NMEA0183_Coordinate* pData)
+{
+  __NMEA0183_ExtractCoordinateValue(ppStr, pData);                 //*** Get degree and minute <(d)ddmm.mmmm[m][m][m]>
+  if (**ppStr != NMEA0183_FIELD_DELIMITER) return false;           // Parsing: Should be a ','
+  ++(*ppStr);                                                      // Parsing: Skip ','
+  pData->Direction = __NMEA0183_ExtractChar(ppStr);                //*** Get coordinate direction <N/S or E/W>, ' ' if no direction
+  return true;
+}
+
+
+//=============================================================================
+// Parse a text field with escaped chars
+//=============================================================================
+bool NMEA0183_ParseFieldEscapedText(char** ppStr, char* pText, size_t size)
+{
   size_t TxtPos = 0;
-  while (TxtPos < (NMEA0183_BOD_WAYPOINT_ID_MAX_SIZE - 1))
+  while (TxtPos < (size - 1))
   {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_FIELD_DELIMITER) || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-    pData->DestWaypointID[TxtPos] = *pStr;                           //*** Get char
+    if ((**ppStr == '\0') || (**ppStr == NMEA0183_CHECKSUM_DELIMITER)) break;
+    if (**ppStr != NMEA0183_CHAR_HEX_DELIMITER)
+    {
+      pText[TxtPos] = **ppStr;                                     //*** Get char
+      ++(*ppStr);
+    }
+    else                                                           // '^' detected
+    {
+      ++(*ppStr);
+      if ((**ppStr == '\0') || (**ppStr == NMEA0183_CHECKSUM_DELIMITER))
+      { pText[TxtPos] = '\0'; return false; }
+      pText[TxtPos] = (char)__NMEA0183_HexStringToUint(ppStr, 2); //*** Get hex encoded char (2 hex chars to decode)
+    }
     ++TxtPos;
-    ++pStr;
   }
-  pData->DestWaypointID[TxtPos] = '\0';
+  pText[TxtPos] = '\0';
+  return true;
+}
 
-  //--- Get Origin Waypoint ID ---
-  TxtPos = 0;
-  if (*pStr == NMEA0183_FIELD_DELIMITER)
+
+//=============================================================================
+// Get the fields present in a sentence
+//=============================================================================
+uint32_t NMEA0183_GetPresentFields(const char* pSentence)
+{
+  uint32_t PresentFields = 0;
+  uint32_t FieldBit = 1u;
+  const char* pStr = pSentence;
+  while (true)
   {
-    ++pStr;
-    while (TxtPos < (NMEA0183_BOD_WAYPOINT_ID_MAX_SIZE - 1))
+    if ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER) && (*pStr != '\0'))
     {
-      if ((*pStr == '\0') || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-      pData->OriginWaypointID[TxtPos] = *pStr;                       //*** Get char
-      ++TxtPos;
-      ++pStr;
+      PresentFields |= FieldBit;                                   // The field is not empty
+      do { ++pStr; } while ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER) && (*pStr != '\0')); // Go to the end of the field
     }
+    if (*pStr != NMEA0183_FIELD_DELIMITER) break;                  // Last field
+    ++pStr;                                                        // Parsing: Skip ','
+    if (FieldBit != 0x80000000u) FieldBit <<= 1;                   // The fields 31 and more share the bit 31
   }
-  pData->OriginWaypointID[TxtPos] = '\0';
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+  return PresentFields;
 }
-#endif
 
 
+//=============================================================================
+// [STATIC] Extract a char field
+//=============================================================================
+char __NMEA0183_ExtractChar(char** pStr)
+{
+  const char Value = **pStr;
+  if ((Value == NMEA0183_FIELD_DELIMITER) || (Value == NMEA0183_CHECKSUM_DELIMITER) || (Value == '\0')) return ' '; // Empty field
+  ++(*pStr);                                            // Parsing: Skip the char
+  return Value;
+}
+
 
-#ifdef NMEA0183_DECODE_BWW
 //=============================================================================
-// [STATIC] Process the BWW (Bearing - Waypoint to Waypoint) sentence
+// [STATIC] Extract a unit field
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessBWW(const char* pSentence, NMEA0183_BWWdata* pData)
-{ // Format: $--BWW,<BearingTrue:t[.t][t]>,T,<BearingMag:m[.m][m]>,M,<DestWaypointID>,<OriginWaypointID>*<CheckSum>
-  char* pStr = (char*)pSentence;
+bool __NMEA0183_ExtractUnit(char** pStr, char unit)
+{
+  if (**pStr != unit) return false;                     // Parsing: Should be the unit
+  ++(*pStr);                                            // Parsing: Skip the unit
+  return true;
+}
 
-  //--- Get Bearing True ---
-  pData->BearingTrue = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);     //*** Get bearing True <t[.t][t]> (divide by 10^2 to get the real bearing True)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'T') return ERR__PARSE_ERROR;                              // Parsing: Should be 'T'
-  ++pStr;                                                                 // Parsing: Skip 'T'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Bearing Magntic ---
-  pData->BearingMagnetic = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get bearing Magntic <m[.m][m]> (divide by 10^2 to get the real bearing Magntic)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                              // Parsing: Should be 'M'
-  ++pStr;                                                                 // Parsing: Skip 'M'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Destination Waypoint ID ---
-  size_t TxtPos = 0;
-  while (TxtPos < (NMEA0183_BWW_WAYPOINT_ID_MAX_SIZE - 1))
+
+//=============================================================================
+// [STATIC] Extract the value field of a coordinate
+//=============================================================================
+void __NMEA0183_ExtractCoordinateValue(char** pStr, NMEA0183_Coordinate* pData)
+{
+  if ((**pStr == NMEA0183_FIELD_DELIMITER) || (**pStr == NMEA0183_CHECKSUM_DELIMITER) || (**pStr == '\0')) // No value found?
   {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_FIELD_DELIMITER) || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-    pData->FromWaypointID[TxtPos] = *pStr;                           //*** Get char
-    ++TxtPos;
-    ++pStr;
+    pData->Degree = (uint8_t)NMEA0183_NO_VALUE;
+    pData->Minute = (uint32_t)NMEA0183_NO_VALUE;
+    return;
   }
-  pData->FromWaypointID[TxtPos] = '\0';
-  NMEA0183_CHECK_FIELD_DELIMITER;
+  const int32_t Value = __NMEA0183_StringToInt(pStr, '.', 0);     //*** Get degree and minute <(d)ddmm>
+  //--- Get Degree ---
+  pData->Degree = (uint8_t)(Value / 100);                         //    And save degree
+  //--- Get Minute ---
+  pData->Minute = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 7);   //*** Get and save decimal minute <.mmmm[m][m][m]> (divide by 10^7 to get the real minute)
+  pData->Minute += ((Value % 100) * 10000000);                    //    And save minute with decimal minute
+}
+
 
-  //--- Get Origin Waypoint ID ---
-  TxtPos = 0;
-  while (TxtPos < (NMEA0183_BWW_WAYPOINT_ID_MAX_SIZE - 1))
+#ifdef NMEA0183_STRING_VIEWS
+//=============================================================================
+// [STATIC] Extract a string view
+//=============================================================================
+void __NMEA0183_ExtractStringView(char** pStr, NMEA0183_StringView* pView, bool lastField)
+{
+  const char* pStart = *pStr;
+  while (((size_t)(*pStr - pStart) < 0xFFu) && (**pStr != '\0') && (**pStr != NMEA0183_CHECKSUM_DELIMITER))
+  {
+    if ((lastField == false) && (**pStr == NMEA0183_FIELD_DELIMITER)) break;
+    ++(*pStr);
+  }
+  pView->pChars = pStart;                  //*** Get the first char of the field
+  pView->Size   = (uint8_t)(*pStr - pStart); //*** Get the count of chars of the field
+}
+#else
+//=============================================================================
+// [STATIC] Extract a text
+//=============================================================================
+void __NMEA0183_ExtractText(char** pStr, char* pText, size_t size, bool lastField)
+{
+  size_t TxtPos = 0;
+  while (TxtPos < (size - 1))
   {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-    pData->ToWaypointID[TxtPos] = *pStr;                             //*** Get char
+    if ((**pStr == '\0') || (**pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
+    if ((lastField == false) && (**pStr == NMEA0183_FIELD_DELIMITER)) break;
+    pText[TxtPos] = **pStr;                  //*** Get char
     ++TxtPos;
-    ++pStr;
+    ++(*pStr);
   }
-  pData->ToWaypointID[TxtPos] = '\0';
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+  pText[TxtPos] = '\0';
 }
 #endif
 
 
-
-#if defined(NMEA0183_DECODE_DBK) || defined(NMEA0183_DECODE_DBS) || defined(NMEA0183_DECODE_DBT)
 //=============================================================================
-// [STATIC] Process the DBK (Depth Below Keel), DBS (Depth Below Surface), or DBT (Depth Below Tranducer) sentence
+// Copy the chars of a string view to a string
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessDBx(const char* pSentence, NMEA0183_DBxdata* pData)
-{ // Format: $--DBx,<DepthFeet:d[.d][d][d]>,f,<DepthMeter:m[.m][m][m]>,M,<DepthMeter:f[.f][f][f]>,F*<CheckSum>
-  char* pStr = (char*)pSentence;
-
-  //--- Get Depth ---
-  pData->DepthFeet = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 3);   //*** Get and save depth <d[.d][d][d]> (divide by 10^3 to get the real depth)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'f') return ERR__PARSE_ERROR;                          // Parsing: Should be 'f'
-  ++pStr;
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->DepthMeter = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 3);  //*** Get and save depth <m[.m][m][m]> (divide by 10^3 to get the real depth)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                          // Parsing: Should be 'M'
-  ++pStr;
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->DepthFathom = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 3); //*** Get and save depth <f[.f][f][f]> (divide by 10^3 to get the real depth)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'F') return ERR__PARSE_ERROR;                          // Parsing: Should be 'F'
-  ++pStr;
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;  // Should be a '*'
+eERRORRESULT NMEA0183_StringViewToString(const NMEA0183_StringView* pView, char* pString, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pView == NULL) || (pString == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  if (size == 0) return ERR__BUFFER_FULL;
+  char* pStr = (char*)pView->pChars;
+  const char* pEnd = pView->pChars + pView->Size;
+  size_t TxtPos = 0;
+  while (pStr < pEnd)
+  {
+    if (TxtPos >= (size - 1)) { pString[TxtPos] = '\0'; return ERR__BUFFER_FULL; }
+    if (*pStr != NMEA0183_CHAR_HEX_DELIMITER)
+    {
+      pString[TxtPos] = *pStr; //*** Get char
+      ++pStr;
+    }
+    else                       // '^' detected
+    {
+      ++pStr;
+      const char* pHex = pStr;
+      if ((pEnd - pStr) < 2) { pString[TxtPos] = '\0'; return ERR__PARSE_ERROR; }
+      pString[TxtPos] = (char)__NMEA0183_HexStringToUint(&pStr, 2); //*** Get hex encoded char (2 hex chars to decode)
+      if (pStr != (pHex + 2)) { pString[TxtPos] = '\0'; return ERR__PARSE_ERROR; }
+    }
+    ++TxtPos;
+  }
+  pString[TxtPos] = '\0';
   return ERR_OK;
 }
-#endif
 
+//-----------------------------------------------------------------------------
 
 
-#ifdef NMEA0183_DECODE_DPT
+
+
+
+//**********************************************************************************************************************************************************
 //=============================================================================
-// [STATIC] Process the DPT (Depth) sentence
+// [STATIC] Parse the fields of a sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessDPT(const char* pSentence, NMEA0183_DPTdata* pData)
-{ // Format: $--DPT,<WaterDepth:m[.m][m][m]>,<OffsetTrans:(-)o[.o][o]>,<RangeScale:r[.r][r]>*<CheckSum>
+eERRORRESULT __NMEA0183_ParseFields(const NMEA0183_SentenceFields* pFields, const NMEA0183_FieldsCursor* pCursor, void* pData, uint32_t* pPresentFields)
+{
+  const char* const pSentence = pCursor->pSentence;                       // The parse errors are given from the first field
   char* pStr = (char*)pSentence;
 
-  //--- Get Water Depth ---
-  pData->DepthMeter = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 3);   //*** Get and save water depth <m[.m][m][m]> (divide by 10^3 to get the real depth)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Offset from Transducer ---
-  if ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER))
+  //--- Select the format of the sentence ---
+  if ((pFields->pShortFormat != NULL) && (pCursor->FieldPosCount < pFields->MinFields)) // Not enough fields in the field index? Count them
   {
-    pData->OffsetTrans = (int16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get and save offset from transducer <(-)o[.o][o]> (divide by 10^2 to get the real offset)
+    size_t FieldCount = 1;
+    for (const char* pChar = pSentence; (*pChar != NMEA0183_CHECKSUM_DELIMITER) && (*pChar != '\0'); ++pChar)
+      if (*pChar == NMEA0183_FIELD_DELIMITER) ++FieldCount;
+    if (FieldCount < pFields->MinFields) pFields = pFields->pShortFormat; // Older format of the sentence
   }
-  else pData->OffsetTrans = 0;                                         // If no offset, in this case, the depth offset will always be zero (see NMEA-0183-Information-sheet-issue-4-1-1)
-  if (*pStr == NMEA0183_FIELD_DELIMITER) ++pStr;                       // Parsing: Skip ','
 
-  if ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER))
+  //--- Parse each field ---
+  const uint32_t FieldsToParse = pCursor->FieldsToParse | pFields->DependentFields;
+  if (pPresentFields != NULL) *pPresentFields &= ~FieldsToParse;
+  size_t Field = 0;
+  while (true)
   {
-    //--- Get Maximum range scale in use (if available) ---
-    pData->RangeScale = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save maximum range scale in use <r[.r][r]>
+    const uint32_t FieldBit = NMEA0183_FIELD_BIT(Field);
+    if ((FieldsToParse & FieldBit) != 0)
+    {
+      const char* const pField = pStr;
+      if (pFields->fnParseField(&pStr, Field, pData) == false) return NMEA0183_FIELD_ERROR; //*** Get the field
+      if ((pPresentFields != NULL) && (pStr != pField)) *pPresentFields |= FieldBit;  // The parser stopped on the delimiter, the field is not empty if it moved
+    }
+    else
+    {
+      if ((FieldsToParse & ~(FieldBit - 1u)) == 0) return ERR_OK;       // No field to parse after this one? The fields left keep their data
+      if ((Field + 1) < pCursor->FieldPosCount) pStr = (char*)&pCursor->pFrame[pCursor->pFieldPos[Field + 1]]; // Skip the field: jump to the ',' that ends it with the field index
+      else while ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER) && (*pStr != '\0')) ++pStr; // Skip the field
+    }
+    if (pCursor->pChecksum != NULL) __NMEA0183_AddToChecksum(pCursor->pChecksum, pStr); // The chars of the field just parsed are added to the checksum of the line while they are in the cache
+    if (*pStr == NMEA0183_CHECKSUM_DELIMITER) break;                      // Last field of the sentence
+    if ((*pStr != NMEA0183_FIELD_DELIMITER) || ((Field + 1) >= pFields->MaxFields)) return NMEA0183_FIELD_ERROR; // Should be a ',' and the sentence shall not have more fields
+    ++Field;
+    if (Field < pCursor->FieldPosCount) pStr = (char*)&pCursor->pFrame[pCursor->pFieldPos[Field] + 1]; // Jump to the next field with the field index
+    else ++pStr;                                                          // Parsing: Skip ','
   }
-  else pData->RangeScale = NMEA0183_NO_VALUE;
 
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;   // Should be a '*'
+  //--- Missing optional fields ---
+  if ((Field + 1) < pFields->MinFields) return NMEA0183_FIELD_ERROR;      // Should be a ',', the sentence has not enough fields
+  for (++Field; Field < pFields->MaxFields; ++Field)
+  {
+    if ((FieldsToParse & NMEA0183_FIELD_BIT(Field)) == 0) continue;
+    char* pMissing = pStr;                                                // The parser is on the '*' and sets the default value of the field
+    if (pFields->fnParseField(&pMissing, Field, pData) == false) return NMEA0183_FIELD_ERROR;
+  }
   return ERR_OK;
 }
-#endif
 
 
+//=============================================================================
+// [STATIC] Parse the fields of a sentence without field index
+//=============================================================================
+eERRORRESULT __NMEA0183_ParseSentence(const NMEA0183_SentenceFields* pFields, const char* pSentence, void* pData)
+{
+  const NMEA0183_FieldsCursor Cursor = NMEA0183_FIELDS_CURSOR(pSentence, pSentence, NULL, 0);
+  return __NMEA0183_ParseFields(pFields, &Cursor, pData, NULL);
+}
+
 
-#ifdef NMEA0183_DECODE_FSI
 //=============================================================================
-// [STATIC] Process the FSI (Frequency Set Information) sentence
+// [STATIC] Add the chars of a line to the checksum computed while its fields are parsed
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessFSI(const char* pSentence, NMEA0183_FSIdata* pData)
-{ // Format: $--FSI,<TxFreq:tttttt>,<RxFreq:rrrrrr>,<Mode:d/e/m/o/q/s/t/w/x/{/|>,<PowerLevel:0/1..9>*<CheckSum>
-  char* pStr = (char*)pSentence;
+void __NMEA0183_AddToChecksum(NMEA0183_LineChecksum* pChecksum, const char* pEnd)
+{
+  uint8_t CRC = pChecksum->CalcCRC;
+  for (const char* pChar = pChecksum->pNext; pChar < pEnd; ++pChar) CRC ^= (uint8_t)*pChar;
+  pChecksum->CalcCRC = CRC;
+  pChecksum->pNext   = pEnd;
+}
 
-  //--- Get Tx Frequency ---
-  pData->TxFrequency = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 3); //*** Get and save transmitting frequency <tttttt>
-  NMEA0183_CHECK_FIELD_DELIMITER;
+//-----------------------------------------------------------------------------
 
-  //--- Get Rx Frequency ---
-  pData->RxFrequency = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 3); //*** Get and save receiving frequency <rrrrrr>
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Mode of Operation ---
-  pData->Mode = *pStr;                                                //*** Get mode of Operation
-  ++pStr;                                                             // Parsing: Skip <d/e/m/o/q/s/t/w/x/{/|>
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Power Level ---
-  pData->PowerLevel = *pStr;                                          //*** Get power level: '0' = Standby ; '1' = Lowest ; ... ; '9' = Highest
-  ++pStr;                                                             // Parsing: Skip <0/1..9>
 
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;  // Should be a '*'
-  return ERR_OK;
-}
-#endif
 
 
 
-#ifdef NMEA0183_DECODE_GGA
+
+
+
+//**********************************************************************************************************************************************************
+#ifdef NMEA0183_DECODE_AAM
 //=============================================================================
-// [STATIC] Process the GGA (Global positioning system fixed data) sentence
+// [STATIC] Parse a field of the AAM (Waypoint Arrival Alarm) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessGGA(const char* pSentence, NMEA0183_GGAdata* pData)
-{ // Format: $--GGA,<hhmmss.zzz>,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<GPSquality:0/1/2/3/4/5/6/7/8>,<SatUsed:ss>,<HDOP:h.h(h)>,<Altitude:(-)aaa.a[a]>,M,<GeoidSep:(-)gg.g[g]>,M,<AgeDiff:cc.c[c]>,<DiffRef:rrrr>*<CheckSum>
-  char* pStr = (char*)pSentence;
+static bool __NMEA0183_ParseAAMfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--AAM,<Entered:A/V>,<Waypoint:A/V>,<Circle:r.rr[r][r]>,N,<WaypointID>*<CheckSum>
+  NMEA0183_AAMdata* pData = (NMEA0183_AAMdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Status ---
+    case 0: pData->ArrivalStatus  = __NMEA0183_ExtractChar(pStr); break;        //*** Get status of arrival: 'A' = arrival circle entered ; 'V' = arrival circle not entered
+    case 1: pData->PassedWaypoint = __NMEA0183_ExtractChar(pStr); break;        //*** Get status of the passed waypoint: 'A' = arrival circle entered ; 'V' = arrival circle not entered
 
-  //--- Get Time ---
-  if (__NMEA0183_ExtractTime(&pStr, &pData->Time) == false) return ERR__PARSE_ERROR; //*** Get time
+    //--- Get Arrival circle radius ---
+    case 2: pData->CircleRadius = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break; //*** Get and save Arrival circle radius <Circle:r.rr[r][r]> (divide by 10^4 to get the circle radius in nautical miles)
+    case 3: return __NMEA0183_ExtractUnit(pStr, 'N');                           // Parsing: Should be 'N'
 
-  //--- Get Latitude and Longitude ---
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->Latitude ) == false) return ERR__PARSE_ERROR; //*** Get latitude
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->Longitude) == false) return ERR__PARSE_ERROR; //*** Get longitude
+    //--- Get Waypoint ID ---
+    case 4: NMEA0183_EXTRACT_TEXT(pStr, pData->WaypointID, NMEA0183_AAM_WAYPOINT_ID_MAX_SIZE, true); break; //*** Get the Waypoint ID
+    default: return false;
+  }
+  return true;
+}
 
-  //--- Get GPS Quality Indicator ---
-  pData->GPSquality = *pStr;                                            //*** Get GPS quality indicator <0/1/2/3/4/5/6/7/8>
-  ++pStr;                                                               // Parsing: Skip <0/1/2/3/4/5/6/7/8>
-  NMEA0183_CHECK_FIELD_DELIMITER;
+static const NMEA0183_SentenceFields __NMEA0183_AAMfields = { __NMEA0183_ParseAAMfield, 5, 5, NULL, 0 }; //!< Fields of the AAM sentence
 
-  //--- Get Satellite Used ---
-  pData->SatellitesUsed = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save satellite used <ss>
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get HDOP ---
-  pData->HDOP = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);          //*** Get and save HDOP <h.h(h)> (divide by 100 to get the real HDOP)
-  NMEA0183_CHECK_FIELD_DELIMITER;
+//=============================================================================
+// Process the AAM (Waypoint Arrival Alarm) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessAAM(const char* pSentence, NMEA0183_AAMdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_AAMfields, pSentence, pData);
+}
+#endif
 
-  //--- Get Altitude ---
-  pData->Altitude = __NMEA0183_StringToInt(&pStr, 0, 2);                //*** Get and save altitude <(-)aaa.a[a]> (divide by 10^2 to get the real altitude)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                            // Parsing: Should be 'M'
-  ++pStr;                                                               // Parsing: Skip 'M'
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Geoid Separation ---
-  pData->GeoidSeparation = __NMEA0183_StringToInt(&pStr, 0, 2);         //*** Get and save geoid separation <(-)gg.g[g]> (divide by 10^2 to get the real geoid separation)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                            // Parsing: Should be 'M'
-  ++pStr;                                                               // Parsing: Skip 'M'
 
-  if (*pStr == NMEA0183_FIELD_DELIMITER)
+#ifdef NMEA0183_DECODE_ALM
+//=============================================================================
+// [STATIC] Parse a field of the ALM (GPS Almanac Data) sentence
+//=============================================================================
+static bool __NMEA0183_ParseALMfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--ALM,<Total:t>,<Curr:c>,<SatPRN:ss>,<WeekNum:[w][w][w]w>,<SV:vv>,<e:eeee>,<toa:yy>,<Sigma_i:iiii>,<OMEGADOT:dddd>,<rootA:rrrrrr>,<OMEGA:oooooo>,<OMEGA0:aaaaaa>,<Mo:mmmmmm>,<af0:aaa>,<af1:bbb>*<CheckSum>
+  NMEA0183_ALMdata* pData = (NMEA0183_ALMdata*)pSentenceData;
+  uint32_t Value;
+  switch (field)
   {
-    //--- Get Age of differential GPS data (if available) ---
-    ++pStr;                                                             // Parsing: Skip ','
-    pData->AgeOfDiffCorr = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get age of differential GPS data <cc.c[c]> (divide by 10^2 to get the real age of differential GPS data)
-
-    if (*pStr == NMEA0183_FIELD_DELIMITER)
-    {
-      //--- Get Differential reference station ID (if available) ---
-      ++pStr;                                                           // Parsing: Skip ','
-      pData->DiffRefStationID = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save differential reference station ID <rrrr>
-    }
-    else pData->DiffRefStationID = (uint16_t)NMEA0183_NO_VALUE;         //*** Set age of differential GPS data not specified
+    //--- Get message informations ---
+    case  0: pData->TotalSentence      =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save total sentence <t>
+    case  1: pData->SentenceNumber     =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save sequence number <c>
+    case  2: pData->SatellitePRNnumber =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save satellite PRN number <ss>
+    case  3: pData->GPSweekNumber      = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save GPS week number <[w][w][w]w>
+
+    //--- Get data ---
+    case  4: pData->SV_NAVhealth = (uint8_t)__NMEA0183_HexStringToUint(pStr, ','); break;    //*** Get and save NAV+SV health <vv>
+    case  5: pData->e        = (uint16_t)__NMEA0183_HexStringToUint(pStr, ','); break;       //*** Get and save inclination eccentricity <eeee>
+    case  6: pData->toa      =  (uint8_t)__NMEA0183_HexStringToUint(pStr, ','); break;       //*** Get and save almanac reference time in seconds <yy>
+    case  7: pData->Sigma_i  =  (int16_t)__NMEA0183_HexStringToUint(pStr, ','); break;       //*** Get and save inclination angle <iiii>
+    case  8: pData->OMEGADOT =  (int16_t)__NMEA0183_HexStringToUint(pStr, ','); break;       //*** Get and save rate of right ascension <dddd>
+    case  9: pData->Root_A   = (uint32_t)__NMEA0183_HexStringToUint(pStr, ','); break;       //*** Get and save root of semi-major axis <rrrrrr>
+    case 10:
+      Value = (uint32_t)__NMEA0183_HexStringToUint(pStr, ',');                               //*** Get 24-bit signed longitude of ascension node <oooooo>
+      pData->OMEGA = NMEA0183_DATA_EXTRACT_TO_SIGNED(int32_t, Value, 0, 24);                 //*** Save 32-bit signed longitude of ascension node <oooooo>
+      break;
+    case 11:
+      Value = (uint32_t)__NMEA0183_HexStringToUint(pStr, ',');                               //*** Get 24-bit signed argument of perigee <aaaaaa>
+      pData->OMEGA_0 = NMEA0183_DATA_EXTRACT_TO_SIGNED(int32_t, Value, 0, 24);               //*** Save 32-bit signed argument of perigee <aaaaaa>
+      break;
+    case 12:
+      Value = (uint32_t)__NMEA0183_HexStringToUint(pStr, ',');                               //*** Get 24-bit signed mean anomaly <mmmmmm>
+      pData->Mo = NMEA0183_DATA_EXTRACT_TO_SIGNED(int32_t, Value, 0, 24);                    //*** Save 32-bit signed mean anomaly <mmmmmm>
+      break;
+    case 13:
+      Value = (uint32_t)__NMEA0183_HexStringToUint(pStr, ',');                               //*** Get 11-bit clock parameter <aaa>
+      pData->af0 = NMEA0183_DATA_EXTRACT_TO_SIGNED(int16_t, Value, 0, 11);                   //*** Save 16-bit clock parameter <aaa>
+      break;
+    case 14:
+      Value = (uint32_t)__NMEA0183_HexStringToUint(pStr, ',');                               //*** Get 11-bit clock parameter <bbb>
+      pData->af1 = NMEA0183_DATA_EXTRACT_TO_SIGNED(int16_t, Value, 0, 11);                   //*** Save 16-bit clock parameter <bbb>
+      break;
+    default: return false;
   }
-  else pData->AgeOfDiffCorr = (uint16_t)NMEA0183_NO_VALUE;              //*** Set age of differential GPS data not specified
+  return true;
+}
 
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;    // Should be a '*'
-  return ERR_OK;
+static const NMEA0183_SentenceFields __NMEA0183_ALMfields = { __NMEA0183_ParseALMfield, 15, 15, NULL, 0 }; //!< Fields of the ALM sentence
+
+
+//=============================================================================
+// Process the ALM (GPS Almanac Data) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessALM(const char* pSentence, NMEA0183_ALMdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_ALMfields, pSentence, pData);
 }
 #endif
 
 
 
-#ifdef NMEA0183_DECODE_GLL
+#ifdef NMEA0183_DECODE_APB
 //=============================================================================
-// [STATIC] Process the GLL (Geographic Position - Latitude/Longitude) sentence
+// [STATIC] Parse a field of the APB (Heading/Track Controller (Autopilot) Sentence "B") sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessGLL(const char* pSentence, NMEA0183_GLLdata* pData)
-{ // Format: $--GLL,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<hhmmss.zzz>,<Status:A/V>,<FAA:A/D/E/M/S/N>*<CheckSum>
-  char* pStr = (char*)pSentence;
+static bool __NMEA0183_ParseAPBfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--APB,<Status:A/V>,<Status:A/V>,<Magnitude:m.m[m][m][m]>,<L/R>,<N/K>,<A/V>,<A/V>,<BOtoD:b[.b][b]>,<M/T>,<WaypointID>,<BCPtoD:c[.c][c]>,<M/T>,<H2StoD:h[.h][h]>,<M/T>,<FAA:A/D/E/M/S/N>*<CheckSum>
+  NMEA0183_APBdata* pData = (NMEA0183_APBdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Status ---
+    case  0: pData->Status1 = __NMEA0183_ExtractChar(pStr); break;                          //*** Get status1 <A/V>
+    case  1: pData->Status2 = __NMEA0183_ExtractChar(pStr); break;                          //*** Get status2 <A/V>
 
-  //--- Get Latitude and Longitude ---
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->Latitude ) == false) return ERR__PARSE_ERROR; //*** Get latitude
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->Longitude) == false) return ERR__PARSE_ERROR; //*** Get longitude
+    //--- Get magnitude of XTE ---
+    case  2: pData->MagnitudeXTE = (int32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;      //*** Get magnitude of XTE (cross-track-error) <m.m[m][m][m]> (divide by 10^4 to get the real magnitude of XTE)
+    case  3: pData->DirectionSteer = __NMEA0183_ExtractChar(pStr); break;                   //*** Get direction to steer <L/R>
+    case  4: pData->XTEunit = __NMEA0183_ExtractChar(pStr); break;                          //*** Get XTE unit <N/K>
 
-  //--- Get Time ---
-  if (__NMEA0183_ExtractTime(&pStr, &pData->Time) == false) return ERR__PARSE_ERROR; //*** Get time
+    //--- Get Status ---
+    case  5: pData->ArrivalStatus  = __NMEA0183_ExtractChar(pStr); break;                   //*** Get status of arrival: 'A' = arrival circle entered ; 'V' = arrival circle not entered
+    case  6: pData->PassedWaypoint = __NMEA0183_ExtractChar(pStr); break;                   //*** Get status of the passed waypoint: 'A' = arrival circle entered ; 'V' = arrival circle not entered
 
-  //--- Get Status ---
-  pData->Status = *pStr;                                             //*** Get status: A=Active=Good ; V=Void=NotGood
-  ++pStr;                                                            // Parsing: Skip <A/V>
+    //--- Get Bearing origin ---
+    case  7: pData->BearingOriginToDest = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break; //*** Get bearing origin to destination <b[.b][b]> (divide by 10^2 to get the real bearing origin to destination)
+    case  8: pData->BearingOtoDunit = __NMEA0183_ExtractChar(pStr); break;                  //*** Get bearing origin to destination unit: 'M' = magnetic ; 'T' = true
+
+    //--- Get Waypoint ID ---
+    case  9: NMEA0183_EXTRACT_TEXT(pStr, pData->WaypointID, NMEA0183_APB_WAYPOINT_ID_MAX_SIZE, false); break; //*** Get the Waypoint ID
+
+    //--- Get Bearing current position ---
+    case 10: pData->BearingCurPosToDest = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break; //*** Get bearing present position to destination <c[.c][c]> (divide by 10^2 to get the real bearing origin to destination)
+    case 11: pData->BearingCPtoDunit = __NMEA0183_ExtractChar(pStr); break;                 //*** Get bearing present position to destination unit: 'M' = magnetic ; 'T' = true
+
+    //--- Get Heading to steer ---
+    case 12: pData->HeadingToSteerToDest = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break; //*** Get heading-to-steer to destination waypoint <h[.h][h]> (divide by 10^2 to get the real bearing origin to destination)
+    case 13: pData->H2StoDunit = __NMEA0183_ExtractChar(pStr); break;                       //*** Get heading-to-steer to destination waypoint unit: 'M' = magnetic ; 'T' = true
 
-  if (*pStr == NMEA0183_FIELD_DELIMITER)
-  {
     //--- Get FAA mode (if available) ---
-    ++pStr;                                                          // Parsing: Skip ','
-    pData->FAAmode = *pStr;                                          //*** Get FAA mode <A/D/E/M/S/N>
-    ++pStr;                                                          // Parsing: Skip <A/D/E/M/S/N>
+    case 14: pData->FAAmode = __NMEA0183_ExtractChar(pStr); break;                          //*** Get FAA mode <A/D/E/M/S/N>, ' ' if not specified
+    default: return false;
   }
-  else pData->FAAmode = ' ';                                         //*** Set FAA mode not specified
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+  return true;
 }
-#endif
 
+static const NMEA0183_SentenceFields __NMEA0183_APBfields = { __NMEA0183_ParseAPBfield, 14, 15, NULL, 0 }; //!< Fields of the APB sentence
 
 
-#ifdef NMEA0183_DECODE_GSA
 //=============================================================================
-// [STATIC] Process the GSA (GNSS DOP and Active Satellites) sentence
+// Process the APB (Heading/Track Controller (Autopilot) Sentence "B") sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessGSA(const char* pSentence, NMEA0183_GSAdata* pData)
-{ // Format: $--GSA,<Mode1:A/M>,<Mode2:1/2/3>,[<Sat1:xx>],[<Sat2:xx>],[<Sat3:xx>],[<Sat4:xx>],[<Sat5:xx>],[<Sat6:xx>],[<Sat7:xx>],[<Sat8:xx>],[<Sat9:xx>],[<Sat10:xx>],[<Sat11:xx>],[<Sat12:xx>],<PDOP:p.p>,<HDOP:h.h>,<VDOP:v.v>*<CheckSum>
-  char* pStr = (char*)pSentence;
+eERRORRESULT NMEA0183_ProcessAPB(const char* pSentence, NMEA0183_APBdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_APBfields, pSentence, pData);
+}
+#endif
 
-  //--- Get Mode 1 ---
-  pData->Mode1 = *pStr;                                              //*** Get mode <A/M>
-  ++pStr;                                                            // Parsing: Skip <A/M>
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Mode 2 ---
-  pData->Mode2 = *pStr;                                              //*** Get mode <1/2/3>
-  ++pStr;                                                            // Parsing: Skip <1/2/3>
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Satellite IDs ---
-  for (size_t zSat = 0; zSat < NMEA0183_SATELLITE_ID_COUNT; ++zSat)
+#ifdef NMEA0183_DECODE_BEC
+//=============================================================================
+// [STATIC] Parse a field of the BEC (Bearing and distance to waypoint - dead reckoning) sentence
+//=============================================================================
+static bool __NMEA0183_ParseBECfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--BEC,<hhmmss.zzz>,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<BearingTrue:t[.t][t]>,T,<BearingMag:m[.m][m]>,M,<Distance:sss.ss[s][s]>,N,<WaypointID>*<CheckSum>
+  NMEA0183_BECdata* pData = (NMEA0183_BECdata*)pSentenceData;
+  switch (field)
   {
-    //--- Get Satellite ID ---
-    pData->SatelliteIDs[zSat] = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save satellite ID <xx>
-    NMEA0183_CHECK_FIELD_DELIMITER;
+    //--- Get Time ---
+    case  0: NMEA0183_ParseFieldTime(pStr, &pData->Time); break;                            //*** Get time
+
+    //--- Get Latitude and Longitude ---
+    case  1: __NMEA0183_ExtractCoordinateValue(pStr, &pData->WaypointLat); break;           //*** Get latitude
+    case  2: pData->WaypointLat.Direction = __NMEA0183_ExtractChar(pStr); break;            //*** Get latitude direction <N/S>
+    case  3: __NMEA0183_ExtractCoordinateValue(pStr, &pData->WaypointLong); break;          //*** Get longitude
+    case  4: pData->WaypointLong.Direction = __NMEA0183_ExtractChar(pStr); break;           //*** Get longitude direction <E/W>
+
+    //--- Get Bearing True ---
+    case  5: pData->BearingTrue = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;      //*** Get bearing True <t[.t][t]> (divide by 10^2 to get the real bearing True)
+    case  6: return __NMEA0183_ExtractUnit(pStr, 'T');                                      // Parsing: Should be 'T'
+
+    //--- Get Bearing Magntic ---
+    case  7: pData->BearingMagnetic = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;  //*** Get bearing Magntic <m[.m][m]> (divide by 10^2 to get the real bearing Magntic)
+    case  8: return __NMEA0183_ExtractUnit(pStr, 'M');                                      // Parsing: Should be 'M'
+
+    //--- Get Distance ---
+    case  9: pData->Distance = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;         //*** Get distance <sss.ss[s][s]> (divide by 10^4 to get the real distance)
+    case 10: return __NMEA0183_ExtractUnit(pStr, 'N');                                      // Parsing: Should be 'N'
+
+    //--- Get Waypoint ID ---
+    case 11: NMEA0183_EXTRACT_TEXT(pStr, pData->WaypointID, NMEA0183_BEC_WAYPOINT_ID_MAX_SIZE, true); break; //*** Get the Waypoint ID
+    default: return false;
   }
+  return true;
+}
 
-  //--- Get DOPs ---
-  pData->PDOP = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);       //*** Get PDOP <p.p> (divide by 100 to get the real PDOP)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->HDOP = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);       //*** Get HDOP <h.h> (divide by 100 to get the real HDOP)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->VDOP = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);       //*** Get VDOP <v.v> (divide by 100 to get the real VDOP)
+static const NMEA0183_SentenceFields __NMEA0183_BECfields = { __NMEA0183_ParseBECfield, 12, 12, NULL, 0 }; //!< Fields of the BEC sentence
 
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+
+//=============================================================================
+// Process the BEC (Bearing and distance to waypoint - dead reckoning) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessBEC(const char* pSentence, NMEA0183_BECdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_BECfields, pSentence, pData);
 }
 #endif
 
 
 
-#ifdef NMEA0183_DECODE_GSV
+#ifdef NMEA0183_DECODE_BOD
 //=============================================================================
-// [STATIC] Process the GSV (GNSS Satellites in View) sentence
+// [STATIC] Parse a field of the BOD (Bearing - Origin to Destination) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessGSV(const char* pSentence, NMEA0183_GSVdata* pData)
-{ // Format: $--GSV,<Total:t>,<Curr:c>,<SatCount:ss>,<SV1:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>[,<SV2:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>][,<SV3:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>][,<SV4:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>],<Text>*<CheckSum>
-  char* pStr = (char*)pSentence;
-
-  //--- Get message informations ---
-  pData->TotalSentence  = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save total sentence <t>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->SentenceNumber = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save sequence number <c>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->TotalSatellite = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save total satellite <ss>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  size_t zSat = 0;
-  while (zSat < NMEA0183_SAT_VIEW_COUNT_PER_MESSAGES)
+static bool __NMEA0183_ParseBODfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--BOD,<BearingTrue:t[.t][t]>,T,<BearingMag:m[.m][m]>,M,<DestWaypointID>,<OriginWaypointID>*<CheckSum>
+  NMEA0183_BODdata* pData = (NMEA0183_BODdata*)pSentenceData;
+  switch (field)
   {
-    //--- Get Satellite informations ---
-    pData->SatView[zSat].SatelliteID =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save satellite ID <nn>
-    NMEA0183_CHECK_FIELD_DELIMITER;
-    pData->SatView[zSat].Elevation   =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save elevation <ee>
-    NMEA0183_CHECK_FIELD_DELIMITER;
-    pData->SatView[zSat].Azimuth     = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save azimuth <aaa>
-    NMEA0183_CHECK_FIELD_DELIMITER;
-    pData->SatView[zSat].SNR         =  (uint8_t)__NMEA0183_StringToInt(&pStr, 2, 0); //*** Get and save SNR <rr>
-    ++zSat;
-    if (*pStr == NMEA0183_CHECKSUM_DELIMITER) break;
-    NMEA0183_CHECK_FIELD_DELIMITER;
-  }
-  for (size_t z = zSat; z < NMEA0183_SAT_VIEW_COUNT_PER_MESSAGES; ++z)
-    memset(&pData->SatView[z], 0xFF, sizeof(NMEA0183_SatelliteView)); // Clear data of satellite in view not setted
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;  // Should be a '*'
-  return ERR_OK;
+    //--- Get Bearing True ---
+    case 0: pData->BearingTrue = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;       //*** Get bearing True <t[.t][t]> (divide by 10^2 to get the real bearing True)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'T');                                       // Parsing: Should be 'T'
+
+    //--- Get Bearing Magntic ---
+    case 2: pData->BearingMagnetic = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;   //*** Get bearing Magntic <m[.m][m]> (divide by 10^2 to get the real bearing Magntic)
+    case 3: return __NMEA0183_ExtractUnit(pStr, 'M');                                       // Parsing: Should be 'M'
+
+    //--- Get Waypoint IDs ---
+    case 4: NMEA0183_EXTRACT_TEXT(pStr, pData->DestWaypointID, NMEA0183_BOD_WAYPOINT_ID_MAX_SIZE, false); break;  //*** Get the Destination Waypoint ID
+    case 5: NMEA0183_EXTRACT_TEXT(pStr, pData->OriginWaypointID, NMEA0183_BOD_WAYPOINT_ID_MAX_SIZE, true); break; //*** Get the Origin Waypoint ID (if available)
+    default: return false;
+  }
+  return true;
 }
-#endif
 
+static const NMEA0183_SentenceFields __NMEA0183_BODfields = { __NMEA0183_ParseBODfield, 5, 6, NULL, 0 }; //!< Fields of the BOD sentence
 
 
-#ifdef NMEA0183_DECODE_HDG
 //=============================================================================
-// [STATIC] Process the HDG (Heading - Deviation and Variation) sentence
+// Process the BOD (Bearing - Origin to Destination) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessHDG(const char* pSentence, NMEA0183_HDGdata* pData)
-{ // Format: $--HDG,<Heading:hh.h[h]>,<MagDev:dd.d[d]>,<E/W>,<MagVar:vv.v[v]>,<E/W>*<CheckSum>
-  char* pStr = (char*)pSentence;
+eERRORRESULT NMEA0183_ProcessBOD(const char* pSentence, NMEA0183_BODdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_BODfields, pSentence, pData);
+}
+#endif
 
-  //--- Get Heading ---
-  pData->Heading = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 2);    //*** Get and save heading <hh.h[h]> (divide by 10^2 to get the real heading)
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Magnetic Deviation ---
-  pData->Deviation.Value = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get track <dd.d[d]> (divide by 10^2 to get the real magnetic deviation)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != NMEA0183_FIELD_DELIMITER)
-  {
-    pData->Deviation.Direction = *pStr;                              //*** Get magnetic deviation direction <E/W>
-    ++pStr;                                                          // Parsing: Skip <E/W>
-  }
-  else pData->Deviation.Direction = ' ';                             //*** Set magnetic deviation direction not specified
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Magnetic Variation ---
-  pData->Variation.Value = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get track <vv.v[v]> (divide by 10^2 to get the real magnetic variation)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != NMEA0183_FIELD_DELIMITER)
+#ifdef NMEA0183_DECODE_BWW
+//=============================================================================
+// [STATIC] Parse a field of the BWW (Bearing - Waypoint to Waypoint) sentence
+//=============================================================================
+static bool __NMEA0183_ParseBWWfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--BWW,<BearingTrue:t[.t][t]>,T,<BearingMag:m[.m][m]>,M,<DestWaypointID>,<OriginWaypointID>*<CheckSum>
+  NMEA0183_BWWdata* pData = (NMEA0183_BWWdata*)pSentenceData;
+  switch (field)
   {
-    pData->Variation.Direction = *pStr;                              //*** Get magnetic variation direction <E/W>
-    ++pStr;                                                          // Parsing: Skip <E/W>
+    //--- Get Bearing True ---
+    case 0: pData->BearingTrue = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;       //*** Get bearing True <t[.t][t]> (divide by 10^2 to get the real bearing True)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'T');                                       // Parsing: Should be 'T'
+
+    //--- Get Bearing Magntic ---
+    case 2: pData->BearingMagnetic = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;   //*** Get bearing Magntic <m[.m][m]> (divide by 10^2 to get the real bearing Magntic)
+    case 3: return __NMEA0183_ExtractUnit(pStr, 'M');                                       // Parsing: Should be 'M'
+
+    //--- Get Waypoint IDs ---
+    case 4: NMEA0183_EXTRACT_TEXT(pStr, pData->FromWaypointID, NMEA0183_BWW_WAYPOINT_ID_MAX_SIZE, false); break; //*** Get the FROM Waypoint ID
+    case 5: NMEA0183_EXTRACT_TEXT(pStr, pData->ToWaypointID, NMEA0183_BWW_WAYPOINT_ID_MAX_SIZE, true); break;    //*** Get the TO Waypoint ID
+    default: return false;
   }
-  else pData->Variation.Direction = ' ';                             //*** Set magnetic variation direction not specified
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+  return true;
 }
-#endif
 
+static const NMEA0183_SentenceFields __NMEA0183_BWWfields = { __NMEA0183_ParseBWWfield, 6, 6, NULL, 0 }; //!< Fields of the BWW sentence
 
 
-#ifdef NMEA0183_DECODE_HDM
 //=============================================================================
-// [STATIC] Process the HDM (Heading - Magnetic) sentence
+// Process the BWW (Bearing - Waypoint to Waypoint) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessHDM(const char* pSentence, NMEA0183_HDMdata* pData)
-{ // Format: $--HDM,<Heading:hh.h[h]>,M,<E/W>*<CheckSum>
-  char* pStr = (char*)pSentence;
-
-  //--- Get Heading ---
-  pData->Heading = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 2);    //*** Get and save heading <hh.h[h]> (divide by 10^2 to get the real heading)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                         // Parsing: Should be 'M'
-  ++pStr;
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+eERRORRESULT NMEA0183_ProcessBWW(const char* pSentence, NMEA0183_BWWdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_BWWfields, pSentence, pData);
 }
 #endif
 
 
 
-#ifdef NMEA0183_DECODE_HDT
+#if defined(NMEA0183_DECODE_DBK) || defined(NMEA0183_DECODE_DBS) || defined(NMEA0183_DECODE_DBT)
 //=============================================================================
-// [STATIC] Process the HDT (Heading - True) sentence
+// [STATIC] Parse a field of the DBK (Depth Below Keel), DBS (Depth Below Surface), or DBT (Depth Below Tranducer) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessHDT(const char* pSentence, NMEA0183_HDTdata* pData)
-{ // Format: $--HDT,<Heading:hh.h[h]>,T,<E/W>*<CheckSum>
-  char* pStr = (char*)pSentence;
+static bool __NMEA0183_ParseDBxfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--DBx,<DepthFeet:d[.d][d][d]>,f,<DepthMeter:m[.m][m][m]>,M,<DepthMeter:f[.f][f][f]>,F*<CheckSum>
+  NMEA0183_DBxdata* pData = (NMEA0183_DBxdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Depth ---
+    case 0: pData->DepthFeet   = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 3); break;       //*** Get and save depth <d[.d][d][d]> (divide by 10^3 to get the real depth)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'f');                                       // Parsing: Should be 'f'
+    case 2: pData->DepthMeter  = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 3); break;       //*** Get and save depth <m[.m][m][m]> (divide by 10^3 to get the real depth)
+    case 3: return __NMEA0183_ExtractUnit(pStr, 'M');                                       // Parsing: Should be 'M'
+    case 4: pData->DepthFathom = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 3); break;       //*** Get and save depth <f[.f][f][f]> (divide by 10^3 to get the real depth)
+    case 5: return __NMEA0183_ExtractUnit(pStr, 'F');                                       // Parsing: Should be 'F'
+    default: return false;
+  }
+  return true;
+}
 
-  //--- Get Heading ---
-  pData->Heading = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 2);    //*** Get and save heading <hh.h[h]> (divide by 10^2 to get the real heading)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'T') return ERR__PARSE_ERROR;                         // Parsing: Should be 'T'
-  ++pStr;
+static const NMEA0183_SentenceFields __NMEA0183_DBxfields = { __NMEA0183_ParseDBxfield, 6, 6, NULL, 0 }; //!< Fields of the DBK, DBS and DBT sentences
 
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+
+//=============================================================================
+// Process the DBK (Depth Below Keel), DBS (Depth Below Surface), or DBT (Depth Below Tranducer) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessDBx(const char* pSentence, NMEA0183_DBxdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_DBxfields, pSentence, pData);
 }
 #endif
 
 
 
-#ifdef NMEA0183_DECODE_MTW
+#ifdef NMEA0183_DECODE_DPT
 //=============================================================================
-// [STATIC] Process the MTW (Water Temperature) sentence
+// [STATIC] Parse a field of the DPT (Depth) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessMTW(const char* pSentence, NMEA0183_MTWdata* pData)
-{ // Format: $--MTW,<WaterTemp:t.t[t]>,C*<CheckSum>
-  char* pStr = (char*)pSentence;
+static bool __NMEA0183_ParseDPTfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--DPT,<WaterDepth:m[.m][m][m]>,<OffsetTrans:(-)o[.o][o]>,<RangeScale:r[.r][r]>*<CheckSum>
+  NMEA0183_DPTdata* pData = (NMEA0183_DPTdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Water Depth ---
+    case 0: pData->DepthMeter = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 3); break;       //*** Get and save water depth <m[.m][m][m]> (divide by 10^3 to get the real depth)
 
-  //--- Get Water Temperature ---
-  pData->WaterTemp = (int16_t)__NMEA0183_StringToInt(&pStr, 0, 2);   //*** Get and save water temperature <hh.h[h]> (divide by 10^2 to get the real temperature)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'C') return ERR__PARSE_ERROR;                         // Parsing: Should be 'C'
-  ++pStr;
+    //--- Get Offset from Transducer ---
+    case 1:
+      if ((**pStr != NMEA0183_FIELD_DELIMITER) && (**pStr != NMEA0183_CHECKSUM_DELIMITER))
+      {
+        pData->OffsetTrans = (int16_t)__NMEA0183_StringToInt(pStr, 0, 2);                  //*** Get and save offset from transducer <(-)o[.o][o]> (divide by 10^2 to get the real offset)
+      }
+      else pData->OffsetTrans = 0;                                                          // If no offset, in this case, the depth offset will always be zero (see NMEA-0183-Information-sheet-issue-4-1-1)
+      break;
 
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+    //--- Get Maximum range scale in use (if available) ---
+    case 2: pData->RangeScale = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 0); break;       //*** Get and save maximum range scale in use <r[.r][r]>, NMEA0183_NO_VALUE if not specified
+    default: return false;
+  }
+  return true;
 }
-#endif
 
+static const NMEA0183_SentenceFields __NMEA0183_DPTfields = { __NMEA0183_ParseDPTfield, 2, 3, NULL, 0 }; //!< Fields of the DPT sentence
 
 
-#ifdef NMEA0183_DECODE_MWV
 //=============================================================================
-// [STATIC] Process the MWV (Wind Speed and Angle) sentence
+// Process the DPT (Depth) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessMWV(const char* pSentence, NMEA0183_MWVdata* pData)
-{ // Format: $--MWV,<WindAngle:www[.w][w]>,<T/R>,<WindSpeed:ss[.s][s]>,<K/M/N/S>,<A/V>*<CheckSum>
-  char* pStr = (char*)pSentence;
-
-  //--- Get Wind Angle ---
-  pData->WindAngle = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);  //*** Get and save wind angle <www[.w][w]> (divide by 10^2 to get the real angle)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->Reference = *pStr;                                          //*** Get reference: 'R' = relative ; 'T' = true
-  ++pStr;                                                            // Parsing: Skip <R/T>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Wind Speed ---
-  pData->WindSpeed = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2);  //*** Get and save wind speed <ss[.s][s]> (divide by 10^2 to get the real angle)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->WindSpeedUnit = *pStr;                                      //*** Get wind speed unit: 'K' = Kilometres per hour ; 'M' = Meter per second ; 'N' = Knots ; 'S' = ?
-  ++pStr;                                                            // Parsing: Skip <K/M/N/S>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Status ---
-  pData->Status = *pStr;                                             //*** Get status: A=Active=Good ; V=Void=NotGood
-  ++pStr;                                                            // Parsing: Skip <A/V>
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
+eERRORRESULT NMEA0183_ProcessDPT(const char* pSentence, NMEA0183_DPTdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_DPTfields, pSentence, pData);
 }
 #endif
 
 
 
-#ifdef NMEA0183_DECODE_RMC
+#ifdef NMEA0183_DECODE_FSI
 //=============================================================================
-// [STATIC] Process the RMC (Recommended Minimum sentence C) sentence
+// [STATIC] Parse a field of the FSI (Frequency Set Information) sentence
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessRMC(const char* pSentence, NMEA0183_RMCdata* pData)
+static bool __NMEA0183_ParseFSIfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--FSI,<TxFreq:tttttt>,<RxFreq:rrrrrr>,<Mode:d/e/m/o/q/s/t/w/x/{/|>,<PowerLevel:0/1..9>*<CheckSum>
+  NMEA0183_FSIdata* pData = (NMEA0183_FSIdata*)pSentenceData;
+  switch (field)
+  {
+    case 0: pData->TxFrequency = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 3); break;      //*** Get and save transmitting frequency <tttttt>
+    case 1: pData->RxFrequency = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 3); break;      //*** Get and save receiving frequency <rrrrrr>
+    case 2: pData->Mode = __NMEA0183_ExtractChar(pStr); break;                              //*** Get mode of Operation <d/e/m/o/q/s/t/w/x/{/|>
+    case 3: pData->PowerLevel = __NMEA0183_ExtractChar(pStr); break;                        //*** Get power level: '0' = Standby ; '1' = Lowest ; ... ; '9' = Highest
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_FSIfields = { __NMEA0183_ParseFSIfield, 4, 4, NULL, 0 }; //!< Fields of the FSI sentence
+
+
+//=============================================================================
+// Process the FSI (Frequency Set Information) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessFSI(const char* pSentence, NMEA0183_FSIdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_FSIfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_GGA
+//=============================================================================
+// [STATIC] Parse a field of the GGA (Global positioning system fixed data) sentence
+//=============================================================================
+static bool __NMEA0183_ParseGGAfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--GGA,<hhmmss.zzz>,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<GPSquality:0/1/2/3/4/5/6/7/8>,<SatUsed:ss>,<HDOP:h.h(h)>,<Altitude:(-)aaa.a[a]>,M,<GeoidSep:(-)gg.g[g]>,M,<AgeDiff:cc.c[c]>,<DiffRef:rrrr>*<CheckSum>
+  NMEA0183_GGAdata* pData = (NMEA0183_GGAdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Time ---
+    case  0: NMEA0183_ParseFieldTime(pStr, &pData->Time); break;                            //*** Get time
+
+    //--- Get Latitude and Longitude ---
+    case  1: __NMEA0183_ExtractCoordinateValue(pStr, &pData->Latitude); break;              //*** Get latitude
+    case  2: pData->Latitude.Direction = __NMEA0183_ExtractChar(pStr); break;               //*** Get latitude direction <N/S>
+    case  3: __NMEA0183_ExtractCoordinateValue(pStr, &pData->Longitude); break;             //*** Get longitude
+    case  4: pData->Longitude.Direction = __NMEA0183_ExtractChar(pStr); break;              //*** Get longitude direction <E/W>
+
+    //--- Get GPS Quality Indicator ---
+    case  5: pData->GPSquality = __NMEA0183_ExtractChar(pStr); break;                       //*** Get GPS quality indicator <0/1/2/3/4/5/6/7/8>
+
+    //--- Get Satellite Used ---
+    case  6: pData->SatellitesUsed = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;    //*** Get and save satellite used <ss>
+
+    //--- Get HDOP ---
+    case  7: pData->HDOP = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;             //*** Get and save HDOP <h.h(h)> (divide by 100 to get the real HDOP)
+
+    //--- Get Altitude ---
+    case  8: pData->Altitude = __NMEA0183_StringToInt(pStr, 0, 2); break;                   //*** Get and save altitude <(-)aaa.a[a]> (divide by 10^2 to get the real altitude)
+    case  9: return __NMEA0183_ExtractUnit(pStr, 'M');                                      // Parsing: Should be 'M'
+
+    //--- Get Geoid Separation ---
+    case 10: pData->GeoidSeparation = __NMEA0183_StringToInt(pStr, 0, 2); break;            //*** Get and save geoid separation <(-)gg.g[g]> (divide by 10^2 to get the real geoid separation)
+    case 11: return __NMEA0183_ExtractUnit(pStr, 'M');                                      // Parsing: Should be 'M'
+
+    //--- Get Differential GPS data (if available) ---
+    case 12: pData->AgeOfDiffCorr = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;    //*** Get age of differential GPS data <cc.c[c]> (divide by 10^2 to get the real age of differential GPS data), NMEA0183_NO_VALUE if not specified
+    case 13: pData->DiffRefStationID = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save differential reference station ID <rrrr>, NMEA0183_NO_VALUE if not specified
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_GGAfields = { __NMEA0183_ParseGGAfield, 12, 14, NULL, 0 }; //!< Fields of the GGA sentence
+
+
+//=============================================================================
+// Process the GGA (Global positioning system fixed data) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessGGA(const char* pSentence, NMEA0183_GGAdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_GGAfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_GLL
+//=============================================================================
+// [STATIC] Parse a field of the GLL (Geographic Position - Latitude/Longitude) sentence
+//=============================================================================
+static bool __NMEA0183_ParseGLLfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--GLL,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<hhmmss.zzz>,<Status:A/V>,<FAA:A/D/E/M/S/N>*<CheckSum>
+  NMEA0183_GLLdata* pData = (NMEA0183_GLLdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Latitude and Longitude ---
+    case 0: __NMEA0183_ExtractCoordinateValue(pStr, &pData->Latitude); break;               //*** Get latitude
+    case 1: pData->Latitude.Direction = __NMEA0183_ExtractChar(pStr); break;                //*** Get latitude direction <N/S>
+    case 2: __NMEA0183_ExtractCoordinateValue(pStr, &pData->Longitude); break;              //*** Get longitude
+    case 3: pData->Longitude.Direction = __NMEA0183_ExtractChar(pStr); break;               //*** Get longitude direction <E/W>
+
+    //--- Get Time ---
+    case 4: NMEA0183_ParseFieldTime(pStr, &pData->Time); break;                             //*** Get time
+
+    //--- Get Status ---
+    case 5: pData->Status = __NMEA0183_ExtractChar(pStr); break;                            //*** Get status: A=Active=Good ; V=Void=NotGood
+
+    //--- Get FAA mode (if available) ---
+    case 6: pData->FAAmode = __NMEA0183_ExtractChar(pStr); break;                           //*** Get FAA mode <A/D/E/M/S/N>, ' ' if not specified
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_GLLfields = { __NMEA0183_ParseGLLfield, 6, 7, NULL, 0 }; //!< Fields of the GLL sentence
+
+
+//=============================================================================
+// Process the GLL (Geographic Position - Latitude/Longitude) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessGLL(const char* pSentence, NMEA0183_GLLdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_GLLfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_GSA
+//=============================================================================
+// [STATIC] Parse a field of the GSA (GNSS DOP and Active Satellites) sentence
+//=============================================================================
+static bool __NMEA0183_ParseGSAfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--GSA,<Mode1:A/M>,<Mode2:1/2/3>,[<Sat1:xx>],[<Sat2:xx>],[<Sat3:xx>],[<Sat4:xx>],[<Sat5:xx>],[<Sat6:xx>],[<Sat7:xx>],[<Sat8:xx>],[<Sat9:xx>],[<Sat10:xx>],[<Sat11:xx>],[<Sat12:xx>],<PDOP:p.p>,<HDOP:h.h>,<VDOP:v.v>*<CheckSum>
+  NMEA0183_GSAdata* pData = (NMEA0183_GSAdata*)pSentenceData;
+  if ((field >= 2) && (field < (2 + NMEA0183_SATELLITE_ID_COUNT)))
+  {
+    //--- Get Satellite IDs ---
+    pData->SatelliteIDs[field - 2] = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0);         //*** Get and save satellite ID <xx>
+    return true;
+  }
+  switch (field)
+  {
+    //--- Get Modes ---
+    case 0: pData->Mode1 = __NMEA0183_ExtractChar(pStr); break;                             //*** Get mode <A/M>
+    case 1: pData->Mode2 = __NMEA0183_ExtractChar(pStr); break;                             //*** Get mode <1/2/3>
+
+    //--- Get DOPs ---
+    case (2 + NMEA0183_SATELLITE_ID_COUNT + 0): pData->PDOP = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break; //*** Get PDOP <p.p> (divide by 100 to get the real PDOP)
+    case (2 + NMEA0183_SATELLITE_ID_COUNT + 1): pData->HDOP = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break; //*** Get HDOP <h.h> (divide by 100 to get the real HDOP)
+    case (2 + NMEA0183_SATELLITE_ID_COUNT + 2): pData->VDOP = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break; //*** Get VDOP <v.v> (divide by 100 to get the real VDOP)
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_GSAfields = { __NMEA0183_ParseGSAfield, (2 + NMEA0183_SATELLITE_ID_COUNT + 3), (2 + NMEA0183_SATELLITE_ID_COUNT + 3), NULL, 0 }; //!< Fields of the GSA sentence
+
+
+//=============================================================================
+// Process the GSA (GNSS DOP and Active Satellites) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessGSA(const char* pSentence, NMEA0183_GSAdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_GSAfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_GSV
+//=============================================================================
+// [STATIC] Parse a field of the GSV (GNSS Satellites in View) sentence
+//=============================================================================
+static bool __NMEA0183_ParseGSVfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--GSV,<Total:t>,<Curr:c>,<SatCount:ss>,<SV1:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>[,<SV2:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>][,<SV3:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>][,<SV4:<SatNum:nn>,<Elev:ee>,<Azim:aaa>,<SNR:rr>>],<Text>*<CheckSum>
+  NMEA0183_GSVdata* pData = (NMEA0183_GSVdata*)pSentenceData;
+  if (field >= 3)
+  {
+    //--- Get Satellite informations ---
+    const size_t zSat = (field - 3) / 4;
+    if (zSat >= NMEA0183_SAT_VIEW_COUNT_PER_MESSAGES) return false;
+    NMEA0183_SatelliteView* pSatView = &pData->SatView[zSat];                               // The fields of the satellites in view not sent are set to 0xFF (NMEA0183_NO_VALUE)
+    switch ((field - 3) % 4)
+    {
+      case 0: pSatView->SatelliteID =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save satellite ID <nn>
+      case 1: pSatView->Elevation   =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save elevation <ee>
+      case 2: pSatView->Azimuth     = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 0); break; //*** Get and save azimuth <aaa>
+      default: pSatView->SNR        =  (uint8_t)__NMEA0183_StringToInt(pStr, 2, 0); break; //*** Get and save SNR <rr>
+    }
+    return true;
+  }
+  switch (field)
+  {
+    //--- Get message informations ---
+    case 0: pData->TotalSentence  = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;    //*** Get and save total sentence <t>
+    case 1: pData->SentenceNumber = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;    //*** Get and save sequence number <c>
+    case 2: pData->TotalSatellite = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;    //*** Get and save total satellite <ss>
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_GSVfields = { __NMEA0183_ParseGSVfield, (3 + 4), (3 + (4 * NMEA0183_SAT_VIEW_COUNT_PER_MESSAGES)), NULL, 0 }; //!< Fields of the GSV sentence
+
+
+//=============================================================================
+// Process the GSV (GNSS Satellites in View) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessGSV(const char* pSentence, NMEA0183_GSVdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_GSVfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_HDG
+//=============================================================================
+// [STATIC] Parse a field of the HDG (Heading - Deviation and Variation) sentence
+//=============================================================================
+static bool __NMEA0183_ParseHDGfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--HDG,<Heading:hh.h[h]>,<MagDev:dd.d[d]>,<E/W>,<MagVar:vv.v[v]>,<E/W>*<CheckSum>
+  NMEA0183_HDGdata* pData = (NMEA0183_HDGdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Heading ---
+    case 0: pData->Heading = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 2); break;          //*** Get and save heading <hh.h[h]> (divide by 10^2 to get the real heading)
+
+    //--- Get Magnetic Deviation ---
+    case 1: pData->Deviation.Value = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;  //*** Get track <dd.d[d]> (divide by 10^2 to get the real magnetic deviation)
+    case 2: pData->Deviation.Direction = __NMEA0183_ExtractChar(pStr); break;              //*** Get magnetic deviation direction <E/W>, ' ' if not specified
+
+    //--- Get Magnetic Variation ---
+    case 3: pData->Variation.Value = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;  //*** Get track <vv.v[v]> (divide by 10^2 to get the real magnetic variation)
+    case 4: pData->Variation.Direction = __NMEA0183_ExtractChar(pStr); break;              //*** Get magnetic variation direction <E/W>, ' ' if not specified
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_HDGfields = { __NMEA0183_ParseHDGfield, 5, 5, NULL, 0 }; //!< Fields of the HDG sentence
+
+
+//=============================================================================
+// Process the HDG (Heading - Deviation and Variation) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessHDG(const char* pSentence, NMEA0183_HDGdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_HDGfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_HDM
+//=============================================================================
+// [STATIC] Parse a field of the HDM (Heading - Magnetic) sentence
+//=============================================================================
+static bool __NMEA0183_ParseHDMfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--HDM,<Heading:hh.h[h]>,M,<E/W>*<CheckSum>
+  NMEA0183_HDMdata* pData = (NMEA0183_HDMdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Heading ---
+    case 0: pData->Heading = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 2); break;          //*** Get and save heading <hh.h[h]> (divide by 10^2 to get the real heading)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'M');                                       // Parsing: Should be 'M'
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_HDMfields = { __NMEA0183_ParseHDMfield, 2, 2, NULL, 0 }; //!< Fields of the HDM sentence
+
+
+//=============================================================================
+// Process the HDM (Heading - Magnetic) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessHDM(const char* pSentence, NMEA0183_HDMdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_HDMfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_HDT
+//=============================================================================
+// [STATIC] Parse a field of the HDT (Heading - True) sentence
+//=============================================================================
+static bool __NMEA0183_ParseHDTfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--HDT,<Heading:hh.h[h]>,T,<E/W>*<CheckSum>
+  NMEA0183_HDTdata* pData = (NMEA0183_HDTdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Heading ---
+    case 0: pData->Heading = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 2); break;          //*** Get and save heading <hh.h[h]> (divide by 10^2 to get the real heading)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'T');                                       // Parsing: Should be 'T'
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_HDTfields = { __NMEA0183_ParseHDTfield, 2, 2, NULL, 0 }; //!< Fields of the HDT sentence
+
+
+//=============================================================================
+// Process the HDT (Heading - True) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessHDT(const char* pSentence, NMEA0183_HDTdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_HDTfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_MTW
+//=============================================================================
+// [STATIC] Parse a field of the MTW (Water Temperature) sentence
+//=============================================================================
+static bool __NMEA0183_ParseMTWfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--MTW,<WaterTemp:t.t[t]>,C*<CheckSum>
+  NMEA0183_MTWdata* pData = (NMEA0183_MTWdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Water Temperature ---
+    case 0: pData->WaterTemp = (int16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;         //*** Get and save water temperature <hh.h[h]> (divide by 10^2 to get the real temperature)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'C');                                       // Parsing: Should be 'C'
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_MTWfields = { __NMEA0183_ParseMTWfield, 2, 2, NULL, 0 }; //!< Fields of the MTW sentence
+
+
+//=============================================================================
+// Process the MTW (Water Temperature) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessMTW(const char* pSentence, NMEA0183_MTWdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_MTWfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_MWV
+//=============================================================================
+// [STATIC] Parse a field of the MWV (Wind Speed and Angle) sentence
+//=============================================================================
+static bool __NMEA0183_ParseMWVfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--MWV,<WindAngle:www[.w][w]>,<T/R>,<WindSpeed:ss[.s][s]>,<K/M/N/S>,<A/V>*<CheckSum>
+  NMEA0183_MWVdata* pData = (NMEA0183_MWVdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Wind Angle ---
+    case 0: pData->WindAngle = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;        //*** Get and save wind angle <www[.w][w]> (divide by 10^2 to get the real angle)
+    case 1: pData->Reference = __NMEA0183_ExtractChar(pStr); break;                         //*** Get reference: 'R' = relative ; 'T' = true
+
+    //--- Get Wind Speed ---
+    case 2: pData->WindSpeed = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;        //*** Get and save wind speed <ss[.s][s]> (divide by 10^2 to get the real angle)
+    case 3: pData->WindSpeedUnit = __NMEA0183_ExtractChar(pStr); break;                     //*** Get wind speed unit: 'K' = Kilometres per hour ; 'M' = Meter per second ; 'N' = Knots ; 'S' = ?
+
+    //--- Get Status ---
+    case 4: pData->Status = __NMEA0183_ExtractChar(pStr); break;                            //*** Get status: A=Active=Good ; V=Void=NotGood
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_MWVfields = { __NMEA0183_ParseMWVfield, 5, 5, NULL, 0 }; //!< Fields of the MWV sentence
+
+
+//=============================================================================
+// Process the MWV (Wind Speed and Angle) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessMWV(const char* pSentence, NMEA0183_MWVdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_MWVfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_RMC
+//=============================================================================
+// [STATIC] Parse a field of the RMC (Recommended Minimum sentence C) sentence
+//=============================================================================
+static bool __NMEA0183_ParseRMCfield(char** pStr, size_t field, void* pSentenceData)
 { // Format: $--RMC,<hhmmss.zzz>,<Status:A/V>,<Latitude:ddmm.mmmm[m][m][m]>,<N/S>,<Longitude:dddmm.mmmm[m][m][m]>,<E/W>,<Speed:sss.ss[s][s]>,<Track:ttt.tt[t][t]>,<ddmmyy>,<MagVar:vv.v[v]>,<E/W>[,<FAA:A/D/E/M/S/N>][,<NavStatus:S/C/U/V>]*<CheckSum>
-  char* pStr = (char*)pSentence;
+  NMEA0183_RMCdata* pData = (NMEA0183_RMCdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Time ---
+    case  0: NMEA0183_ParseFieldTime(pStr, &pData->Time); break;                            //*** Get time
+
+    //--- Get Status ---
+    case  1: pData->Status = __NMEA0183_ExtractChar(pStr); break;                           //*** Get status: A=Active=Good ; V=Void=NotGood
+
+    //--- Get Latitude and Longitude ---
+    case  2: __NMEA0183_ExtractCoordinateValue(pStr, &pData->Latitude); break;              //*** Get latitude
+    case  3: pData->Latitude.Direction = __NMEA0183_ExtractChar(pStr); break;               //*** Get latitude direction <N/S>
+    case  4: __NMEA0183_ExtractCoordinateValue(pStr, &pData->Longitude); break;             //*** Get longitude
+    case  5: pData->Longitude.Direction = __NMEA0183_ExtractChar(pStr); break;              //*** Get longitude direction <E/W>
+
+    //--- Get Speed and Track ---
+    case  6: pData->Speed = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;            //*** Get speed <sss.ss[s][s]> (divide by 10^4 to get the real minute)
+    case  7: pData->Track = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;            //*** Get track <ttt.tt[t][t]> (divide by 10^4 to get the real track)
+
+    //--- Get Date ---
+    case  8:
+      pData->Date.Day   =  (uint8_t)__NMEA0183_StringToInt(pStr, 2, 0);                     //*** Get and save day <dd>
+      pData->Date.Month =  (uint8_t)__NMEA0183_StringToInt(pStr, 2, 0);                     //*** Get and save month <mm>
+      pData->Date.Year  = (uint16_t)__NMEA0183_StringToInt(pStr, 2, 0);                     //*** Get and save year <yy>
+      break;
+
+    //--- Get Magnetic Variation ---
+    case  9: pData->Variation.Value = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 2); break;  //*** Get track <vv.v[v]> (divide by 10^2 to get the real magnetic variation)
+    case 10: pData->Variation.Direction = __NMEA0183_ExtractChar(pStr); break;              //*** Get magnetic variation direction <E/W>, ' ' if not specified
+
+    //--- Get FAA mode and Navigation Status (if available) ---
+    case 11: pData->FAAmode = __NMEA0183_ExtractChar(pStr); break;                          //*** Get FAA mode <A/D/E/M/S/N>, ' ' if not specified
+    case 12: pData->NavigationStatus = __NMEA0183_ExtractChar(pStr); break;                 //*** Get Navigation Status <S/C/U/V>, ' ' if not specified
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_RMCfields = { __NMEA0183_ParseRMCfield, 11, 13, NULL, 0 }; //!< Fields of the RMC sentence
+
+
+//=============================================================================
+// Process the RMC (Recommended Minimum sentence C) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessRMC(const char* pSentence, NMEA0183_RMCdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_RMCfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_TXT
+//=============================================================================
+// [STATIC] Parse a field of the TXT (Text Transmission) sentence
+//=============================================================================
+static bool __NMEA0183_ParseTXTfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--TXT,<Total:tt>,<Curr:cc>,<TextID:ii>,<Text>,*<CheckSum>
+  NMEA0183_TXTdata* pData = (NMEA0183_TXTdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get message informations ---
+    case 0:
+#ifdef NMEA0183_STRING_VIEWS
+      pData->TextMessage.pChars = *pStr;                                                    // The text is empty until its field is parsed
+      pData->TextMessage.Size   = 0;
+#else
+      pData->TextMessage[0] = '\0';                                                         // The text is empty until its field is parsed
+#endif
+      pData->TotalSentence  = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0);                  //*** Get and save total sentence <tt>
+      break;
+    case 1: pData->SentenceNumber = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;    //*** Get and save sequence number <cc>
+    case 2: pData->TextIdentifier = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;    //*** Get and save text identifier <ii>
+
+    //--- Get text of the message ---
+    case 3:
+    {
+#ifdef NMEA0183_STRING_VIEWS
+      __NMEA0183_ExtractStringView(pStr, &pData->TextMessage, true);                       //*** Get view of the text, the code delimiters '^' are decoded by NMEA0183_StringViewToString()
+#else
+      return NMEA0183_ParseFieldEscapedText(pStr, &pData->TextMessage[0], sizeof(pData->TextMessage)); //*** Get the text, the '^hh' chars are decoded
+#endif
+      break;
+    }
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_TXTfields = { __NMEA0183_ParseTXTfield, 4, 4, NULL, NMEA0183_FIELD_BIT(3) }; //!< Fields of the TXT sentence, the text is cleared by the first field
+
+
+//=============================================================================
+// Process the TXT (Text Transmission) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessTXT(const char* pSentence, NMEA0183_TXTdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_TXTfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_VHW
+//=============================================================================
+// [STATIC] Parse a field of the VHW (Water Speed and Heading) sentence
+//=============================================================================
+static bool __NMEA0183_ParseVHWfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--VHW,<CourseTrue:t.t[t][t][t]>,T,<CourseMag:m.m[m][m][m]>,M,<SpeedKnots:k.k[k][k][k]>,N,<SpeedKmHr:h.h[h][h][h]>,K*<CheckSum>
+  NMEA0183_VHWdata* pData = (NMEA0183_VHWdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Heading ---
+    case 0: pData->HeadingTrue = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;      //*** Get heading in degrees True <ttt.t[t][t][t]> (divide by 10^4 to get the real track)
+    case 1: return __NMEA0183_ExtractUnit(pStr, 'T');                                       // Parsing: Should be 'T'
+    case 2: pData->HeadingMagnetic = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;  //*** Get heading in degrees Magnetic <mmm.m[m][m][m]> (divide by 10^4 to get the real track)
+    case 3: return __NMEA0183_ExtractUnit(pStr, 'M');                                       // Parsing: Should be 'M'
+
+    //--- Get Speed ---
+    case 4: pData->SpeedKnots = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;       //*** Get speed over the ground in knots <kkk.k[k][k][k]> (divide by 10^4 to get the real track)
+    case 5: return __NMEA0183_ExtractUnit(pStr, 'N');                                       // Parsing: Should be 'N'
+    case 6: pData->SpeedKmHr = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;        //*** Get speed over the ground in km/hr <hhh.h[h][h][h]> (divide by 10^4 to get the real track)
+    case 7: return __NMEA0183_ExtractUnit(pStr, 'K');                                       // Parsing: Should be 'K'
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_VHWfields = { __NMEA0183_ParseVHWfield, 8, 8, NULL, 0 }; //!< Fields of the VHW sentence
+
+
+//=============================================================================
+// Process the VHW (Water Speed and Heading) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessVHW(const char* pSentence, NMEA0183_VHWdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_VHWfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_VTG
+//=============================================================================
+// [STATIC] Parse a field of the older VTG (Course Over Ground and Ground Speed) sentence, without units
+//=============================================================================
+static bool __NMEA0183_ParseVTGshortField(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--VTG,<CourseTrue:t.t[t][t][t]>,<CourseMag:m.m[m][m][m]>,<SpeedKnots:k.k[k][k][k]>,<SpeedKmHr:h.h[h][h][h]>*<CheckSum>
+  NMEA0183_VTGdata* pData = (NMEA0183_VTGdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Course ---
+    case 0: pData->CourseTrue     = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get course over ground in degrees True <ttt.t[t][t][t]> (divide by 10^4 to get the real track)
+    case 1: pData->CourseMagnetic = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get course over ground in degrees Magnetic <mmm.m[m][m][m]> (divide by 10^4 to get the real track)
+
+    //--- Get Speed ---
+    case 2: pData->SpeedKnots     = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get speed over the ground in knots <kkk.k[k][k][k]> (divide by 10^4 to get the real track)
+    case 3:
+      pData->SpeedKmHr = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4);                      //*** Get speed over the ground in km/hr <hhh.h[h][h][h]> (divide by 10^4 to get the real track)
+      pData->FAAmode   = ' ';                                                               //*** Set FAA mode not specified
+      break;
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_VTGshortFields = { __NMEA0183_ParseVTGshortField, 4, 4, NULL, 0 }; //!< Fields of the older VTG sentence
+
+
+//=============================================================================
+// [STATIC] Parse a field of the VTG (Course Over Ground and Ground Speed) sentence
+//=============================================================================
+static bool __NMEA0183_ParseVTGfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--VTG,<CourseTrue:t.t[t][t][t]>,[T],<CourseMag:m.m[m][m][m]>,[M],<SpeedKnots:k.k[k][k][k]>,[N],<SpeedKmHr:h.h[h][h][h]>,[K][,<FAA:A/D/E/M/S/N>]*<CheckSum>
+  NMEA0183_VTGdata* pData = (NMEA0183_VTGdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Course ---
+    case 0: pData->CourseTrue     = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get course over ground in degrees True <ttt.t[t][t][t]> (divide by 10^4 to get the real track)
+    case 1: if (**pStr == 'T') ++(*pStr); break;                                            // Parsing: Can be 'T' or empty, skip 'T'
+    case 2: pData->CourseMagnetic = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get course over ground in degrees Magnetic <mmm.m[m][m][m]> (divide by 10^4 to get the real track)
+    case 3: if (**pStr == 'M') ++(*pStr); break;                                            // Parsing: Can be 'M' or empty, skip 'M'
+
+    //--- Get Speed ---
+    case 4: pData->SpeedKnots     = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get speed over the ground in knots <kkk.k[k][k][k]> (divide by 10^4 to get the real track)
+    case 5: if (**pStr == 'N') ++(*pStr); break;                                            // Parsing: Can be 'N' or empty, skip 'N'
+    case 6: pData->SpeedKmHr      = (uint32_t)__NMEA0183_StringToInt(pStr, 0, 4); break;   //*** Get speed over the ground in km/hr <hhh.h[h][h][h]> (divide by 10^4 to get the real track)
+    case 7: if (**pStr == 'K') ++(*pStr); break;                                            // Parsing: Can be 'K' or empty, skip 'K'
+
+    //--- Get FAA mode (if available) ---
+    case 8: pData->FAAmode = __NMEA0183_ExtractChar(pStr); break;                           //*** Get FAA mode <A/D/E/M/S/N>, ' ' if not specified
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_VTGfields = { __NMEA0183_ParseVTGfield, 8, 9, &__NMEA0183_VTGshortFields, 0 }; //!< Fields of the VTG sentence, or of the older VTG sentence if it has less than 8 fields
+
+
+//=============================================================================
+// Process the VTG (Course Over Ground and Ground Speed) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessVTG(const char* pSentence, NMEA0183_VTGdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_VTGfields, pSentence, pData);
+}
+#endif
+
+
+
+#ifdef NMEA0183_DECODE_ZDA
+//=============================================================================
+// [STATIC] Parse a field of the ZDA (Time & Date) sentence
+//=============================================================================
+static bool __NMEA0183_ParseZDAfield(char** pStr, size_t field, void* pSentenceData)
+{ // Format: $--ZDA,<hhmmss.zzz>,<Day:dd>,<Month:mm>,<Year:yyyy>,<LocalHour:(-)hh>,<LocalMinute:mm>*<CheckSum>
+  NMEA0183_ZDAdata* pData = (NMEA0183_ZDAdata*)pSentenceData;
+  switch (field)
+  {
+    //--- Get Time ---
+    case 0: NMEA0183_ParseFieldTime(pStr, &pData->Time); break;                             //*** Get time
+
+    //--- Get Date ---
+    case 1: pData->Date.Day   =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;       //*** Get and save day <dd>
+    case 2: pData->Date.Month =  (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;       //*** Get and save month <mm>
+    case 3: pData->Date.Year  = (uint16_t)__NMEA0183_StringToInt(pStr, 0, 0); break;       //*** Get and save year <yyyy>
+
+    //--- Get Local Zone Time ---
+    case 4: pData->LocalZoneHour = (int8_t)__NMEA0183_StringToInt(pStr, 0, 0); break;      //*** Get and save local zone hour <(-)hh>
+    case 5:
+    {
+      const char* pHour = *pStr - 1;                                                        // The ',' that ends the local zone hour field
+      pData->LocalZoneMinute = (uint8_t)__NMEA0183_StringToInt(pStr, 0, 0);                 //*** Get and save local zone minute <mm>
+      if (pData->LocalZoneHour == 0)
+      {
+        while (*(pHour - 1) != NMEA0183_FIELD_DELIMITER) --pHour;                           // Go back to the first char of the local zone hour field
+        if (*pHour == '-') pData->LocalZoneMinute = -pData->LocalZoneMinute;                // Set LocalZoneMinute negative in case of -00 of LocalZoneHour
+      }
+      break;
+    }
+    default: return false;
+  }
+  return true;
+}
+
+static const NMEA0183_SentenceFields __NMEA0183_ZDAfields = { __NMEA0183_ParseZDAfield, 6, 6, NULL, NMEA0183_FIELD_BIT(5) }; //!< Fields of the ZDA sentence, the local zone minutes read the sign of the local zone hours
+
+
+//=============================================================================
+// Process the ZDA (Time & Date) sentence
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessZDA(const char* pSentence, NMEA0183_ZDAdata* pData)
+{
+  return __NMEA0183_ParseSentence(&__NMEA0183_ZDAfields, pSentence, pData);
+}
+#endif
+
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+#ifdef NMEA0183_USE_INPUT_BUFFER
+//=============================================================================
+// Get decoder state
+//=============================================================================
+eNMEA0183_State NMEA0183_GetDecoderState(NMEA0183_DecodeInput* pDecoder)
+{
+#ifdef CHECK_NULL_PARAM
+    if (pDecoder == NULL) return false;
+#endif
+    return NMEA0183_DECODER_INPUT(pDecoder)->State;
+}
+
+
+//=============================================================================
+// Is a frame ready to process?
+//=============================================================================
+bool NMEA0183_IsFrameReadyToProcess(NMEA0183_DecodeInput* pDecoder)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pDecoder == NULL) return false;
+#endif
+  return NMEA0183_DECODER_INPUT(pDecoder)->State == NMEA0183_TO_PROCESS;
+}
+#endif
+
+
+//=============================================================================
+// Sentence decoders dispatch table
+//=============================================================================
+//! Sentence decoder function, call the parser of the sentence with the data of the sentence in the decoded data
+typedef eERRORRESULT (*NMEA0183_SentenceDecoder_Func)(const NMEA0183_FieldsCursor* pCursor, NMEA0183_DecodedData* pData);
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+//! Sentence dispatcher function, call the parser of the sentence with data on the stack then the handler of the sentence
+typedef eERRORRESULT (*NMEA0183_SentenceDispatcher_Func)(const NMEA0183_FieldsCursor* pCursor, const NMEA0183_SentenceHandler* pHandler);
+#endif
+
+#ifdef NMEA0183_COMPACT_OUTPUT
+//! Sentence compact decoder function, call the parser of the sentence with data on the stack then copy the data after the header of the compact record
+typedef eERRORRESULT (*NMEA0183_SentenceCompact_Func)(const NMEA0183_FieldsCursor* pCursor, NMEA0183_CompactHeader* pRecord, size_t size);
+#endif
+
+//! Sentence decoder of the dispatch table
+typedef struct NMEA0183_SentenceDecoder
+{
+  uint32_t SentenceID;                           //!< Sentence ID decoded by this decoder
+  NMEA0183_SentenceDecoder_Func fnDecode;        //!< Decoder of the sentence, NULL if the slot is not used
+#ifdef NMEA0183_SENTENCE_HANDLERS
+  NMEA0183_SentenceDispatcher_Func fnDispatch;   //!< Dispatcher of the sentence to its handler, NULL if the slot is not used
+#endif
+#ifdef NMEA0183_COMPACT_OUTPUT
+  NMEA0183_SentenceCompact_Func fnCompact;       //!< Compact decoder of the sentence, NULL if the slot is not used
+#endif
+} NMEA0183_SentenceDecoder;
+
+#ifdef NMEA0183_PRESENT_FIELDS
+#  define NMEA0183_PRESENT_FIELDS_OF(pPresentFields)            ( pPresentFields )                          // The bits of the fields are set by the parser
+#  define NMEA0183_SET_RECORD_PRESENT_FIELDS(pRecord, present)  ( (pRecord)->PresentFields = (present) )     // The compact header is packed, no pointer on its members
+#else
+#  define NMEA0183_PRESENT_FIELDS_OF(pPresentFields)            NULL
+#  define NMEA0183_SET_RECORD_PRESENT_FIELDS(pRecord, present)  ( (void)(present) )
+#endif
+#define NMEA0183_SENTENCE_DECODE(name, parser)  static eERRORRESULT __NMEA0183_Decode##name(const NMEA0183_FieldsCursor* pCursor, NMEA0183_DecodedData* pData) { return __NMEA0183_ParseFields(&__NMEA0183_##parser##fields, pCursor, &pData->name, NMEA0183_PRESENT_FIELDS_OF(&pData->PresentFields)); }
+#ifdef NMEA0183_SENTENCE_HANDLERS
+#  define NMEA0183_SENTENCE_DISPATCH(name, parser)  static eERRORRESULT __NMEA0183_Dispatch##name(const NMEA0183_FieldsCursor* pCursor, const NMEA0183_SentenceHandler* pHandler) \
+                                                    { NMEA0183_##parser##data Data; const eERRORRESULT Error = __NMEA0183_ParseFields(&__NMEA0183_##parser##fields, pCursor, &Data, NULL); if (Error == ERR_OK) pHandler->fnInvoke(pHandler, &Data); return Error; }
+#  define NMEA0183_DISPATCH_ENTRY(name)             , __NMEA0183_Dispatch##name
+#  define NMEA0183_NO_DISPATCH_ENTRY                , NULL
+#else
+#  define NMEA0183_SENTENCE_DISPATCH(name, parser)
+#  define NMEA0183_DISPATCH_ENTRY(name)
+#  define NMEA0183_NO_DISPATCH_ENTRY
+#endif
+#ifdef NMEA0183_COMPACT_OUTPUT
+#  define NMEA0183_SENTENCE_COMPACT(name, parser)   static eERRORRESULT __NMEA0183_Compact##name(const NMEA0183_FieldsCursor* pCursor, NMEA0183_CompactHeader* pRecord, size_t size) \
+                                                    { NMEA0183_##parser##data Data; uint32_t PresentFields = 0; if (size < NMEA0183_COMPACT_RECORD_SIZE(sizeof(Data))) return ERR__BUFFER_FULL; \
+                                                      const eERRORRESULT Error = __NMEA0183_ParseFields(&__NMEA0183_##parser##fields, pCursor, &Data, NMEA0183_PRESENT_FIELDS_OF(&PresentFields)); NMEA0183_SET_RECORD_PRESENT_FIELDS(pRecord, PresentFields); memcpy(NMEA0183_COMPACT_PAYLOAD(pRecord), &Data, sizeof(Data)); pRecord->PayloadSize = (uint8_t)sizeof(Data); return Error; }
+#  define NMEA0183_COMPACT_ENTRY(name)              , __NMEA0183_Compact##name
+#  define NMEA0183_NO_COMPACT_ENTRY                 , NULL
+#else
+#  define NMEA0183_SENTENCE_COMPACT(name, parser)
+#  define NMEA0183_COMPACT_ENTRY(name)
+#  define NMEA0183_NO_COMPACT_ENTRY
+#endif
+#define NMEA0183_SENTENCE_DECODER(name, parser)     NMEA0183_SENTENCE_DECODE(name, parser) NMEA0183_SENTENCE_DISPATCH(name, parser) NMEA0183_SENTENCE_COMPACT(name, parser)
+#define NMEA0183_SENTENCE_ENTRY(name)               { NMEA0183_##name, __NMEA0183_Decode##name NMEA0183_DISPATCH_ENTRY(name) NMEA0183_COMPACT_ENTRY(name) }
+#define NMEA0183_NO_SENTENCE_DECODER                { 0, NULL NMEA0183_NO_DISPATCH_ENTRY NMEA0183_NO_COMPACT_ENTRY }
+
+#ifdef NMEA0183_DECODE_AAM
+NMEA0183_SENTENCE_DECODER(AAM, AAM)
+#endif
+#ifdef NMEA0183_DECODE_ALM
+NMEA0183_SENTENCE_DECODER(ALM, ALM)
+#endif
+#ifdef NMEA0183_DECODE_APB
+NMEA0183_SENTENCE_DECODER(APB, APB)
+#endif
+#ifdef NMEA0183_DECODE_BEC
+NMEA0183_SENTENCE_DECODER(BEC, BEC)
+#endif
+#ifdef NMEA0183_DECODE_BOD
+NMEA0183_SENTENCE_DECODER(BOD, BOD)
+#endif
+#ifdef NMEA0183_DECODE_BWW
+NMEA0183_SENTENCE_DECODER(BWW, BWW)
+#endif
+#ifdef NMEA0183_DECODE_DBK
+NMEA0183_SENTENCE_DECODER(DBK, DBx)
+#endif
+#ifdef NMEA0183_DECODE_DBS
+NMEA0183_SENTENCE_DECODER(DBS, DBx)
+#endif
+#ifdef NMEA0183_DECODE_DBT
+NMEA0183_SENTENCE_DECODER(DBT, DBx)
+#endif
+#ifdef NMEA0183_DECODE_DPT
+NMEA0183_SENTENCE_DECODER(DPT, DPT)
+#endif
+#ifdef NMEA0183_DECODE_FSI
+NMEA0183_SENTENCE_DECODER(FSI, FSI)
+#endif
+#ifdef NMEA0183_DECODE_GGA
+NMEA0183_SENTENCE_DECODER(GGA, GGA)
+#endif
+#ifdef NMEA0183_DECODE_GLL
+NMEA0183_SENTENCE_DECODER(GLL, GLL)
+#endif
+#ifdef NMEA0183_DECODE_GSA
+NMEA0183_SENTENCE_DECODER(GSA, GSA)
+#endif
+#ifdef NMEA0183_DECODE_GSV
+NMEA0183_SENTENCE_DECODER(GSV, GSV)
+#endif
+#ifdef NMEA0183_DECODE_HDG
+NMEA0183_SENTENCE_DECODER(HDG, HDG)
+#endif
+#ifdef NMEA0183_DECODE_HDM
+NMEA0183_SENTENCE_DECODER(HDM, HDM)
+#endif
+#ifdef NMEA0183_DECODE_HDT
+NMEA0183_SENTENCE_DECODER(HDT, HDT)
+#endif
+#ifdef NMEA0183_DECODE_MTW
+NMEA0183_SENTENCE_DECODER(MTW, MTW)
+#endif
+#ifdef NMEA0183_DECODE_MWV
+NMEA0183_SENTENCE_DECODER(MWV, MWV)
+#endif
+#ifdef NMEA0183_DECODE_RMC
+NMEA0183_SENTENCE_DECODER(RMC, RMC)
+#endif
+#ifdef NMEA0183_DECODE_TXT
+NMEA0183_SENTENCE_DECODER(TXT, TXT)
+#endif
+#ifdef NMEA0183_DECODE_VHW
+NMEA0183_SENTENCE_DECODER(VHW, VHW)
+#endif
+#ifdef NMEA0183_DECODE_VTG
+NMEA0183_SENTENCE_DECODER(VTG, VTG)
+#endif
+#ifdef NMEA0183_DECODE_ZDA
+NMEA0183_SENTENCE_DECODER(ZDA, ZDA)
+#endif
+
+//! Sentence decoders sorted by NMEA0183_SENTENCE_HASH() of their sentence ID
+static const NMEA0183_SentenceDecoder __NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH_SLOTS] =
+{
+#ifdef NMEA0183_DECODE_FSI
+  NMEA0183_SENTENCE_ENTRY(FSI), // Slot 0
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_HDG
+  NMEA0183_SENTENCE_ENTRY(HDG), // Slot 1
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_BEC
+  NMEA0183_SENTENCE_ENTRY(BEC), // Slot 2
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 3
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 4
+#ifdef NMEA0183_DECODE_GGA
+  NMEA0183_SENTENCE_ENTRY(GGA), // Slot 5
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_ALM
+  NMEA0183_SENTENCE_ENTRY(ALM), // Slot 6
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_DBS
+  NMEA0183_SENTENCE_ENTRY(DBS), // Slot 7
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_AAM
+  NMEA0183_SENTENCE_ENTRY(AAM), // Slot 8
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_GSV
+  NMEA0183_SENTENCE_ENTRY(GSV), // Slot 9
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_APB
+  NMEA0183_SENTENCE_ENTRY(APB), // Slot 10
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_HDM
+  NMEA0183_SENTENCE_ENTRY(HDM), // Slot 11
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_RMC
+  NMEA0183_SENTENCE_ENTRY(RMC), // Slot 12
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_VHW
+  NMEA0183_SENTENCE_ENTRY(VHW), // Slot 13
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 14
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 15
+#ifdef NMEA0183_DECODE_VTG
+  NMEA0183_SENTENCE_ENTRY(VTG), // Slot 16
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_MWV
+  NMEA0183_SENTENCE_ENTRY(MWV), // Slot 17
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_BOD
+  NMEA0183_SENTENCE_ENTRY(BOD), // Slot 18
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_DPT
+  NMEA0183_SENTENCE_ENTRY(DPT), // Slot 19
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 20
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 21
+#ifdef NMEA0183_DECODE_GLL
+  NMEA0183_SENTENCE_ENTRY(GLL), // Slot 22
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_GSA
+  NMEA0183_SENTENCE_ENTRY(GSA), // Slot 23
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_BWW
+  NMEA0183_SENTENCE_ENTRY(BWW), // Slot 24
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_DBT
+  NMEA0183_SENTENCE_ENTRY(DBT), // Slot 25
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_DBK
+  NMEA0183_SENTENCE_ENTRY(DBK), // Slot 26
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_HDT
+  NMEA0183_SENTENCE_ENTRY(HDT), // Slot 27
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_MTW
+  NMEA0183_SENTENCE_ENTRY(MTW), // Slot 28
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_TXT
+  NMEA0183_SENTENCE_ENTRY(TXT), // Slot 29
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+#ifdef NMEA0183_DECODE_ZDA
+  NMEA0183_SENTENCE_ENTRY(ZDA), // Slot 30
+#else
+  NMEA0183_NO_SENTENCE_DECODER,
+#endif
+  NMEA0183_NO_SENTENCE_DECODER, // Slot 31 (others)
+};
+
+//! Check at compile time that a sentence is in the slot of the table given by its hash
+#define NMEA0183_CHECK_SENTENCE_SLOT(name, slot)  NMEA0183_STATIC_ASSERT(NMEA0183_SENTENCE_HASH(NMEA0183_##name) == (slot), "The " #name " decoder shall be in slot " #slot " of __NMEA0183_SentenceDecoders")
+NMEA0183_CHECK_SENTENCE_SLOT(FSI, 0);
+NMEA0183_CHECK_SENTENCE_SLOT(HDG, 1);
+NMEA0183_CHECK_SENTENCE_SLOT(BEC, 2);
+NMEA0183_CHECK_SENTENCE_SLOT(GGA, 5);
+NMEA0183_CHECK_SENTENCE_SLOT(ALM, 6);
+NMEA0183_CHECK_SENTENCE_SLOT(DBS, 7);
+NMEA0183_CHECK_SENTENCE_SLOT(AAM, 8);
+NMEA0183_CHECK_SENTENCE_SLOT(GSV, 9);
+NMEA0183_CHECK_SENTENCE_SLOT(APB, 10);
+NMEA0183_CHECK_SENTENCE_SLOT(HDM, 11);
+NMEA0183_CHECK_SENTENCE_SLOT(RMC, 12);
+NMEA0183_CHECK_SENTENCE_SLOT(VHW, 13);
+NMEA0183_CHECK_SENTENCE_SLOT(VTG, 16);
+NMEA0183_CHECK_SENTENCE_SLOT(MWV, 17);
+NMEA0183_CHECK_SENTENCE_SLOT(BOD, 18);
+NMEA0183_CHECK_SENTENCE_SLOT(DPT, 19);
+NMEA0183_CHECK_SENTENCE_SLOT(GLL, 22);
+NMEA0183_CHECK_SENTENCE_SLOT(GSA, 23);
+NMEA0183_CHECK_SENTENCE_SLOT(BWW, 24);
+NMEA0183_CHECK_SENTENCE_SLOT(DBT, 25);
+NMEA0183_CHECK_SENTENCE_SLOT(DBK, 26);
+NMEA0183_CHECK_SENTENCE_SLOT(HDT, 27);
+NMEA0183_CHECK_SENTENCE_SLOT(MTW, 28);
+NMEA0183_CHECK_SENTENCE_SLOT(TXT, 29);
+NMEA0183_CHECK_SENTENCE_SLOT(ZDA, 30);
+
+//-----------------------------------------------------------------------------
+
+
+
+#if defined(NMEA0183_USE_INPUT_BUFFER) && defined(NMEA0183_SENTENCE_SUBSCRIPTION)
+//=============================================================================
+// [STATIC] Is the address of the frame subscribed by the decoder?
+//=============================================================================
+static bool __NMEA0183_IsSubscribed(const NMEA0183_InputBuffer* pInput)
+{
+  const char* pAddress = &pInput->RawFrame[1];                                            // Skip the '$' (start delimiter)
+  uint32_t Slot = NMEA0183_SENTENCE_HASH_OTHERS;
+  if (pInput->BufferPos == NMEA0183_SENTENCE_FIELDS_POS - 1)                              // Address of 5 characters: Talker ID + Sentence ID
+  {
+    if ((pInput->TalkerFilter != NMEA0183_ANY_TALKER) && (pAddress[0] != 'P')                                        // Proprietary sentences are not filtered by talker ID
+     && (pInput->TalkerFilter != NMEA0183_TALKER_ID(pAddress[0], pAddress[1]))) return false;
+    const uint32_t SentenceID = NMEA0183_SENTENCE_ID(pAddress[2], pAddress[3], pAddress[4]);
+    const NMEA0183_SentenceDecoder* pEntry = &__NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH(SentenceID)];
+    if ((pEntry->fnDecode != NULL) && (pEntry->SentenceID == SentenceID)) Slot = NMEA0183_SENTENCE_HASH(SentenceID); // Sentence known by this library
+  }
+  return (pInput->SentenceMask & (1u << Slot)) != 0;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+
+#ifdef NMEA0183_USER_SENTENCE_DECODERS_COUNT
+//! Sentence decoder registered by the user
+typedef struct NMEA0183_UserSentenceDecoder
+{
+  char Address[NMEA0183_ADDRESS_MAX_SIZE];      //!< Sentence ID (3 chars, any talker) or whole address of the sentence decoded
+  uint8_t AddressSize;                          //!< Size of the address, 0 if the slot is not used
+  NMEA0183_UserSentenceDecoder_Func fnDecode;   //!< Decoder of the sentence
+  void* pContext;                               //!< Context given to the decoder
+} NMEA0183_UserSentenceDecoder;
+
+static NMEA0183_UserSentenceDecoder __NMEA0183_UserSentenceDecoders[NMEA0183_USER_SENTENCE_DECODERS_COUNT]; //!< Sentence decoders registered by the user
+
+//=============================================================================
+// Register a sentence decoder
+//=============================================================================
+eERRORRESULT NMEA0183_RegisterSentenceDecoder(const char* pAddress, NMEA0183_UserSentenceDecoder_Func fnDecode, void* pContext)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pAddress == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  const size_t AddressSize = strlen(pAddress);
+  if ((AddressSize < 3) || (AddressSize > NMEA0183_ADDRESS_MAX_SIZE)) return ERR__PARAMETER_ERROR;
+  NMEA0183_UserSentenceDecoder* pFree = NULL;
+  for (size_t z = 0; z < NMEA0183_USER_SENTENCE_DECODERS_COUNT; ++z)
+  {
+    NMEA0183_UserSentenceDecoder* pDecoder = &__NMEA0183_UserSentenceDecoders[z];
+    if (pDecoder->AddressSize == 0) { if (pFree == NULL) pFree = pDecoder; continue; }
+    if ((pDecoder->AddressSize == AddressSize) && (memcmp(&pDecoder->Address[0], pAddress, AddressSize) == 0))
+    {
+      if (fnDecode == NULL) pDecoder->AddressSize = 0;                   // Unregister the decoder
+      else { pDecoder->fnDecode = fnDecode; pDecoder->pContext = pContext; } // Replace the decoder
+      return ERR_OK;
+    }
+  }
+  if (fnDecode == NULL) return ERR_OK;                                   // Nothing to unregister
+  if (pFree == NULL) return ERR__BUFFER_FULL;                            // No more room for a decoder
+  memcpy(&pFree->Address[0], pAddress, AddressSize);
+  pFree->fnDecode    = fnDecode;
+  pFree->pContext    = pContext;
+  pFree->AddressSize = (uint8_t)AddressSize;
+  return ERR_OK;
+}
+
+//-----------------------------------------------------------------------------
+#endif
+
+
+
+#ifdef NMEA0183_PARSE_ERROR_DIAGNOSTICS
+//=============================================================================
+// [STATIC] Save where the parsing of the sentence stopped in the decoded data
+//=============================================================================
+static eERRORRESULT __NMEA0183_SaveParseError(eERRORRESULT error, const char* pRaw, size_t size, const char* pFields, NMEA0183_DecodedData* pData)
+{
+  if (ERR_ERROR_Get(error) != ERR__PARSE_ERROR) return error;                                 // Not a parse error, nothing to save
+  pData->ParseErrorField  = NMEA0183_NO_ERROR_POSITION;
+  pData->ParseErrorOffset = NMEA0183_NO_ERROR_POSITION;
+  const size_t Offset = NMEA0183_PARSE_ERROR_OFFSET_Get(error);
+  if ((Offset == NMEA0183_NO_ERROR_POSITION) || (pFields == NULL)) return ERR__PARSE_ERROR;   // The parser did not tell where it stopped
+  const size_t FieldsPos = (size_t)(pFields - pRaw);
+  if ((FieldsPos + Offset) >= size) return ERR__PARSE_ERROR;                                  // The offset shall be in the frame
+  size_t Field = 0;
+  for (size_t z = 0; z < Offset; ++z)
+    if (pFields[z] == NMEA0183_FIELD_DELIMITER) ++Field;                                      // Count the fields before the offset, only on error
+  pData->ParseErrorField  = (uint8_t)(Field < NMEA0183_NO_ERROR_POSITION ? Field : NMEA0183_NO_ERROR_POSITION);
+  pData->ParseErrorOffset = (uint8_t)((FieldsPos + Offset) < NMEA0183_NO_ERROR_POSITION ? (FieldsPos + Offset) : NMEA0183_NO_ERROR_POSITION);
+  return ERR__PARSE_ERROR;                                                                    // The position is in the decoded data, the error is returned without context
+}
+#  define NMEA0183_SAVE_PARSE_ERROR(error)  __NMEA0183_SaveParseError((error), pRaw, size, pFields, pData)
+#else
+#  define NMEA0183_SAVE_PARSE_ERROR(error)  (error)
+#endif
+
+
+//=============================================================================
+// [STATIC] Decode the NMEA0183 sentence
+//=============================================================================
+static eERRORRESULT __NMEA0183_DecodeSentence(const char* pRaw, size_t size, const NMEA0183_FieldsCursor* pCursor, NMEA0183_DecodedData* pData)
+{
+  eERRORRESULT Error = ERR__UNKNOWN_ELEMENT;
+  NMEA0183_FieldsCursor Cursor = *pCursor;
+  const char* pFields = Cursor.pSentence;
+
+  //--- Select sentence ---
+  if (size < NMEA0183_SENTENCE_FIELDS_POS) return NMEA0183_SAVE_PARSE_ERROR(ERR__PARSE_ERROR); // The frame shall contain at least the address field and a field delimiter
+  char* pStr = (char*)&pRaw[1];                                                               // Parsing: Skip the '$' (start delimiter)
+  pData->TalkerID   = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pStr[0], pStr[1]);               // Extract talker ID
+  pData->SentenceID = (eNMEA0183_SentencesID)NMEA0183_SENTENCE_ID(pStr[2], pStr[3], pStr[4]); // Extract sentence ID
+  if (pFields == NULL)                                                                        // No field index? Search the first field
+  {
+    const char* pEnd = &pRaw[size];
+    while ((pStr < pEnd) && (*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER) && (*pStr != 0)) ++pStr; // Go to the end of the address or the end of the frame
+    if ((pStr >= pEnd) || (*pStr != NMEA0183_FIELD_DELIMITER)) return NMEA0183_SAVE_PARSE_ERROR(ERR__PARSE_ERROR); // Check field delimiter
+    pFields = pStr + 1;
+    Cursor.pSentence = pFields;
+  }
+  const size_t AddressSize = (size_t)(pFields - &pRaw[1]) - 1;                                // Count of chars between the '$' and the first ','
+  pStr = (char*)pFields;                                                                      // Parsing: Go to the first field
+
+  //--- Parse sentence ---
+  if (AddressSize == 5)                                                                       // Sentence ID >3 chars so unknown by this library
+  {
+    const NMEA0183_SentenceDecoder* pDecoder = &__NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH(pData->SentenceID)];
+    if ((pDecoder->fnDecode != NULL) && (pDecoder->SentenceID == (uint32_t)pData->SentenceID))
+    {
+      Error = pDecoder->fnDecode(&Cursor, pData);                                             // The parser jumps to each field with the field index and sets the present fields
+      pData->ParseIsValid = (Error == ERR_OK);
+      if (Error != ERR_OK) Error = NMEA0183_SAVE_PARSE_ERROR(Error);                          // Nothing more to do on the success path
+      return Error;
+    }
+  }
+  else pData->SentenceID = NMEA0183_UNKNOWN;
+#ifdef NMEA0183_USER_SENTENCE_DECODERS_COUNT
+  for (size_t z = 0; z < NMEA0183_USER_SENTENCE_DECODERS_COUNT; ++z)                          // Search a sentence decoder registered by the user
+  {
+    const NMEA0183_UserSentenceDecoder* pDecoder = &__NMEA0183_UserSentenceDecoders[z];
+    bool Match = (pDecoder->AddressSize == AddressSize) && (memcmp(&pDecoder->Address[0], &pRaw[1], AddressSize) == 0); // Whole address
+    if ((pDecoder->AddressSize == 3) && (AddressSize == 5)) Match = (memcmp(&pDecoder->Address[0], &pRaw[3], 3) == 0); // Sentence ID of any talker
+    if (Match && (pDecoder->AddressSize != 0))
+    {
+#ifdef NMEA0183_PRESENT_FIELDS
+      pData->PresentFields = 0;                                                               // The user decoder can set it, with NMEA0183_GetPresentFields() for example
+#endif
+      Error = pDecoder->fnDecode(pStr, pData, pDecoder->pContext);
+      pData->ParseIsValid = (Error == ERR_OK);
+      if (Error != ERR_OK) Error = NMEA0183_SAVE_PARSE_ERROR(Error);                          // A user decoder can use NMEA0183_PARSE_ERROR_AT() too
+      return Error;
+    }
+  }
+#endif
+  if (size > NMEA0183_DECODED_FRAME_SIZE) size = NMEA0183_DECODED_FRAME_SIZE;
+  memcpy(&pData->Frame[0], pRaw, size);                                                       // Copy the whole unknown frame for the user
+  memset(&pData->Frame[size], 0, NMEA0183_DECODED_FRAME_SIZE - size);                         // Terminate the frame with '\0' if it is not full
+  pData->SentenceID = NMEA0183_UNKNOWN;                                                       // Sentence ID unknown by this library. User needs to parce externaly
+  pData->ParseIsValid = false;
+#ifdef NMEA0183_PRESENT_FIELDS
+  pData->PresentFields = 0;
+#endif
+  return Error;
+}
+
+
+
+//=============================================================================
+// [STATIC] Get the sentence decoder of a NMEA0183 frame string line
+//=============================================================================
+static const NMEA0183_SentenceDecoder* __NMEA0183_LineDecoder(const char* pLine)
+{
+  for (size_t z = 1; z < (NMEA0183_SENTENCE_FIELDS_POS - 1); ++z)                            // The address shall have 5 characters: Talker ID + Sentence ID
+    if ((pLine[z] == NMEA0183_FIELD_DELIMITER) || (pLine[z] == NMEA0183_CHECKSUM_DELIMITER) || (pLine[z] == '\0')) return NULL; // Stop on the '\0' terminal, no char past it is read
+  if (pLine[NMEA0183_SENTENCE_FIELDS_POS - 1] != NMEA0183_FIELD_DELIMITER) return NULL;
+  const uint32_t SentenceID = NMEA0183_SENTENCE_ID(pLine[3], pLine[4], pLine[5]);
+  const NMEA0183_SentenceDecoder* pDecoder = &__NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH(SentenceID)];
+  if ((pDecoder->fnDecode == NULL) || (pDecoder->SentenceID != SentenceID)) return NULL;     // Sentence unknown by this library
+  return pDecoder;
+}
+
+
+//=============================================================================
+// [STATIC] Decode a NMEA0183 frame string line of a known sentence, the checksum is checked while the fields are parsed
+//=============================================================================
+static eERRORRESULT __NMEA0183_DecodeLine(const char* pRaw, const NMEA0183_SentenceDecoder* pDecoder, NMEA0183_DecodedData* pData)
+{
+  const char* pFields = &pRaw[NMEA0183_SENTENCE_FIELDS_POS];
+  NMEA0183_LineChecksum Checksum = { 0, &pRaw[1] };                                           // Skip the '$' (start delimiter)
+  __NMEA0183_AddToChecksum(&Checksum, pFields);                                               // Add the address field and its ','
+  NMEA0183_FieldsCursor Cursor = NMEA0183_FIELDS_CURSOR(pFields, pRaw, NULL, 0);              // No field index, the fields are found while parsing
+  Cursor.pChecksum = &Checksum;
+
+  //--- Parse sentence ---
+  pData->TalkerID   = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pRaw[1], pRaw[2]);               // Extract talker ID
+  pData->SentenceID = (eNMEA0183_SentencesID)pDecoder->SentenceID;                            // Extract sentence ID
+  eERRORRESULT Error = pDecoder->fnDecode(&Cursor, pData);                                    // The parser adds the chars of each field to the checksum
+
+  //--- Frame control ---
+  size_t PosCRC = (size_t)(Checksum.pNext - pRaw);                                           // The chars not parsed are added up to the '*' or the '\0' terminal
+  while ((pRaw[PosCRC] != NMEA0183_CHECKSUM_DELIMITER) && (pRaw[PosCRC] != '\0')) Checksum.CalcCRC ^= (uint8_t)pRaw[PosCRC++];
+  size_t size;
+  const eERRORRESULT CRCerror = __NMEA0183_CheckStringCRC(pRaw, PosCRC, Checksum.CalcCRC, &size);
+  if (CRCerror != ERR_OK) return CRCerror;                                                    // A checksum error is returned before a parse error
+  pData->ParseIsValid = (Error == ERR_OK);
+  if (Error != ERR_OK) Error = NMEA0183_SAVE_PARSE_ERROR(Error);
+  return Error;
+}
+
+
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+//=============================================================================
+// [STATIC] Dispatch the NMEA0183 sentence to its handler
+//=============================================================================
+static eERRORRESULT __NMEA0183_DispatchSentence(const char* pRaw, size_t size, const NMEA0183_FieldsCursor* pCursor, const NMEA0183_SentenceHandler* pHandlers)
+{
+  NMEA0183_FieldsCursor Cursor = *pCursor;
+
+  //--- Select sentence ---
+  if (size < NMEA0183_SENTENCE_FIELDS_POS) return ERR__PARSE_ERROR;                           // The frame shall contain at least the address field and a field delimiter
+  if (Cursor.pSentence == NULL)                                                               // No field index? Search the first field
+  {
+    const char* pFields = (const char*)memchr(&pRaw[1], NMEA0183_FIELD_DELIMITER, size - 1);
+    if (pFields == NULL) return ERR__PARSE_ERROR;                                             // Check field delimiter
+    Cursor.pSentence = pFields + 1;
+  }
+  if (Cursor.pSentence == &pRaw[NMEA0183_SENTENCE_FIELDS_POS])                                         // Address of 5 characters: Talker ID + Sentence ID
+  {
+    const uint32_t SentenceID = NMEA0183_SENTENCE_ID(pRaw[3], pRaw[4], pRaw[5]);
+    const uint32_t Slot = NMEA0183_SENTENCE_HASH(SentenceID);
+    const NMEA0183_SentenceDecoder* pDecoder = &__NMEA0183_SentenceDecoders[Slot];
+    if ((pDecoder->fnDispatch != NULL) && (pDecoder->SentenceID == SentenceID))               // Sentence known by this library?
+    {
+      if (pHandlers[Slot].fnInvoke == NULL) return ERR__UNKNOWN_ELEMENT;                      // No handler, the sentence is not parsed
+      return pDecoder->fnDispatch(&Cursor, &pHandlers[Slot]);                                 // Parse on the stack and call the handler
+    }
+  }
+
+  //--- Sentence unknown by this library ---
+  const NMEA0183_SentenceHandler* pOthers = &pHandlers[NMEA0183_SENTENCE_HASH_OTHERS];
+  if (pOthers->fnInvoke == NULL) return ERR__UNKNOWN_ELEMENT;
+  NMEA0183_SentenceView View;
+  const eERRORRESULT Error = Init_NMEA0183SentenceView(&View, pRaw, size);                    // Give a view of the sentence to the handler
+  if (Error == ERR_OK) pOthers->fnInvoke(pOthers, &View);
+  return Error;
+}
+#endif
+
+
+#ifdef NMEA0183_USE_INPUT_BUFFER
+#if defined(NMEA0183_STRING_VIEWS) && (defined(NMEA0183_DIFFERENTIAL_DECODING) || defined(NMEA0183_FRAME_CACHE_SIZE))
+//=============================================================================
+// [STATIC] Move the string views of the decoded data from a frame buffer to another
+//=============================================================================
+static void __NMEA0183_MoveStringViews(NMEA0183_DecodedData* pData, const char* pFrom, const char* pTo)
+{
+#define NMEA0183_MOVE_VIEW(view)  (view).pChars = pTo + ((view).pChars - pFrom)
+  if (pData->ParseIsValid == false) return;                                                   // The views may not be set
+  switch (pData->SentenceID)
+  {
+#ifdef NMEA0183_DECODE_AAM
+    case NMEA0183_AAM: NMEA0183_MOVE_VIEW(pData->AAM.WaypointID); break;
+#endif
+#ifdef NMEA0183_DECODE_APB
+    case NMEA0183_APB: NMEA0183_MOVE_VIEW(pData->APB.WaypointID); break;
+#endif
+#ifdef NMEA0183_DECODE_BEC
+    case NMEA0183_BEC: NMEA0183_MOVE_VIEW(pData->BEC.WaypointID); break;
+#endif
+#ifdef NMEA0183_DECODE_BOD
+    case NMEA0183_BOD: NMEA0183_MOVE_VIEW(pData->BOD.DestWaypointID); NMEA0183_MOVE_VIEW(pData->BOD.OriginWaypointID); break;
+#endif
+#ifdef NMEA0183_DECODE_BWW
+    case NMEA0183_BWW: NMEA0183_MOVE_VIEW(pData->BWW.FromWaypointID); NMEA0183_MOVE_VIEW(pData->BWW.ToWaypointID); break;
+#endif
+#ifdef NMEA0183_DECODE_TXT
+    case NMEA0183_TXT: NMEA0183_MOVE_VIEW(pData->TXT.TextMessage); break;
+#endif
+    default: break;
+  }
+#undef NMEA0183_MOVE_VIEW
+}
+#endif
+
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+//=============================================================================
+// [STATIC] Hash of a raw frame for the decoded frames cache (FNV-1a on 32-bit words)
+//=============================================================================
+static uint32_t __NMEA0183_FrameHash(const char* pFrame, size_t size)
+{
+  uint32_t Hash = 2166136261u;                                                                // FNV-1a offset basis
+  size_t Pos = 0;
+  for (; (Pos + sizeof(uint32_t)) <= size; Pos += sizeof(uint32_t))
+  {
+    uint32_t Word;
+    memcpy(&Word, &pFrame[Pos], sizeof(Word));                                                // Unaligned load of the next 4 characters
+    Hash = (Hash ^ Word) * 16777619u;                                                         // FNV-1a prime
+  }
+  for (; Pos < size; ++Pos) Hash = (Hash ^ (uint8_t)pFrame[Pos]) * 16777619u;
+  return Hash;
+}
+
+
+//=============================================================================
+// [STATIC] Give back the decoded data of a frame if the same frame is in the cache
+//=============================================================================
+static bool __NMEA0183_GetCachedFrame(const NMEA0183_InputBuffer* pInput, NMEA0183_DecodeHistory* pHistory, uint32_t hash, NMEA0183_DecodedData* pData, eERRORRESULT* pError)
+{
+  const size_t Size = pInput->BufferPos;
+  for (size_t z = 0; z < NMEA0183_FRAME_CACHE_SIZE; ++z)
+  {
+    const NMEA0183_CachedFrame* pEntry = &pHistory->Cache[z];
+    if ((pEntry->Hash != hash) || (pEntry->CRC != pInput->CurrCalcCRC) || (pEntry->Size != Size)) continue;
+    if (memcmp(&pEntry->RawFrame[0], &pInput->RawFrame[0], Size) != 0) continue;             // Same hash but not the same frame
+    memcpy(pData, &pEntry->Data, sizeof(NMEA0183_DecodedData));                               // Same frame? No need to parse it again
+#ifdef NMEA0183_STRING_VIEWS
+    __NMEA0183_MoveStringViews(pData, &pEntry->RawFrame[0], &pInput->RawFrame[0]);           // The views are in the frame of the decoder as if it was parsed
+#endif
+    ++pHistory->CacheHits;
+    *pError = pEntry->Error;
+    return true;
+  }
+  ++pHistory->CacheMisses;
+  return false;
+}
+
+
+//=============================================================================
+// [STATIC] Keep a decoded frame in the cache
+//=============================================================================
+static void __NMEA0183_KeepCachedFrame(const NMEA0183_InputBuffer* pInput, NMEA0183_DecodeHistory* pHistory, uint32_t hash, const NMEA0183_FieldsCursor* pCursor, const NMEA0183_DecodedData* pData, eERRORRESULT error)
+{
+  const size_t Size = pInput->BufferPos;
+  if (pCursor->pSentence != &pInput->RawFrame[NMEA0183_SENTENCE_FIELDS_POS]) return;       // Only the sentences known by this library are kept...
+  const NMEA0183_SentenceDecoder* pKnown = &__NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH(pData->SentenceID)];
+  if ((pKnown->fnDecode == NULL) || (pKnown->SentenceID != (uint32_t)pData->SentenceID)) return; // ...the decoders registered by the user are always called
+  NMEA0183_CachedFrame* pEntry = &pHistory->Cache[pHistory->NextCache];                       // Replace the oldest entry
+  pHistory->NextCache = (uint8_t)((pHistory->NextCache + 1u) % NMEA0183_FRAME_CACHE_SIZE);
+  pEntry->Hash  = hash;
+  pEntry->CRC   = pInput->CurrCalcCRC;
+  pEntry->Size  = (uint8_t)Size;
+  memcpy(&pEntry->RawFrame[0], &pInput->RawFrame[0], Size);
+  pEntry->Error = error;
+  memcpy(&pEntry->Data, pData, sizeof(NMEA0183_DecodedData));
+#ifdef NMEA0183_STRING_VIEWS
+  __NMEA0183_MoveStringViews(&pEntry->Data, &pInput->RawFrame[0], &pEntry->RawFrame[0]);     // The views of the kept data are in the kept frame
+#endif
+}
+
+
+#ifndef NMEA0183_DIFFERENTIAL_DECODING // The differential decoding searches the cache itself
+//=============================================================================
+// [STATIC] Decode the sentence of a frame, or give back the decoded data of the same frame in the cache
+//=============================================================================
+static eERRORRESULT __NMEA0183_DecodeCached(const NMEA0183_InputBuffer* pInput, NMEA0183_DecodeHistory* pHistory, const NMEA0183_FieldsCursor* pCursor, NMEA0183_DecodedData* pData)
+{
+  const uint32_t Hash = __NMEA0183_FrameHash(&pInput->RawFrame[0], pInput->BufferPos);
+  eERRORRESULT Error;
+  if (__NMEA0183_GetCachedFrame(pInput, pHistory, Hash, pData, &Error)) return Error;
+  Error = __NMEA0183_DecodeSentence(&pInput->RawFrame[0], pInput->BufferPos, pCursor, pData);
+  __NMEA0183_KeepCachedFrame(pInput, pHistory, Hash, pCursor, pData, Error);
+  return Error;
+}
+#endif
+#endif
+
+
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+//=============================================================================
+// [STATIC] Get the fields changed since the previous frame of the same address, and the fields moved in the frame by a field of another size
+//=============================================================================
+static uint32_t __NMEA0183_ChangedFields(const NMEA0183_InputBuffer* pInput, size_t addressEnd, const NMEA0183_PreviousFrame* pPrevious, uint32_t* pMovedFields)
+{
+  const size_t FieldCount = pInput->FieldCount;
+  if ((FieldCount == pPrevious->FieldCount) && (FieldCount <= NMEA0183_FIELD_INDEX_SIZE))   // Same count of fields, all in the field index? Compare the fields one by one
+  {
+    uint32_t ChangedFields = 0;
+    *pMovedFields = 0;
+    for (size_t Field = 0; Field < FieldCount; ++Field)
+    {
+      const size_t Start = (size_t)pInput->FieldPos[Field] + 1, PrevStart = (size_t)pPrevious->FieldPos[Field] + 1;
+      size_t End, PrevEnd;
+      if ((Field + 1) < FieldCount) { End = pInput->FieldPos[Field + 1]; PrevEnd = pPrevious->FieldPos[Field + 1]; }
+      else                                                                // The last field ends with the '*'
+      {
+        for (End = Start; (End < pInput->BufferPos) && (pInput->RawFrame[End] != NMEA0183_CHECKSUM_DELIMITER); ++End) {}
+        for (PrevEnd = PrevStart; (PrevEnd < pPrevious->Size) && (pPrevious->RawFrame[PrevEnd] != NMEA0183_CHECKSUM_DELIMITER); ++PrevEnd) {}
+      }
+      const uint32_t FieldBit = NMEA0183_FIELD_BIT(Field);
+      if (Start != PrevStart) *pMovedFields |= FieldBit;                  // A field before has another size
+      if (((End - Start) != (PrevEnd - PrevStart)) || (memcmp(&pInput->RawFrame[Start], &pPrevious->RawFrame[PrevStart], End - Start) != 0))
+        ChangedFields |= FieldBit;
+    }
+    return ChangedFields;
+  }
+
+  //--- Walk the fields of both frames ---
+  const char* pStr     = &pInput->RawFrame[addressEnd];                   // Both frames have the same address
+  const char* pEnd     = &pInput->RawFrame[pInput->BufferPos];
+  const char* pPrevStr = &pPrevious->RawFrame[addressEnd];
+  const char* pPrevEnd = &pPrevious->RawFrame[pPrevious->Size];
+  bool Ended = false, PrevEnded = false, Moved = false;
+  uint32_t ChangedFields = 0;
+  *pMovedFields = 0;
+  uint32_t FieldBit = 1u;
+  while (true)                                                            // Walk the fields of both frames side by side
+  {
+    const char* pField     = pStr;
+    const char* pPrevField = pPrevStr;
+    if (Moved) *pMovedFields |= FieldBit;                                 // A field before has another size
+    if (Ended == false)     while ((pStr     < pEnd)     && (*pStr     != NMEA0183_FIELD_DELIMITER) && (*pStr     != NMEA0183_CHECKSUM_DELIMITER)) ++pStr;
+    if (PrevEnded == false) while ((pPrevStr < pPrevEnd) && (*pPrevStr != NMEA0183_FIELD_DELIMITER) && (*pPrevStr != NMEA0183_CHECKSUM_DELIMITER)) ++pPrevStr;
+    const size_t Size = (size_t)(pStr - pField);
+    if (Size != (size_t)(pPrevStr - pPrevField)) Moved = true;
+    if (Ended || PrevEnded || (Size != (size_t)(pPrevStr - pPrevField)) || (memcmp(pField, pPrevField, Size) != 0))
+      ChangedFields |= FieldBit;                                          // Field added, removed or changed
+    if (Ended == false)     { if ((pStr     < pEnd)     && (*pStr     == NMEA0183_FIELD_DELIMITER)) ++pStr;     else Ended = true; }
+    if (PrevEnded == false) { if ((pPrevStr < pPrevEnd) && (*pPrevStr == NMEA0183_FIELD_DELIMITER)) ++pPrevStr; else PrevEnded = true; }
+    if (Ended && PrevEnded) break;
+    if (FieldBit != 0x80000000u) FieldBit <<= 1;                          // The fields 31 and more share the bit 31
+  }
+  return ChangedFields;
+}
+
+
+//=============================================================================
+// [STATIC] Decode only the fields of a frame changed since the previous frame of the same address
+//=============================================================================
+static bool __NMEA0183_DecodeChangedFields(const NMEA0183_InputBuffer* pInput, const NMEA0183_PreviousFrame* pPrevious, const NMEA0183_FieldsCursor* pCursor, uint32_t fieldsToParse, NMEA0183_DecodedData* pData)
+{
+  if ((pPrevious->Error != ERR_OK) || (pPrevious->FieldCount != pInput->FieldCount)) return false;         // The other fields are only kept from a valid frame with the same count of fields
+  if (pCursor->pSentence != &pInput->RawFrame[NMEA0183_SENTENCE_FIELDS_POS]) return false;                 // Only the sentences known by this library...
+  const NMEA0183_SentenceDecoder* pKnown = &__NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH(pPrevious->Data.SentenceID)];
+  if ((pKnown->fnDecode == NULL) || (pKnown->SentenceID != (uint32_t)pPrevious->Data.SentenceID)) return false; // ...are parsed field by field
+  memcpy(pData, &pPrevious->Data, sizeof(NMEA0183_DecodedData));                            // The fields not changed keep the data of the previous frame
+#ifdef NMEA0183_STRING_VIEWS
+  __NMEA0183_MoveStringViews(pData, &pPrevious->RawFrame[0], &pInput->RawFrame[0]);         // The views of the fields not moved are in the frame of the decoder as if it was parsed
+#endif
+  NMEA0183_FieldsCursor Cursor = *pCursor;
+  Cursor.FieldsToParse = fieldsToParse;
+  return (pKnown->fnDecode(&Cursor, pData) == ERR_OK);                                      // On error, the whole frame is decoded again for the result of the frame
+}
+
+
+//=============================================================================
+// [STATIC] Decode the sentence of a frame against the previous frame of the same address
+//=============================================================================
+static eERRORRESULT __NMEA0183_DecodeDifferential(const NMEA0183_InputBuffer* pInput, NMEA0183_DecodeHistory* pHistory, const NMEA0183_FieldsCursor* pCursor, NMEA0183_DecodedData* pData)
+{
+  const size_t Size       = pInput->BufferPos;
+  const size_t AddressEnd = (size_t)pInput->FieldPos[0] + 1;                                   // Count of chars of "$<address>,"
+
+  //--- Search the previous frame of the address ---
+  NMEA0183_PreviousFrame* pPrevious = NULL;
+  for (size_t z = 0; z < NMEA0183_DIFFERENTIAL_DECODING; ++z)
+  {
+    NMEA0183_PreviousFrame* pEntry = &pHistory->Previous[z];
+    if ((pEntry->Size >= AddressEnd) && (memcmp(&pEntry->RawFrame[0], &pInput->RawFrame[0], AddressEnd) == 0)) { pPrevious = pEntry; break; }
+  }
+  uint32_t ChangedFields = NMEA0183_ALL_FIELDS_CHANGED;
+  uint32_t FieldsToParse = NMEA0183_PARSE_ALL_FIELDS;
+  if (pPrevious != NULL)
+  {
+    if ((pPrevious->Size == Size) && (memcmp(&pPrevious->RawFrame[0], &pInput->RawFrame[0], Size) == 0))   // Same frame? No need to parse it again
+    {
+      memcpy(pData, &pPrevious->Data, sizeof(NMEA0183_DecodedData));
+      pData->ChangedFields = 0;
+      return pPrevious->Error;
+    }
+    uint32_t MovedFields;
+    ChangedFields = __NMEA0183_ChangedFields(pInput, AddressEnd, pPrevious, &MovedFields);
+#ifdef NMEA0183_STRING_VIEWS
+    FieldsToParse = ChangedFields | MovedFields;                                              // The views of the fields moved are taken again
+#else
+    FieldsToParse = ChangedFields;
+    (void)MovedFields;
+#endif
+  }
+  else
+  {
+    pPrevious = &pHistory->Previous[pHistory->NextPrevious];                                  // New address: replace the oldest entry
+    pHistory->NextPrevious = (uint8_t)((pHistory->NextPrevious + 1u) % NMEA0183_DIFFERENTIAL_DECODING);
+  }
+
+  //--- Parse and keep the frame ---
+  eERRORRESULT Error = ERR_OK;
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+  const uint32_t Hash = __NMEA0183_FrameHash(&pInput->RawFrame[0], Size);
+  if (__NMEA0183_GetCachedFrame(pInput, pHistory, Hash, pData, &Error) == false)               // Same frame in the cache? No need to parse it again
+#endif
+  {
+    if ((FieldsToParse != NMEA0183_PARSE_ALL_FIELDS) && __NMEA0183_DecodeChangedFields(pInput, pPrevious, pCursor, FieldsToParse, pData))
+      Error = ERR_OK;                                                                         // Only the fields changed are parsed again
+    else Error = __NMEA0183_DecodeSentence(&pInput->RawFrame[0], Size, pCursor, pData);       // New address, other fields or sentence not known by this library
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+    __NMEA0183_KeepCachedFrame(pInput, pHistory, Hash, pCursor, pData, Error);
+#endif
+  }
+  pData->ChangedFields = ChangedFields;
+  pPrevious->Size = Size;
+  pPrevious->FieldCount = pInput->FieldCount;
+  memcpy(&pPrevious->FieldPos[0], &pInput->FieldPos[0], sizeof(pPrevious->FieldPos));
+  memcpy(&pPrevious->RawFrame[0], &pInput->RawFrame[0], Size);
+  pPrevious->Error = Error;
+  memcpy(&pPrevious->Data, pData, sizeof(NMEA0183_DecodedData));
+#ifdef NMEA0183_STRING_VIEWS
+  __NMEA0183_MoveStringViews(&pPrevious->Data, &pInput->RawFrame[0], &pPrevious->RawFrame[0]);   // The views of the kept data are in the kept frame
+#endif
+  return Error;
+}
+#endif
+
+
+//=============================================================================
+// [STATIC] Check the frame of a decode structure with the checksum computed while receiving it
+//=============================================================================
+static eERRORRESULT __NMEA0183_CheckFrame(const NMEA0183_InputBuffer* pInput, NMEA0183_FieldsCursor* pCursor)
+{
+  if (pInput->RawFrame[0] != NMEA0183_START_DELIMITER) return ERR__BAD_FRAME_TYPE;   // The frame shall start with '$'
+  char* pCRC = (char*)&pInput->CRC[0];
+  const uint8_t FrameCRC = (uint8_t)__NMEA0183_HexStringToUint(&pCRC, 2); // Get frame CRC
+  if (FrameCRC != pInput->CurrCalcCRC) return ERR__CRC_ERROR;             // The frame CRC shall correspond to the one calculated
+  if (pInput->FieldCount == 0) return ERR__PARSE_ERROR;                   // The frame shall have at least one field
+  pCursor->pSentence    = &pInput->RawFrame[pInput->FieldPos[0] + 1];     // The first field is after the first field delimiter, no need to search it
+  pCursor->pFrame       = &pInput->RawFrame[0];
+  pCursor->pFieldPos    = &pInput->FieldPos[0];                           // The parsers jump to each field with the field index...
+  pCursor->FieldPosCount = (pInput->FieldCount < NMEA0183_FIELD_INDEX_SIZE ? pInput->FieldCount : NMEA0183_FIELD_INDEX_SIZE); // ...and walk the fields after the last position recorded
+  pCursor->FieldsToParse = NMEA0183_PARSE_ALL_FIELDS;
+  pCursor->pChecksum     = NULL;                                          // The checksum is computed while receiving
+  return ERR_OK;
+}
+
+
+//=============================================================================
+// [STATIC] Process the NMEA0183 frame of an input buffer, the previous frames are kept in the history
+//=============================================================================
+static eERRORRESULT __NMEA0183_ProcessFrame(NMEA0183_InputBuffer* pInput, NMEA0183_DecodeHistory* pHistory, NMEA0183_DecodedData* pData)
+{
+  pData->ParseIsValid = false;
+  NMEA0183_COPY_TIMESTAMPS(pInput, pData);                                // Copy the receive timestamps of the frame even if it is not valid
+  pInput->State = NMEA0183_IN_PROCESS;                                    //Frame is in process
+
+  //--- Frame control ---
+  NMEA0183_FieldsCursor Cursor;
+  eERRORRESULT Error = __NMEA0183_CheckFrame(pInput, &Cursor);
+  if (Error != ERR_OK)
+  {
+    pInput->State = NMEA0183_WAIT_START;                                  // Frame is Processed, wait for a new frame
+    return Error;
+  }
+
+  //--- Parse data ---
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+  Error = __NMEA0183_DecodeDifferential(pInput, pHistory, &Cursor, pData);   // Process string sentence if it changed
+#elif defined(NMEA0183_FRAME_CACHE_SIZE)
+  Error = __NMEA0183_DecodeCached(pInput, pHistory, &Cursor, pData);    // Process string sentence if it is not in the cache
+#else
+  (void)pHistory;
+  Error = __NMEA0183_DecodeSentence(&pInput->RawFrame[0], pInput->BufferPos, &Cursor, pData);    // Process string sentence
+#endif
+  NMEA0183_COPY_TIMESTAMPS(pInput, pData);                                // The data kept from a previous frame has the timestamps of the previous frame
+  pInput->State = NMEA0183_WAIT_START;                                    // Frame is Processed, wait for a new frame
+  return Error;
+}
+
+
+//=============================================================================
+// Process the NMEA0183 frame (used with the decode structure)
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessFrame(NMEA0183_DecodeInput* pDecoder, NMEA0183_DecodedData* pData)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pDecoder == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  return __NMEA0183_ProcessFrame(NMEA0183_DECODER_INPUT(pDecoder), NMEA0183_HISTORY_OF(pDecoder), pData);
+}
+
+
+//=============================================================================
+// Check the NMEA0183 frame of the decode structure and locate its sentence
+//=============================================================================
+eERRORRESULT NMEA0183_CheckFrame(NMEA0183_DecodeInput* pDecoder, eNMEA0183_TalkerID* pTalkerID, eNMEA0183_SentencesID* pSentenceID, const char** ppFields)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pDecoder == NULL) || (pTalkerID == NULL) || (pSentenceID == NULL) || (ppFields == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  NMEA0183_FieldsCursor Cursor;
+  const eERRORRESULT Error = __NMEA0183_CheckFrame(NMEA0183_DECODER_INPUT(pDecoder), &Cursor);
+  if (Error != ERR_OK) return Error;
+  *ppFields = Cursor.pSentence;
+  const char* pAddress = &NMEA0183_DECODER_INPUT(pDecoder)->RawFrame[1];  // Skip the '$' (start delimiter)
+  *pTalkerID   = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pAddress[0], pAddress[1]);
+  *pSentenceID = NMEA0183_UNKNOWN;
+  if (*ppFields == &NMEA0183_DECODER_INPUT(pDecoder)->RawFrame[NMEA0183_SENTENCE_FIELDS_POS]) // Address of 5 characters: Talker ID + Sentence ID
+    *pSentenceID = (eNMEA0183_SentencesID)NMEA0183_SENTENCE_ID(pAddress[2], pAddress[3], pAddress[4]);
+  return ERR_OK;
+}
+
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+//=============================================================================
+// Dispatch the NMEA0183 frame to its handler (used with the decode structure)
+//=============================================================================
+eERRORRESULT NMEA0183_DispatchFrame(NMEA0183_DecodeInput* pDecoder, const NMEA0183_SentenceHandler* pHandlers)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pDecoder == NULL) || (pHandlers == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  NMEA0183_InputBuffer* pInput = NMEA0183_DECODER_INPUT(pDecoder);
+  pInput->State = NMEA0183_IN_PROCESS;                                    //Frame is in process
+  NMEA0183_FieldsCursor Cursor;
+  eERRORRESULT Error = __NMEA0183_CheckFrame(pInput, &Cursor);            // Same frame control as NMEA0183_ProcessFrame()
+  if (Error == ERR_OK) Error = __NMEA0183_DispatchSentence(&pInput->RawFrame[0], pInput->BufferPos, &Cursor, pHandlers);
+  pInput->State = NMEA0183_WAIT_START;                                    // Frame is Processed, wait for a new frame
+  return Error;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+#define NMEA0183_FRAME_QUEUE_NEXT(index)  ( ((index) + 1u) & (NMEA0183_FRAME_QUEUE_DEPTH - 1u) ) // Next slot index in the ring
+
+//=============================================================================
+// Initialize a NMEA0183 frame queue
+//=============================================================================
+eERRORRESULT Init_NMEA0183FrameQueue(NMEA0183_FrameQueue* pQueue)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  memset(pQueue, 0, sizeof(NMEA0183_FrameQueue));
+  for (size_t zSlot = 0; zSlot < NMEA0183_FRAME_QUEUE_DEPTH; ++zSlot)
+    __NMEA0183_InitInputBuffer(&pQueue->Slots[zSlot]); // Init each frame slot
+  pQueue->Head = 0;
+  pQueue->Tail = 0;
+  return ERR_OK;
+}
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+//=============================================================================
+// Set the sentences subscribed by the frame queue
+//=============================================================================
+eERRORRESULT NMEA0183_FrameQueue_SetSentenceSubscription(NMEA0183_FrameQueue* pQueue, uint32_t sentenceMask, uint16_t talkerID)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  for (size_t zSlot = 0; zSlot < NMEA0183_FRAME_QUEUE_DEPTH; ++zSlot)
+  {
+    pQueue->Slots[zSlot].SentenceMask = sentenceMask;   // Each frame slot filters its own frame
+    pQueue->Slots[zSlot].TalkerFilter = talkerID;
+  }
+  return ERR_OK;
+}
+#endif
+
+//=============================================================================
+// Get the count of resynchronizations of all the slots of the frame queue
+//=============================================================================
+eERRORRESULT NMEA0183_FrameQueue_GetResyncCount(NMEA0183_FrameQueue* pQueue, uint32_t* pCount)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pQueue == NULL) || (pCount == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  uint32_t Count = 0;
+  for (size_t z = 0; z < NMEA0183_FRAME_QUEUE_DEPTH; ++z) Count += pQueue->Slots[z].ResyncCount; // Each slot counts the frames cut while it was accumulating
+  *pCount = Count;
+  return ERR_OK;
+}
+
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+//=============================================================================
+// Set the clock hook of all the slots of the frame queue
+//=============================================================================
+eERRORRESULT NMEA0183_FrameQueue_SetReceiveClock(NMEA0183_FrameQueue* pQueue, NMEA0183_Clock_Func fnClock, void* pContext)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  for (size_t zSlot = 0; zSlot < NMEA0183_FRAME_QUEUE_DEPTH; ++zSlot)
+  {
+    pQueue->Slots[zSlot].fnClock       = fnClock;       // Each frame slot reads the clock for its own frame
+    pQueue->Slots[zSlot].pClockContext = pContext;
+  }
+  return ERR_OK;
+}
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+//=============================================================================
+// Get the statistics of the decoded frames cache of the frame queue
+//=============================================================================
+eERRORRESULT NMEA0183_FrameQueue_GetFrameCacheStatistics(NMEA0183_FrameQueue* pQueue, uint32_t* pHits, uint32_t* pMisses)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if (pHits   != NULL) *pHits   = pQueue->History.CacheHits;
+  if (pMisses != NULL) *pMisses = pQueue->History.CacheMisses;
+  return ERR_OK;
+}
+#endif
+
+
+//=============================================================================
+// [STATIC] Publish the frame of the head slot if it is complete and a slot is free
+//=============================================================================
+static NMEA0183_InputBuffer* __NMEA0183_FrameQueue_Publish(NMEA0183_FrameQueue* pQueue)
+{
+  const size_t Head = pQueue->Head;
+  if (pQueue->Slots[Head].State != NMEA0183_TO_PROCESS) return &pQueue->Slots[Head]; // Frame still accumulating
+  const size_t Next = NMEA0183_FRAME_QUEUE_NEXT(Head);
+  if (Next == pQueue->Tail) return &pQueue->Slots[Head];                            // Queue full, the frame stays in the head slot for now
+  NMEA0183_MEMORY_BARRIER();                                                        // The slot content shall be written before it is published
+  pQueue->Head = Next;                                                              // Publish the frame to the consumer
+  return &pQueue->Slots[Next];
+}
+
+
+//=============================================================================
+// Add NMEA0183 received frame character data to the frame queue
+//=============================================================================
+eERRORRESULT NMEA0183_FrameQueue_AddReceivedCharacter(NMEA0183_FrameQueue* pQueue, char data)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  NMEA0183_InputBuffer* pSlot = __NMEA0183_FrameQueue_Publish(pQueue);  // Retry a publish in case the queue was full at the end of the last frame
+  if (__NMEA0183_EndCutFrame(pSlot, data)) pSlot = __NMEA0183_FrameQueue_Publish(pQueue); // The end of the frame was lost but its checksum is complete, publish it before the start delimiter
+  const eERRORRESULT Error = __NMEA0183_AddReceivedCharacter(pSlot, data);
+  (void)__NMEA0183_FrameQueue_Publish(pQueue);                          // Publish the frame as soon as it is complete
+  return Error;
+}
+
+
+//=============================================================================
+// Is a frame of the queue ready to process?
+//=============================================================================
+bool NMEA0183_FrameQueue_IsFrameReadyToProcess(NMEA0183_FrameQueue* pQueue)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return false;
+#endif
+  return pQueue->Tail != pQueue->Head;
+}
+
+
+//=============================================================================
+// Get the count of frames ready to process in the queue
+//=============================================================================
+size_t NMEA0183_FrameQueue_GetFrameCount(NMEA0183_FrameQueue* pQueue)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pQueue == NULL) return 0;
+#endif
+  return (pQueue->Head - pQueue->Tail) & (NMEA0183_FRAME_QUEUE_DEPTH - 1u);
+}
+
+
+//=============================================================================
+// Process the oldest NMEA0183 frame of the queue
+//=============================================================================
+eERRORRESULT NMEA0183_FrameQueue_ProcessFrame(NMEA0183_FrameQueue* pQueue, NMEA0183_DecodedData* pData)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pQueue == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  const size_t Tail = pQueue->Tail;
+  if (Tail == pQueue->Head)
+  {
+    pData->ParseIsValid = false;
+    return ERR__NO_DATA_AVAILABLE;                                      // No frame published
+  }
+  NMEA0183_MEMORY_BARRIER();                                            // The slot content shall be read after the head index
+  const eERRORRESULT Error = __NMEA0183_ProcessFrame(&pQueue->Slots[Tail], NMEA0183_HISTORY_OF(pQueue), pData); // The previous frames are kept by the queue, not by each slot
+  NMEA0183_MEMORY_BARRIER();                                            // The slot shall be processed before it is released
+  pQueue->Tail = NMEA0183_FRAME_QUEUE_NEXT(Tail);                       // Release the slot to the producer
+  return Error;
+}
+#endif // NMEA0183_FRAME_QUEUE_DEPTH
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Check the start delimiter and the checksum of a line of a known length
+//=============================================================================
+eERRORRESULT __NMEA0183_CheckLine(const char* pLine, size_t length, size_t* pPosCRC, size_t* pSize, uint8_t* pFieldPos, size_t maxFields, size_t* pFieldCount)
+{
+  *pFieldCount = 0;
+  if ((length == 0) || (pLine[0] != NMEA0183_START_DELIMITER)) return ERR__BAD_FRAME_TYPE; // The frame shall start with '$'
+  uint8_t CurrCalcCRC = 0;
+  const size_t PosCRC = 1 + __NMEA0183_ChecksumToDelimiter(&pLine[1], length - 1, &CurrCalcCRC, pFieldPos, maxFields, pFieldCount); // Calculate CRC of the frame (skip the '$') and tokenize its fields
+  if (PosCRC >= length) return ERR__CRC_ERROR;                            // The frame shall contain a '*' (checksum delimiter)
+  size_t CRCsize = length - (PosCRC + 1);                                 // Count of chars available after the '*'
+  if (CRCsize == 0) return ERR__CRC_ERROR;                                // The frame shall contain a checksum
+  if (CRCsize > 2) CRCsize = 2;
+  char* pStr = (char*)&pLine[PosCRC + 1];                                 // Parsing: Skip the '*' (checksum delimiter)
+  const uint8_t FrameCRC = (uint8_t)__NMEA0183_HexStringToUint(&pStr, CRCsize); // Get frame CRC
+  if (FrameCRC != CurrCalcCRC) return ERR__CRC_ERROR;                     // The frame CRC shall correspond to the one calculated
+  *pPosCRC = PosCRC;
+  *pSize   = PosCRC + 1 + CRCsize;
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// [STATIC] Check the start delimiter and the checksum of a line with '\0' terminal
+//=============================================================================
+eERRORRESULT __NMEA0183_CheckString(const char* pLine, size_t* pPosCRC, size_t* pSize, uint8_t* pFieldPos, size_t maxFields, size_t* pFieldCount)
+{
+  *pFieldCount = 0;
+  if (pLine[0] != NMEA0183_START_DELIMITER) return ERR__BAD_FRAME_TYPE;  // The frame shall start with '$'
+  uint8_t CurrCalcCRC = 0;
+  size_t FieldCount = 0;
+  size_t PosCRC = 1;                                                      // Skip the '$'
+  while ((pLine[PosCRC] != NMEA0183_CHECKSUM_DELIMITER) && (pLine[PosCRC] != '\0')) // Calculate CRC of the frame and tokenize its fields up to the '*', or up to the '\0' terminal
+  {
+    if ((pLine[PosCRC] == NMEA0183_FIELD_DELIMITER) && (FieldCount < maxFields) && (PosCRC <= 0xFF)) pFieldPos[FieldCount++] = (uint8_t)PosCRC;
+    CurrCalcCRC ^= (uint8_t)pLine[PosCRC];
+    ++PosCRC;
+  }
+  *pFieldCount = FieldCount;
+  const eERRORRESULT Error = __NMEA0183_CheckStringCRC(pLine, PosCRC, CurrCalcCRC, pSize);
+  if (Error != ERR_OK) return Error;
+  *pPosCRC = PosCRC;
+  return ERR_OK;
+}
+
+
+//=============================================================================
+// [STATIC] Check the checksum field of a line with '\0' terminal
+//=============================================================================
+eERRORRESULT __NMEA0183_CheckStringCRC(const char* pLine, size_t posCRC, uint8_t calcCRC, size_t* pSize)
+{
+  if (pLine[posCRC] == '\0') return ERR__CRC_ERROR;                       // The frame shall contain a '*' (checksum delimiter)
+  size_t CRCsize = 0;                                                     // Count of chars available after the '*' (2 max)
+  while ((CRCsize < 2) && (pLine[posCRC + 1 + CRCsize] != '\0')) ++CRCsize;
+  if (CRCsize == 0) return ERR__CRC_ERROR;                                // The frame shall contain a checksum
+  char* pStr = (char*)&pLine[posCRC + 1];                                 // Parsing: Skip the '*' (checksum delimiter)
+  const uint8_t FrameCRC = (uint8_t)__NMEA0183_HexStringToUint(&pStr, CRCsize); // Get frame CRC
+  if (FrameCRC != calcCRC) return ERR__CRC_ERROR;                         // The frame CRC shall correspond to the one calculated
+  *pSize = posCRC + 1 + CRCsize;
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// Check a NMEA0183 frame line of a known length and locate its sentence
+//=============================================================================
+eERRORRESULT NMEA0183_CheckLineN(const char* pLine, size_t length, eNMEA0183_TalkerID* pTalkerID, eNMEA0183_SentencesID* pSentenceID, const char** ppFields)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pLine == NULL) || (pTalkerID == NULL) || (pSentenceID == NULL) || (ppFields == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  //--- Frame control ---
+  size_t PosCRC, Size, FieldCount;
+  uint8_t FieldPos = 0;
+  const eERRORRESULT Error = __NMEA0183_CheckLine(pLine, length, &PosCRC, &Size, &FieldPos, 1, &FieldCount); // The first ',' is found while checking the checksum
+  if (Error != ERR_OK) return Error;
+
+  //--- Address field ---
+  const char* pField = (FieldCount != 0 ? &pLine[FieldPos] : (const char*)memchr(&pLine[1], NMEA0183_FIELD_DELIMITER, PosCRC - 1)); // An address longer than 255 chars is searched
+  if (pField == NULL) return ERR__PARSE_ERROR;                            // The frame shall contain at least the address field and a field delimiter
+  *pTalkerID   = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pLine[1], pLine[2]);
+  *pSentenceID = NMEA0183_UNKNOWN;
+  if (pField == &pLine[NMEA0183_SENTENCE_FIELDS_POS - 1])                 // Address of 5 characters: Talker ID + Sentence ID
+    *pSentenceID = (eNMEA0183_SentencesID)NMEA0183_SENTENCE_ID(pLine[3], pLine[4], pLine[5]);
+  *ppFields = pField + 1;                                                 // The first field is after the address field
+  return ERR_OK;
+}
+
 
-  //--- Get Time ---
-  if (__NMEA0183_ExtractTime(&pStr, &pData->Time) == false) return ERR__PARSE_ERROR; //*** Get time
 
-  //--- Get Status ---
-  pData->Status = *pStr;                                             //*** Get status: A=Active=Good ; V=Void=NotGood
-  ++pStr;                                                            // Parsing: Skip <A/V>
-  NMEA0183_CHECK_FIELD_DELIMITER;
+//=============================================================================
+// Process the NMEA0183 frame string line
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessLine(const char* string, NMEA0183_DecodedData* pData)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((string == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  pData->ParseIsValid = false;
+  if (string[0] != NMEA0183_START_DELIMITER) return ERR__BAD_FRAME_TYPE;  // The frame shall start with '$'
 
-  //--- Get Latitude and Longitude ---
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->Latitude ) == false) return ERR__PARSE_ERROR; //*** Get latitude
-  if (__NMEA0183_ExtractCoordinate(&pStr, &pData->Longitude) == false) return ERR__PARSE_ERROR; //*** Get longitude
+  //--- Sentence known by this library ---
+  const NMEA0183_SentenceDecoder* pDecoder = __NMEA0183_LineDecoder(string);
+  if (pDecoder != NULL) return __NMEA0183_DecodeLine(string, pDecoder, pData); // Check the checksum while parsing the fields
 
-  //--- Get Speed ---
-  pData->Speed = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);      //*** Get speed <sss.ss[s][s]> (divide by 10^4 to get the real minute)
-  NMEA0183_CHECK_FIELD_DELIMITER;
+  //--- Frame control ---
+  size_t PosCRC, Size, FieldCount;
+  uint8_t FieldPos[NMEA0183_FIELD_INDEX_SIZE] = { 0 };
+  const eERRORRESULT Error = __NMEA0183_CheckString(string, &PosCRC, &Size, &FieldPos[0], NMEA0183_FIELD_INDEX_SIZE, &FieldCount); // The '\0' terminal and the ',' are found while checking the checksum
+  if (Error != ERR_OK) return Error;
 
-  //--- Get Track ---
-  pData->Track = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);      //*** Get track <ttt.tt[t][t]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
+  //--- Parse data ---
+  const NMEA0183_FieldsCursor Cursor = NMEA0183_FIELDS_CURSOR((FieldCount != 0 ? &string[FieldPos[0] + 1] : NULL), string, &FieldPos[0], FieldCount); // Without the first ',', the sentence decoder searches it. There is no '\0' before the '*'
+  return __NMEA0183_DecodeSentence(string, Size, &Cursor, pData);         // Process string sentence. Parsers stop at the '*' so they never read past the checksum
+}
 
-  //--- Get Date ---
-  pData->Date.Day   =  (uint8_t)__NMEA0183_StringToInt(&pStr, 2, 0); //*** Get and save day <dd>
-  pData->Date.Month =  (uint8_t)__NMEA0183_StringToInt(&pStr, 2, 0); //*** Get and save month <mm>
-  pData->Date.Year  = (uint16_t)__NMEA0183_StringToInt(&pStr, 2, 0); //*** Get and save year <yy>
-  NMEA0183_CHECK_FIELD_DELIMITER;
 
-  //--- Get Magnetic Variation ---
-  pData->Variation.Value = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 2); //*** Get track <vv.v[v]> (divide by 10^2 to get the real magnetic variation)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != NMEA0183_FIELD_DELIMITER)
-  {
-    pData->Variation.Direction = *pStr;                              //*** Get magnetic variation direction <E/W>
-    ++pStr;                                                          // Parsing: Skip <E/W>
-  } else pData->Variation.Direction = ' ';                           //*** Set magnetic variation direction not specified
 
-  if (*pStr == NMEA0183_FIELD_DELIMITER)
-  {
-    //--- Get FAA mode (if available) ---
-    ++pStr;                                                          // Parsing: Skip ','
-    if ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != NMEA0183_CHECKSUM_DELIMITER))
-    {
-      pData->FAAmode = *pStr;                                        //*** Get FAA mode <A/D/E/M/S/N>
-      ++pStr;                                                        // Parsing: Skip <A/D/E/M/S/N>
-    }
-    else pData->FAAmode = ' ';                                       //*** Set FAA mode not specified
-    if (*pStr == NMEA0183_FIELD_DELIMITER)
-    {
-      //--- Get Navigation Status (if available) ---
-      ++pStr;                                                        // Parsing: Skip ','
-      pData->NavigationStatus = *pStr;                               //*** Get Navigation Status <S/C/U/V>
-      ++pStr;                                                        // Parsing: Skip <S/C/U/V>
-    } else pData->NavigationStatus = ' ';                            //*** Set Navigation Status not specified
-  } else pData->FAAmode = ' ';                                       //*** Set FAA mode not specified
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR; // Should be a '*'
-  return ERR_OK;
-}
+//=============================================================================
+// Process the NMEA0183 frame line of a known length
+//=============================================================================
+eERRORRESULT NMEA0183_ProcessLineN(const char* pLine, size_t length, NMEA0183_DecodedData* pData)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pLine == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
 #endif
+  pData->ParseIsValid = false;
 
+  //--- Frame control ---
+  size_t PosCRC, Size, FieldCount;
+  uint8_t FieldPos[NMEA0183_FIELD_INDEX_SIZE] = { 0 };
+  const eERRORRESULT Error = __NMEA0183_CheckLine(pLine, length, &PosCRC, &Size, &FieldPos[0], NMEA0183_FIELD_INDEX_SIZE, &FieldCount); // The ',' are found while checking the checksum
+  if (Error != ERR_OK) return Error;
 
+  //--- Parse data ---
+  if ((FieldCount != 0) && (memchr(&pLine[1], '\0', FieldPos[0] - 1) != NULL)) FieldCount = 0; // A '\0' in the address field is a parse error, the sentence decoder searches the first ','
+  const NMEA0183_FieldsCursor Cursor = NMEA0183_FIELDS_CURSOR((FieldCount != 0 ? &pLine[FieldPos[0] + 1] : NULL), pLine, &FieldPos[0], FieldCount);
+  return __NMEA0183_DecodeSentence(pLine, Size, &Cursor, pData); // Process string sentence. Parsers stop at the '*' so they never read past the checksum
+}
 
-#ifdef NMEA0183_DECODE_TXT
+
+#ifdef NMEA0183_COMPACT_OUTPUT
 //=============================================================================
-// [STATIC] Process the TXT (Text Transmission) sentence
+// Process the NMEA0183 frame line of a known length in a compact record
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessTXT(const char* pSentence, NMEA0183_TXTdata* pData)
-{ // Format: $--TXT,<Total:tt>,<Curr:cc>,<TextID:ii>,<Text>,*<CheckSum>
-  char* pStr = (char*)pSentence;
-  eERRORRESULT Error = ERR_OK;
-  pData->TextMessage[0] = '\0';
+eERRORRESULT NMEA0183_ProcessLineCompact(const char* pLine, size_t length, void* pRecord, size_t size, size_t* pRecordSize)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pLine == NULL) || (pRecord == NULL) || (pRecordSize == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  NMEA0183_CompactHeader* pHeader = (NMEA0183_CompactHeader*)pRecord;
+  *pRecordSize = 0;
 
-  //--- Get message informations ---
-  pData->TotalSentence  = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save total sentence <tt>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->SentenceNumber = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save sequence number <cc>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->TextIdentifier = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save text identifier <ii>
-  NMEA0183_CHECK_FIELD_DELIMITER;
+  //--- Frame control ---
+  size_t PosCRC, Size, FieldCount;
+  uint8_t FieldPos[NMEA0183_FIELD_INDEX_SIZE] = { 0 };
+  eERRORRESULT Error = __NMEA0183_CheckLine(pLine, length, &PosCRC, &Size, &FieldPos[0], NMEA0183_FIELD_INDEX_SIZE, &FieldCount); // The ',' are found while checking the checksum
+  if (Error != ERR_OK) return Error;
+  if ((Size < NMEA0183_SENTENCE_FIELDS_POS) || (FieldCount == 0)) return ERR__PARSE_ERROR;   // The frame shall contain at least the address field and a field delimiter
+  if (memchr(&pLine[1], '\0', FieldPos[0] - 1) != NULL) return ERR__PARSE_ERROR;              // A '\0' in the address field is a parse error
+  if (size < sizeof(NMEA0183_CompactHeader)) return ERR__BUFFER_FULL;
+  pHeader->TalkerID   = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pLine[1], pLine[2]);             // Extract talker ID
+  pHeader->SentenceID = (eNMEA0183_SentencesID)NMEA0183_SENTENCE_ID(pLine[3], pLine[4], pLine[5]); // Extract sentence ID
 
-  //--- Get text of the message ---
-  size_t TxtPos = 0;
-  while (TxtPos < NMEA0183_TXT_MESSAGE_MAX_SIZE)
+  //--- Parse sentence ---
+  if (FieldPos[0] == (NMEA0183_SENTENCE_FIELDS_POS - 1))                                      // Address of 5 characters: Talker ID + Sentence ID
   {
-    if ((*pStr == '\0') || (*pStr == NMEA0183_CHECKSUM_DELIMITER)) break;
-    if (*pStr != NMEA0183_CHAR_HEX_DELIMITER)
-    {
-      pData->TextMessage[TxtPos] = *pStr; //*** Get char
-      ++pStr;
-    }
-    else                                  // '^' detected
+    const NMEA0183_SentenceDecoder* pDecoder = &__NMEA0183_SentenceDecoders[NMEA0183_SENTENCE_HASH(pHeader->SentenceID)];
+    if ((pDecoder->fnCompact != NULL) && (pDecoder->SentenceID == (uint32_t)pHeader->SentenceID)) // Sentence known by this library?
     {
-      ++pStr;
-      if ((*pStr == '\0') || (*pStr == NMEA0183_CHECKSUM_DELIMITER))
-      { Error = ERR__PARSE_ERROR; break; }
-      pData->TextMessage[TxtPos] = (char)__NMEA0183_HexStringToUint(&pStr, 2); //*** Get hex encoded char (2 hex chars to decode)
+      const NMEA0183_FieldsCursor Cursor = NMEA0183_FIELDS_CURSOR(&pLine[NMEA0183_SENTENCE_FIELDS_POS], pLine, &FieldPos[0], FieldCount);
+      Error = pDecoder->fnCompact(&Cursor, pHeader, size);                                    // Parse on the stack, set the present fields and copy only the data of the sentence
+      if (Error == ERR__BUFFER_FULL) return Error;
+      pHeader->ParseIsValid = (Error == ERR_OK ? 1 : 0);
+      *pRecordSize = NMEA0183_COMPACT_RECORD_SIZE(pHeader->PayloadSize);
+      return Error;
     }
-    ++TxtPos;
   }
-  pData->TextMessage[TxtPos] = '\0';
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) Error = ERR__PARSE_ERROR; // Should be a '*'
-  return Error;
+
+  //--- Sentence unknown by this library ---
+  if (Size > NMEA0183_DECODED_FRAME_SIZE) Size = NMEA0183_DECODED_FRAME_SIZE;
+  if (size < NMEA0183_COMPACT_RECORD_SIZE(Size)) return ERR__BUFFER_FULL;
+  memcpy(NMEA0183_COMPACT_PAYLOAD(pHeader), pLine, Size);                                     // Copy only the chars of the unknown frame for the user
+  pHeader->SentenceID   = NMEA0183_UNKNOWN;                                                   // Sentence ID unknown by this library. User needs to parse the payload externaly
+  pHeader->ParseIsValid = 0;
+  pHeader->PayloadSize  = (uint8_t)Size;
+#ifdef NMEA0183_PRESENT_FIELDS
+  pHeader->PresentFields = 0;
+#endif
+  *pRecordSize = NMEA0183_COMPACT_RECORD_SIZE(Size);
+  return ERR__UNKNOWN_ELEMENT;
 }
 #endif
 
 
-
-#ifdef NMEA0183_DECODE_VHW
+#ifdef NMEA0183_SENTENCE_HANDLERS
 //=============================================================================
-// [STATIC] Process the VHW (Water Speed and Heading) sentence
+// Dispatch the NMEA0183 frame line of a known length to its handler
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessVHW(const char* pSentence, NMEA0183_VHWdata* pData)
-{ // Format: $--VHW,<CourseTrue:t.t[t][t][t]>,T,<CourseMag:m.m[m][m][m]>,M,<SpeedKnots:k.k[k][k][k]>,N,<SpeedKmHr:h.h[h][h][h]>,K*<CheckSum>
-  char* pStr = (char*)pSentence;
+eERRORRESULT NMEA0183_DispatchLineN(const char* pLine, size_t length, const NMEA0183_SentenceHandler* pHandlers)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pLine == NULL) || (pHandlers == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  //--- Frame control ---
+  size_t PosCRC, Size, FieldCount;
+  uint8_t FieldPos[NMEA0183_FIELD_INDEX_SIZE] = { 0 };
+  const eERRORRESULT Error = __NMEA0183_CheckLine(pLine, length, &PosCRC, &Size, &FieldPos[0], NMEA0183_FIELD_INDEX_SIZE, &FieldCount); // The ',' are found while checking the checksum
+  if (Error != ERR_OK) return Error;
 
-  //--- Get Heading ---
-  pData->HeadingTrue = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);     //*** Get heading in degrees True <ttt.t[t][t][t]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'T') return ERR__PARSE_ERROR;                              // Parsing: Should be 'T'
-  ++pStr;                                                                 // Parsing: Skip 'T'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->HeadingMagnetic = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4); //*** Get heading in degrees Magnetic <mmm.m[m][m][m]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'M') return ERR__PARSE_ERROR;                              // Parsing: Should be 'M'
-  ++pStr;                                                                 // Parsing: Skip 'M'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Speed ---
-  pData->SpeedKnots = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);      //*** Get speed over the ground in knots <kkk.k[k][k][k]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'N') return ERR__PARSE_ERROR;                              // Parsing: Should be 'N'
-  ++pStr;                                                                 // Parsing: Skip 'N'
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->SpeedKmHr = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);       //*** Get speed over the ground in km/hr <hhh.h[h][h][h]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr != 'K') return ERR__PARSE_ERROR;                              // Parsing: Should be 'K'
-  ++pStr;                                                                 // Parsing: Skip 'K'
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;      // Should be a '*'
-  return ERR_OK;
+  //--- Parse data ---
+  const NMEA0183_FieldsCursor Cursor = NMEA0183_FIELDS_CURSOR((FieldCount != 0 ? &pLine[FieldPos[0] + 1] : NULL), pLine, &FieldPos[0], FieldCount);
+  return __NMEA0183_DispatchSentence(pLine, Size, &Cursor, pHandlers);
 }
 #endif
 
+//-----------------------------------------------------------------------------
+
 
 
-#ifdef NMEA0183_DECODE_VTG
+
+
+#ifdef NMEA0183_RING_FRAMER
+//********************************************************************************************************************
+// NMEA0183 ring framer API
+//********************************************************************************************************************
+#define NMEA0183_RING_NEXT(pFramer, pos)  ( (pos) + 1 < (pFramer)->RingSize ? (pos) + 1 : 0 ) // Next position in the ring
+
 //=============================================================================
-// [STATIC] Process the VTG (Course Over Ground and Ground Speed) sentence
+// Initialize a NMEA0183 ring framer
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessVTG(const char* pSentence, NMEA0183_VTGdata* pData)
-{ // Format: $--VTG,<CourseTrue:t.t[t][t][t]>[,T],<CourseMag:m.m[m][m][m]>[,M],<SpeedKnots:k.k[k][k][k]>[,N],<SpeedKmHr:h.h[h][h][h]>[,K][,<FAA:A/D/E/M/S/N>]*<CheckSum>
-  char* pStr = (char*)pSentence;
+eERRORRESULT Init_NMEA0183RingFramer(NMEA0183_RingFramer* pFramer, const char* pRing, size_t ringSize)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pFramer == NULL) || (pRing == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  if (ringSize < (NMEA0183_FRAME_BUFFER_SIZE + 2)) return ERR__PARAMETER_ERROR; // The longest frame, its end delimiter and the free char of a full ring shall fit
+  memset(pFramer, 0, sizeof(NMEA0183_RingFramer));
+  pFramer->pRing      = pRing;
+  pFramer->RingSize   = ringSize;
+  pFramer->FrameStart = NMEA0183_RING_NO_FRAME;
+  return ERR_OK;
+}
+
+
+//=============================================================================
+// [STATIC] Give the frame from its start delimiter to a position of the ring
+//=============================================================================
+static void __NMEA0183_RingFramer_SetSpan(NMEA0183_RingFramer* pFramer, size_t endPos, NMEA0183_RingSpan* pSpan)
+{
+  const size_t Start = pFramer->FrameStart;
+  pSpan->pFirst = &pFramer->pRing[Start];
+  if (endPos >= Start)                                                      // The frame does not wrap
+  {
+    pSpan->FirstSize  = endPos - Start;
+    pSpan->pSecond    = NULL;
+    pSpan->SecondSize = 0;
+  }
+  else
+  {
+    pSpan->FirstSize  = pFramer->RingSize - Start;
+    pSpan->pSecond    = &pFramer->pRing[0];
+    pSpan->SecondSize = endPos;
+  }
+  pFramer->ReadPos      = Start;                                            // The frame is kept until it is released
+  pFramer->FrameStart   = NMEA0183_RING_NO_FRAME;
+  pFramer->FramePending = true;
+}
+
+
+//=============================================================================
+// Get the next frame of the ring buffer
+//=============================================================================
+eERRORRESULT NMEA0183_RingFramer_GetFrame(NMEA0183_RingFramer* pFramer, size_t writePos, NMEA0183_RingSpan* pSpan)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pFramer == NULL) || (pSpan == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  if (writePos >= pFramer->RingSize) return ERR__PARAMETER_ERROR;
+  if (pFramer->FramePending) return ERR__BUSY;                              // The previous frame shall be released first
 
-  //--- Get Course ---
-  pData->CourseTrue     = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4); //*** Get course over ground in degrees True <ttt.t[t][t][t]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr == 'T') { ++pStr; NMEA0183_CHECK_FIELD_DELIMITER; }          // Parsing: Can be 'T' in new frame so, skip 'T'
-  pData->CourseMagnetic = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4); //*** Get course over ground in degrees Magnetic <mmm.m[m][m][m]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr == 'M') { ++pStr; NMEA0183_CHECK_FIELD_DELIMITER; }          // Parsing: Can be 'M' in new frame so, skip 'M'
-
-  //--- Get Speed ---
-  pData->SpeedKnots = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);     //*** Get speed over the ground in knots <kkk.k[k][k][k]> (divide by 10^4 to get the real track)
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  if (*pStr == 'N') { ++pStr; NMEA0183_CHECK_FIELD_DELIMITER; }          // Parsing: Can be 'N' in new frame so, skip 'N'
-  pData->SpeedKmHr = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 4);      //*** Get speed over the ground in km/hr <hhh.h[h][h][h]> (divide by 10^4 to get the real track)
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER)
-  {
-    NMEA0183_CHECK_FIELD_DELIMITER;
-    if (*pStr == 'K') { ++pStr; }                                        // Parsing: Can be 'K' in new frame so, skip 'K'
-
-    if (*pStr != NMEA0183_CHECKSUM_DELIMITER)
+  //--- Scan the characters received ---
+  const char* const pRing = pFramer->pRing;
+  while (pFramer->ScanPos != writePos)
+  {
+    const size_t Pos = pFramer->ScanPos;
+    if (pFramer->FrameStart == NMEA0183_RING_NO_FRAME)                      // Outside a frame? Nothing to keep until the next '$'
+    {
+      if (pFramer->FrameOverflow)                                           // Rest of a frame too long? Skip it up to its end delimiter or the next start delimiter
+      {
+        const char Current = pRing[Pos];
+        pFramer->ScanPos = NMEA0183_RING_NEXT(pFramer, Pos);
+        if ((Current == NMEA0183_END_CR_DELIMITER) || (Current == NMEA0183_END_LF_DELIMITER)) pFramer->FrameOverflow = false;
+        if ((Current == NMEA0183_START_DELIMITER) || (Current == NMEA0183_START_ENCAPSULATION_DELIMITER))
+        {
+          ++pFramer->ResyncCount;                                           // The end delimiter of the frame was lost, counted as in the receive path
+          pFramer->FrameOverflow = false;
+          if (Current == NMEA0183_START_DELIMITER) pFramer->FrameStart = Pos; // Encapsulation sentences are skipped
+        }
+        continue;
+      }
+      const size_t End = (writePos > Pos ? writePos : pFramer->RingSize);   // Contiguous characters up to the write position or the end of the ring
+      const char* pStart = (const char*)memchr(&pRing[Pos], NMEA0183_START_DELIMITER, End - Pos);
+      if (pStart == NULL) { pFramer->ScanPos = (End < pFramer->RingSize ? End : 0); continue; }
+      pFramer->FrameStart = (size_t)(pStart - pRing);
+      pFramer->ScanPos    = NMEA0183_RING_NEXT(pFramer, pFramer->FrameStart);
+      continue;
+    }
+    const char Current = pRing[Pos];
+    const size_t Length = (Pos >= pFramer->FrameStart ? Pos - pFramer->FrameStart : pFramer->RingSize - pFramer->FrameStart + Pos); // Chars of the frame before the current one
+    if ((Current == NMEA0183_END_CR_DELIMITER) || (Current == NMEA0183_END_LF_DELIMITER))
+    {
+      pFramer->ScanPos = NMEA0183_RING_NEXT(pFramer, Pos);
+      __NMEA0183_RingFramer_SetSpan(pFramer, Pos, pSpan);
+      return ERR_OK;
+    }
+    if ((Current == NMEA0183_START_DELIMITER) || (Current == NMEA0183_START_ENCAPSULATION_DELIMITER))
+    {
+      ++pFramer->ResyncCount;                                               // The end delimiter of the frame was lost
+      const size_t PosStar = (Pos >= 3 ? Pos - 3 : pFramer->RingSize + Pos - 3);
+      if ((Length > 3) && (pRing[PosStar] == NMEA0183_CHECKSUM_DELIMITER))  // The checksum is complete? Give the frame, the start delimiter is scanned next
+      {
+        __NMEA0183_RingFramer_SetSpan(pFramer, Pos, pSpan);
+        return ERR_OK;
+      }
+      pFramer->FrameStart = (Current == NMEA0183_START_DELIMITER ? Pos : NMEA0183_RING_NO_FRAME); // Encapsulation sentences are skipped
+      pFramer->ScanPos    = NMEA0183_RING_NEXT(pFramer, Pos);
+      continue;
+    }
+    pFramer->ScanPos = NMEA0183_RING_NEXT(pFramer, Pos);
+    if (Length >= NMEA0183_FRAME_BUFFER_SIZE)                               // The frame is longer than the frame buffer
     {
-      NMEA0183_CHECK_FIELD_DELIMITER;
-      //--- Get FAA mode ---
-      pData->FAAmode = *pStr;                                            //*** Get FAA mode <A/D/E/M/S/N>
-      ++pStr;                                                            // Parsing: Skip <A/D/E/M/S/N>
+      pFramer->FrameStart    = NMEA0183_RING_NO_FRAME;
+      pFramer->FrameOverflow = true;                                        // The rest of the frame is skipped
+      pFramer->ReadPos       = pFramer->ScanPos;
+      return ERR__BUFFER_FULL;
     }
   }
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;     // Should be a '*'
-  return ERR_OK;
+  pFramer->ReadPos = (pFramer->FrameStart != NMEA0183_RING_NO_FRAME ? pFramer->FrameStart : pFramer->ScanPos); // Only the frame being scanned is kept
+  return ERR__NO_DATA_AVAILABLE;
 }
+
+
+//=============================================================================
+// Process a NMEA0183 frame of the ring buffer
+//=============================================================================
+eERRORRESULT NMEA0183_RingFramer_ProcessFrame(NMEA0183_RingFramer* pFramer, const NMEA0183_RingSpan* pSpan, NMEA0183_DecodedData* pData)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pFramer == NULL) || (pSpan == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
 #endif
+  if (pSpan->SecondSize == 0) return NMEA0183_ProcessLineN(pSpan->pFirst, pSpan->FirstSize, pData); // Parse in place in the ring
+  const size_t Size = pSpan->FirstSize + pSpan->SecondSize;
+  if (Size > NMEA0183_FRAME_BUFFER_SIZE) return ERR__BUFFER_FULL;
+  memcpy(&pFramer->WrapFrame[0], pSpan->pFirst, pSpan->FirstSize);          // The frame wraps around the end of the ring, make it contiguous for the parsers
+  memcpy(&pFramer->WrapFrame[pSpan->FirstSize], pSpan->pSecond, pSpan->SecondSize);
+  return NMEA0183_ProcessLineN(&pFramer->WrapFrame[0], Size, pData);
+}
 
 
+//=============================================================================
+// Release the frame given by NMEA0183_RingFramer_GetFrame()
+//=============================================================================
+eERRORRESULT NMEA0183_RingFramer_ReleaseFrame(NMEA0183_RingFramer* pFramer)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pFramer == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  pFramer->FramePending = false;
+  pFramer->ReadPos = (pFramer->FrameStart != NMEA0183_RING_NO_FRAME ? pFramer->FrameStart : pFramer->ScanPos);
+  return ERR_OK;
+}
+
 
-#ifdef NMEA0183_DECODE_ZDA
 //=============================================================================
-// [STATIC] Process the ZDA (Time & Date) sentence
+// Get the read position of the ring framer
 //=============================================================================
-static eERRORRESULT NMEA0183_ProcessZDA(const char* pSentence, NMEA0183_ZDAdata* pData)
-{ // Format: $--ZDA,<hhmmss.zzz>,<Day:dd>,<Month:mm>,<Year:yyyy>,<LocalHour:(-)hh>,<LocalMinute:mm>*<CheckSum>
-  char* pStr = (char*)pSentence;
+size_t NMEA0183_RingFramer_GetReadPos(NMEA0183_RingFramer* pFramer)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pFramer == NULL) return 0;
+#endif
+  return pFramer->ReadPos;
+}
 
-  //--- Get Time ---
-  if (__NMEA0183_ExtractTime(&pStr, &pData->Time) == false) return ERR__PARSE_ERROR; //*** Get time
-
-  //--- Get Date ---
-  pData->Date.Day   =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0);     //*** Get and save day <dd>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->Date.Month =  (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0);     //*** Get and save month <mm>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->Date.Year  = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 0);     //*** Get and save year <yyyy>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-
-  //--- Get Local Zone Time ---
-  const bool IsNegativeLocalTime = (*pStr == '-');
-  pData->LocalZoneHour   =  (int8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save local zone hour <(-)hh>
-  NMEA0183_CHECK_FIELD_DELIMITER;
-  pData->LocalZoneMinute = (uint8_t)__NMEA0183_StringToInt(&pStr, 0, 0); //*** Get and save local zone minute <mm>
-  if (IsNegativeLocalTime && (pData->LocalZoneHour == 0))
-    pData->LocalZoneMinute = -pData->LocalZoneMinute;                    // Set LocalZoneMinute negative in case of -00 of LocalZoneHour
-
-  if (*pStr != NMEA0183_CHECKSUM_DELIMITER) return ERR__PARSE_ERROR;     // Should be a '*'
+
+//=============================================================================
+// Get the count of resynchronizations of the ring framer
+//=============================================================================
+eERRORRESULT NMEA0183_RingFramer_GetResyncCount(NMEA0183_RingFramer* pFramer, uint32_t* pCount)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pFramer == NULL) || (pCount == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  *pCount = pFramer->ResyncCount;
   return ERR_OK;
 }
 #endif
@@ -1280,199 +3723,147 @@ static eERRORRESULT NMEA0183_ProcessZDA(const char* pSentence, NMEA0183_ZDAdata*
 
 
 
-//**********************************************************************************************************************************************************
-#ifdef NMEA0183_USE_INPUT_BUFFER
+//********************************************************************************************************************
+// NMEA0183 sentence view API
+//********************************************************************************************************************
 //=============================================================================
-// Get decoder state
+// Initialize a sentence view on a NMEA0183 line
 //=============================================================================
-eNMEA0183_State NMEA0183_GetDecoderState(NMEA0183_DecodeInput* pDecoder)
+eERRORRESULT Init_NMEA0183SentenceView(NMEA0183_SentenceView* pView, const char* pLine, size_t length)
 {
 #ifdef CHECK_NULL_PARAM
-    if (pDecoder == NULL) return false;
+  if ((pView == NULL) || (pLine == NULL)) return ERR__PARAMETER_ERROR;
 #endif
-    return pDecoder->State;
+  pView->pSentence  = pLine;
+  pView->FieldCount = 0;
+
+  //--- Frame control and tokenize fields ---
+  size_t PosCRC, Size, FieldCount;
+  const eERRORRESULT Error = __NMEA0183_CheckLine(pLine, length, &PosCRC, &Size, &pView->FieldPos[0], NMEA0183_SENTENCE_VIEW_FIELDS_MAX + 1, &FieldCount); // Save the position of each field delimiter ',' while checking the checksum
+  if (Error != ERR_OK) return Error;
+  if (PosCRC >= NMEA0183_FRAME_BUFFER_SIZE) return ERR__BUFFER_FULL;         // The frame is longer than the NMEA0183 standard
+  if (FieldCount == 0) return ERR__PARSE_ERROR;                             // The frame shall contain at least the address field and a field delimiter
+  if (FieldCount > NMEA0183_SENTENCE_VIEW_FIELDS_MAX) return ERR__BUFFER_FULL; // Too many fields for the view
+
+  //--- Address field ---
+  pView->AddressSize = (uint8_t)(pView->FieldPos[0] - 1);
+  pView->TalkerID    = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pLine[1], pLine[2]);
+  pView->SentenceID  = NMEA0183_UNKNOWN;
+  if (pView->AddressSize == 5) pView->SentenceID = (eNMEA0183_SentencesID)NMEA0183_SENTENCE_ID(pLine[3], pLine[4], pLine[5]);
+  pView->FieldPos[FieldCount] = (uint8_t)PosCRC;                            // The last field ends at the '*'
+  pView->FieldCount = (uint8_t)FieldCount;
+  return ERR_OK;
 }
 
 
 //=============================================================================
-// Is a frame ready to process?
+// Get a raw field of the sentence view
 //=============================================================================
-bool NMEA0183_IsFrameReadyToProcess(NMEA0183_DecodeInput* pDecoder)
+eERRORRESULT NMEA0183_SentenceView_GetField(const NMEA0183_SentenceView* pView, size_t field, const char** ppField, size_t* pSize)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pDecoder == NULL) return false;
+  if ((pView == NULL) || (ppField == NULL) || (pSize == NULL)) return ERR__PARAMETER_ERROR;
 #endif
-  return pDecoder->State == NMEA0183_TO_PROCESS;
+  if (field >= pView->FieldCount) return ERR__OUT_OF_RANGE;                 // The sentence does not have this field
+  const size_t FieldPos = (size_t)pView->FieldPos[field] + 1;               // Skip the ','
+  *ppField = &pView->pSentence[FieldPos];
+  *pSize   = (size_t)pView->FieldPos[field + 1] - FieldPos;
+  return ERR_OK;
 }
-#endif
 
 
 //=============================================================================
-// [STATIC] Decode the NMEA0183 sentence
+// Get the char of a field of the sentence view
 //=============================================================================
-static eERRORRESULT __NMEA0183_DecodeSentence(const char* pRaw, NMEA0183_DecodedData* pData)
+eERRORRESULT NMEA0183_SentenceView_GetChar(const NMEA0183_SentenceView* pView, size_t field, char* pValue)
 {
-  eERRORRESULT Error = ERR_OK;
+#ifdef CHECK_NULL_PARAM
+  if (pValue == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  const char* pField;
+  size_t Size;
+  const eERRORRESULT Error = NMEA0183_SentenceView_GetField(pView, field, &pField, &Size);
+  if (Error != ERR_OK) return Error;
+  if (Size == 0) return ERR__EMPTY_DATA;
+  if (Size != 1) return ERR__PARSE_ERROR;                                   // The field shall be only one char
+  *pValue = pField[0];
+  return ERR_OK;
+}
 
-  //--- Select sentence ---
-  char* pStr = (char*)&pRaw[1];                                                               // Parsing: Skip the '$' (start delimiter)
-  pData->TalkerID   = (eNMEA0183_TalkerID)NMEA0183_TALKER_ID(pStr[0], pStr[1]);               // Extract talker ID
-  pData->SentenceID = (eNMEA0183_SentencesID)NMEA0183_SENTENCE_ID(pStr[2], pStr[3], pStr[4]); // Extract sentence ID
-  pStr += 5;                                                                                  // Skip Talker and Sentence IDs
-  if (*pStr != NMEA0183_FIELD_DELIMITER) pData->SentenceID = NMEA0183_UNKNOWN;                // Sentence ID >3 chars so unknown by this library. User needs to parce externaly
-  while ((*pStr != NMEA0183_FIELD_DELIMITER) && (*pStr != 0)) ++pStr;                         // Go to the end of the field or the end of the string
-  if (*pStr != NMEA0183_FIELD_DELIMITER) return ERR__PARSE_ERROR; ++pStr;                     // Check field delimiter
 
-  //--- Parse sentence ---
-  switch (pData->SentenceID)
-  {
-#ifdef NMEA0183_DECODE_AAM
-    case NMEA0183_AAM: Error = NMEA0183_ProcessAAM(pStr, &pData->AAM); break;
-#endif
-#ifdef NMEA0183_DECODE_ALM
-    case NMEA0183_ALM: Error = NMEA0183_ProcessALM(pStr, &pData->ALM); break;
-#endif
-#ifdef NMEA0183_DECODE_APB
-    case NMEA0183_APB: Error = NMEA0183_ProcessAPB(pStr, &pData->APB); break;
-#endif
-#ifdef NMEA0183_DECODE_BEC
-    case NMEA0183_BEC: Error = NMEA0183_ProcessBEC(pStr, &pData->BEC); break;
-#endif
-#ifdef NMEA0183_DECODE_BOD
-    case NMEA0183_BOD: Error = NMEA0183_ProcessBOD(pStr, &pData->BOD); break;
-#endif
-#ifdef NMEA0183_DECODE_BWW
-    case NMEA0183_BWW: Error = NMEA0183_ProcessBWW(pStr, &pData->BWW); break;
-#endif
-#ifdef NMEA0183_DECODE_DBK
-    case NMEA0183_DBK: Error = NMEA0183_ProcessDBx(pStr, &pData->DBK); break;
-#endif
-#ifdef NMEA0183_DECODE_DBS
-    case NMEA0183_DBS: Error = NMEA0183_ProcessDBx(pStr, &pData->DBS); break;
-#endif
-#ifdef NMEA0183_DECODE_DBT
-    case NMEA0183_DBT: Error = NMEA0183_ProcessDBx(pStr, &pData->DBT); break;
-#endif
-#ifdef NMEA0183_DECODE_DPT
-    case NMEA0183_DPT: Error = NMEA0183_ProcessDPT(pStr, &pData->DPT); break;
-#endif
-#ifdef NMEA0183_DECODE_FSI
-    case NMEA0183_FSI: Error = NMEA0183_ProcessFSI(pStr, &pData->FSI); break;
-#endif
-#ifdef NMEA0183_DECODE_GGA
-    case NMEA0183_GGA: Error = NMEA0183_ProcessGGA(pStr, &pData->GGA); break;
-#endif
-#ifdef NMEA0183_DECODE_GLL
-    case NMEA0183_GLL: Error = NMEA0183_ProcessGLL(pStr, &pData->GLL); break;
-#endif
-#ifdef NMEA0183_DECODE_GSA
-    case NMEA0183_GSA: Error = NMEA0183_ProcessGSA(pStr, &pData->GSA); break;
-#endif
-#ifdef NMEA0183_DECODE_GSV
-    case NMEA0183_GSV: Error = NMEA0183_ProcessGSV(pStr, &pData->GSV); break;
-#endif
-#ifdef NMEA0183_DECODE_HDG
-    case NMEA0183_HDG: Error = NMEA0183_ProcessHDG(pStr, &pData->HDG); break;
-#endif
-#ifdef NMEA0183_DECODE_HDM
-    case NMEA0183_HDM: Error = NMEA0183_ProcessHDM(pStr, &pData->HDM); break;
-#endif
-#ifdef NMEA0183_DECODE_HDT
-    case NMEA0183_HDT: Error = NMEA0183_ProcessHDT(pStr, &pData->HDT); break;
-#endif
-#ifdef NMEA0183_DECODE_MTW
-    case NMEA0183_MTW: Error = NMEA0183_ProcessMTW(pStr, &pData->MTW); break;
-#endif
-#ifdef NMEA0183_DECODE_MWV
-    case NMEA0183_MWV: Error = NMEA0183_ProcessMWV(pStr, &pData->MWV); break;
-#endif
-#ifdef NMEA0183_DECODE_RMC
-    case NMEA0183_RMC: Error = NMEA0183_ProcessRMC(pStr, &pData->RMC); break;
-#endif
-#ifdef NMEA0183_DECODE_VHW
-    case NMEA0183_VHW: Error = NMEA0183_ProcessVHW(pStr, &pData->VHW); break;
-#endif
-#ifdef NMEA0183_DECODE_VTG
-    case NMEA0183_VTG: Error = NMEA0183_ProcessVTG(pStr, &pData->VTG); break;
-#endif
-#ifdef NMEA0183_DECODE_TXT
-    case NMEA0183_TXT: Error = NMEA0183_ProcessTXT(pStr, &pData->TXT); break;
-#endif
-#ifdef NMEA0183_DECODE_ZDA
-    case NMEA0183_ZDA: Error = NMEA0183_ProcessZDA(pStr, &pData->ZDA); break;
+//=============================================================================
+// Get the integer value of a field of the sentence view
+//=============================================================================
+eERRORRESULT NMEA0183_SentenceView_GetInt(const NMEA0183_SentenceView* pView, size_t field, size_t digits, int32_t* pValue)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pValue == NULL) return ERR__PARAMETER_ERROR;
 #endif
-
-    default:
-      memcpy(&pData->Frame[0], pRaw, NMEA0183_FRAME_BUFFER_SIZE); // Copy the whole unknown frame for the user
-      pData->SentenceID = NMEA0183_UNKNOWN;                       // Sentence ID unknown by this library. User needs to parce externaly
-      Error = ERR__UNKNOWN_ELEMENT;
-  }
-  pData->ParseIsValid = (Error == ERR_OK);
-  return Error;
+  const char* pField;
+  size_t Size;
+  const eERRORRESULT Error = NMEA0183_SentenceView_GetField(pView, field, &pField, &Size);
+  if (Error != ERR_OK) return Error;
+  if (Size == 0) return ERR__EMPTY_DATA;
+  char* pStr = (char*)pField;
+  *pValue = __NMEA0183_StringToInt(&pStr, 0, digits);                       // Stops at the ',' or the '*' that ends the field
+  return ERR_OK;
 }
 
 
-#ifdef NMEA0183_USE_INPUT_BUFFER
 //=============================================================================
-// Process the NMEA0183 frame (used with the decode structure)
+// Get the coordinate of a field of the sentence view
 //=============================================================================
-eERRORRESULT NMEA0183_ProcessFrame(NMEA0183_DecodeInput* pDecoder, NMEA0183_DecodedData* pData)
+eERRORRESULT NMEA0183_SentenceView_GetCoordinate(const NMEA0183_SentenceView* pView, size_t field, NMEA0183_Coordinate* pValue)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pDecoder == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
+  if (pValue == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  eERRORRESULT Error = ERR_OK;
-  pData->ParseIsValid = false;
-  pDecoder->State = NMEA0183_IN_PROCESS;                                  //Frame is in process
-
-  //--- Frame control ---
-  if (pDecoder->RawFrame[0] != NMEA0183_START_DELIMITER)                  // The frame shall start with '$'
-  {
-    pDecoder->State = NMEA0183_WAIT_START;                                // Frame is Processed, wait for a new frame
-    return ERR__BAD_FRAME_TYPE;
-  }
-  char* pCRC = &pDecoder->CRC[0];
-  const uint8_t FrameCRC = (uint8_t)__NMEA0183_HexStringToUint(&pCRC, 2); // Get frame CRC
-  if (FrameCRC != pDecoder->CurrCalcCRC)
+  const char* pField;
+  size_t Size;
+  eERRORRESULT Error = NMEA0183_SentenceView_GetField(pView, field + 1, &pField, &Size); // Direction field <N/S or E/W>
+  if (Error != ERR_OK) return Error;
+  pValue->Direction = (Size > 0 ? pField[0] : ' ');
+  Error = NMEA0183_SentenceView_GetField(pView, field, &pField, &Size);     // Coordinate field <(d)ddmm.mmmm[m][m][m]>
+  if (Error != ERR_OK) return Error;
+  if (Size == 0)
   {
-    pDecoder->State = NMEA0183_WAIT_START;                                // Frame is Processed, wait for a new frame
-    return ERR__CRC_ERROR;                                                // The frame CRC shall correspond to the one calculated
+    pValue->Degree = (uint8_t)NMEA0183_NO_VALUE;
+    pValue->Minute = (uint32_t)NMEA0183_NO_VALUE;
+    return ERR__EMPTY_DATA;
   }
-
-  //--- Parse data ---
-  Error = __NMEA0183_DecodeSentence(&pDecoder->RawFrame[0], pData);       // Process string sentence
-  pDecoder->State = NMEA0183_WAIT_START;                                  // Frame is Processed, wait for a new frame
-  return Error;
+  char* pStr = (char*)pField;
+  const int32_t Value = __NMEA0183_StringToInt(&pStr, '.', 0);              //*** Get degree and minute <(d)ddmm>
+  pValue->Degree = (uint8_t)(Value / 100);                                  //    And save degree
+  pValue->Minute = (uint32_t)__NMEA0183_StringToInt(&pStr, 0, 7);           //*** Get and save decimal minute <.mmmm[m][m][m]> (divide by 10^7 to get the real minute)
+  pValue->Minute += ((Value % 100) * 10000000);                             //    And save minute with decimal minute
+  return ERR_OK;
 }
-#endif
-//-----------------------------------------------------------------------------
-
 
 
 //=============================================================================
-// Process the NMEA0183 frame string line
+// Get the time of a field of the sentence view
 //=============================================================================
-eERRORRESULT NMEA0183_ProcessLine(const char* string, NMEA0183_DecodedData* pData)
+eERRORRESULT NMEA0183_SentenceView_GetTime(const NMEA0183_SentenceView* pView, size_t field, NMEA0183_Time* pValue)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pDecoder == NULL) || (pData == NULL)) return ERR__PARAMETER_ERROR;
+  if (pValue == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  eERRORRESULT Error = ERR_OK;
-  pData->ParseIsValid = false;
-  char* pStr = (char*)string;
-
-  //--- Frame control ---
-  if (*pStr != NMEA0183_START_DELIMITER) return ERR__BAD_FRAME_TYPE;      // The frame shall start with '$'
-  ++pStr;                                                                 // Parsing: Skip the '$' (start delimiter)
-  uint8_t CurrCalcCRC = 0;
-  while ((*pStr != NMEA0183_CHECKSUM_DELIMITER) && (*pStr != '\0')) { CurrCalcCRC ^= *pStr; ++pStr; } // Calculate CRC of the frame
-  if (*pStr == '\0') return ERR__CRC_ERROR;                               // The frame shall contain a '*' (checksum delimiter)
-  ++pStr;                                                                 // Parsing: Skip the '*' (checksum delimiter)
-  const uint8_t FrameCRC = (uint8_t)__NMEA0183_HexStringToUint(&pStr, 2); // Get frame CRC
-  if (FrameCRC != CurrCalcCRC) return ERR__CRC_ERROR;                     // The frame CRC shall correspond to the one calculated
-
-  //--- Parse data ---
-  return __NMEA0183_DecodeSentence(string, pData);                        // Process string sentence
+  const char* pField;
+  size_t Size;
+  const eERRORRESULT Error = NMEA0183_SentenceView_GetField(pView, field, &pField, &Size);
+  if (Error != ERR_OK) return Error;
+  if (Size == 0) return ERR__EMPTY_DATA;
+  if (Size < 6) return ERR__PARSE_ERROR;                                    // The field shall be at least <hhmmss>
+  char* pStr = (char*)pField;
+  pValue->Hour   = (uint8_t)__NMEA0183_StringToInt(&pStr, 2, 0);            //*** Get and save hour <hh>
+  pValue->Minute = (uint8_t)__NMEA0183_StringToInt(&pStr, 2, 0);            //*** Get and save minute <mm>
+  pValue->Second = (uint8_t)__NMEA0183_StringToInt(&pStr, 2, 0);            //*** Get and save second <ss>
+  if (*pStr == '.')                                                         // If the next char is '.' then there is a millisecond value to get
+  {
+    pValue->MilliS = (uint16_t)__NMEA0183_StringToInt(&pStr, 0, 3);         //*** Get and save milliseconds <zzz>
+  } else pValue->MilliS = (uint16_t)NMEA0183_NO_VALUE;                      // else set no value
+  if (pStr != &pField[Size]) return ERR__PARSE_ERROR;                       // Parsing: Should be the end of the field
+  return ERR_OK;
 }
 
 //-----------------------------------------------------------------------------
@@ -1747,7 +4138,7 @@ eERRORRESULT GPSdecoder::ProcessCharacter(const char data)
 //=============================================================================
 const char* const GPSdecoder::TrackToCardinal(double track) const
 {
-    static const char* const _DIRECTIONS[] = { "N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW", '\0' };
+    static const char* const _DIRECTIONS[] = { "N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW", NULL };
     if (isnan(track) || isfinite(track)) return _DIRECTIONS[16]; // Return nothing
     size_t Direction = (size_t)((track + 11.25) / 22.5);
     return _DIRECTIONS[Direction & 0xF];
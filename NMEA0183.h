@@ -49,13 +49,18 @@
 #include "ErrorsDef.h"
 //-----------------------------------------------------------------------------
 #ifdef __cplusplus
-#  define __NMEA0183_PACKED__
 #  ifdef ARDUINO
-#    define NMEA0183_PACKITEM           __attribute__((packed))
+#    define __NMEA0183_PACKED__         __attribute__((packed)) // The GCC attribute is only applied after the struct keyword
+#    define NMEA0183_PACKITEM
 #    define NMEA0183_UNPACKITEM
-#  else
+#  elif defined(_MSC_VER)
+#    define __NMEA0183_PACKED__
 #    define NMEA0183_PACKITEM           __pragma(pack(push, 1))
 #    define NMEA0183_UNPACKITEM         __pragma(pack(pop))
+#  else
+#    define __NMEA0183_PACKED__
+#    define NMEA0183_PACKITEM           _Pragma("pack(push, 1)")
+#    define NMEA0183_UNPACKITEM         _Pragma("pack(pop)")
 #  endif
 #  define NMEA0183_PACKENUM(name,type)  typedef enum name : type
 #  define NMEA0183_UNPACKENUM(name)     name
@@ -67,6 +72,24 @@ extern "C" {
 #  define NMEA0183_PACKENUM(name,type)  typedef enum __NMEA0183_PACKED__
 #  define NMEA0183_UNPACKENUM(name)     name
 #endif
+#ifdef NMEA0183_NATURAL_ALIGNMENT
+#  define NMEA0183_DATA_PACKITEM                                   // The decoded data structures are naturally aligned
+#  define NMEA0183_DATA_UNPACKITEM
+#  define __NMEA0183_DATA_PACKED__
+#else
+#  define NMEA0183_DATA_PACKITEM        NMEA0183_PACKITEM          // The decoded data structures are packed
+#  define NMEA0183_DATA_UNPACKITEM      NMEA0183_UNPACKITEM
+#  define __NMEA0183_DATA_PACKED__      __NMEA0183_PACKED__
+#endif
+#if defined(__cplusplus)
+#  define NMEA0183_STATIC_ASSERT(condition, message)  static_assert(condition, message)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#  define NMEA0183_STATIC_ASSERT(condition, message)  _Static_assert(condition, message)
+#else
+#  define NMEA0183_STATIC_ASSERT_NAME(line)           NMEA0183_STATIC_ASSERT_NAME2(line)
+#  define NMEA0183_STATIC_ASSERT_NAME2(line)          NMEA0183_StaticAssert_##line
+#  define NMEA0183_STATIC_ASSERT(condition, message)  typedef char NMEA0183_STATIC_ASSERT_NAME(__LINE__)[(condition) ? 1 : -1]
+#endif
 //-----------------------------------------------------------------------------
 
 //--- Reserved characters ---
@@ -83,7 +106,14 @@ extern "C" {
 
 //-----------------------------------------------------------------------------
 
-#define NMEA0183_FRAME_BUFFER_SIZE  ( 82+1 ) //! NMEA0183 frame buffer size (According to NMEA 3.01)
+#ifndef NMEA0183_FRAME_BUFFER_SIZE
+#  define NMEA0183_FRAME_BUFFER_SIZE  ( 82+1 ) //! NMEA0183 frame buffer size (According to NMEA 3.01)
+#endif
+#define NMEA0183_DECODED_FRAME_SIZE  ( 82+1 ) //! Size of the raw frame in the decoded data of an unknown sentence, independent of NMEA0183_FRAME_BUFFER_SIZE
+NMEA0183_STATIC_ASSERT((NMEA0183_FRAME_BUFFER_SIZE >= NMEA0183_DECODED_FRAME_SIZE) && (NMEA0183_FRAME_BUFFER_SIZE <= 255), "NMEA0183_FRAME_BUFFER_SIZE shall be between 83 and 255, the positions in the frame are recorded on 8 bits");
+#ifndef NMEA0183_FIELD_INDEX_SIZE
+#  define NMEA0183_FIELD_INDEX_SIZE  ( 24 )  //! Count of field delimiters ',' positions recorded while receiving a frame (enough for all the sentences decoded by this library)
+#endif
 #define NMEA0183_NO_VALUE     ( 0xFFFFFFFF ) //! No value or value in error
 
 //-----------------------------------------------------------------------------
@@ -202,53 +232,76 @@ NMEA0183_PACKENUM(eNMEA0183_SentencesID, uint32_t)
   NMEA0183_UNKNOWN = 0xFFFFFFFF,                      //!< Unknown delimiter (>3 characters)
 } NMEA0183_UNPACKENUM(eNMEA0183_SentencesID);
 
+//! Perfect hash of the sentence IDs decoded by this library, gives the slot of the sentence decoder in the dispatch table (each known sentence has its own slot)
+#define NMEA0183_SENTENCE_HASH(sentenceID)  ( (uint32_t)((uint32_t)(sentenceID) * 0x74A1379Du) >> 27u )
+#define NMEA0183_SENTENCE_HASH_SLOTS        ( 32 ) //! Count of slots of the sentence decoders dispatch table
+#define NMEA0183_SENTENCE_HASH_OTHERS       ( 31 ) //! Slot never used by a known sentence, stands for all the sentences unknown by this library
+
 //*****************************************************************************
 
 //! Time structure
-NMEA0183_PACKITEM
-typedef struct __NMEA0183_PACKED__ NMEA0183_Time
+NMEA0183_DATA_PACKITEM
+typedef struct __NMEA0183_DATA_PACKED__ NMEA0183_Time
 {
   uint8_t Hour;    //!< Hour extracted (0 to 23)
   uint8_t Minute;  //!< Minute extracted (0 to 59)
   uint8_t Second;  //!< Second extracted (0 to 59, 60 in case of leap second)
   uint16_t MilliS; //!< Millisecond extracted (0 to 999)
 } NMEA0183_Time;
-NMEA0183_UNPACKITEM;
+NMEA0183_DATA_UNPACKITEM;
 
 //-----------------------------------------------------------------------------
 
 //! Date structure
-NMEA0183_PACKITEM
-typedef struct __NMEA0183_PACKED__ NMEA0183_Date
+NMEA0183_DATA_PACKITEM
+typedef struct __NMEA0183_DATA_PACKED__ NMEA0183_Date
 {
   uint8_t Day;   //!< Day extracted (1 to 31 max)
   uint8_t Month; //!< Month extracted (1 to 12)
   uint16_t Year; //!< Second extracted (00 to 99 or 0000 to 9999)
 } NMEA0183_Date;
-NMEA0183_UNPACKITEM;
+NMEA0183_DATA_UNPACKITEM;
 
 //-----------------------------------------------------------------------------
 
-//! Latitude/Longitude coordinate structure
-NMEA0183_PACKITEM
-typedef struct __NMEA0183_PACKED__ NMEA0183_Coordinate
+//! Latitude/Longitude coordinate structure (with NMEA0183_NATURAL_ALIGNMENT, the Minute is first to be aligned on 4 bytes)
+NMEA0183_DATA_PACKITEM
+typedef struct __NMEA0183_DATA_PACKED__ NMEA0183_Coordinate
 {
+#ifdef NMEA0183_NATURAL_ALIGNMENT
+  uint32_t Minute; //!< Minute extracted (divide by 10^7 to get the real minute)
+  uint8_t Degree;  //!< Degree extracted (Latitude: 0 to 90, Longitude: 0 to 180)
+  char Direction;  //!< In case of latitude: 'N' or 'S'. In case of longitude: 'E' or 'W'
+#else
   char Direction;  //!< In case of latitude: 'N' or 'S'. In case of longitude: 'E' or 'W'
   uint8_t Degree;  //!< Degree extracted (Latitude: 0 to 90, Longitude: 0 to 180)
   uint32_t Minute; //!< Minute extracted (divide by 10^7 to get the real minute)
+#endif
 } NMEA0183_Coordinate;
-NMEA0183_UNPACKITEM;
+NMEA0183_DATA_UNPACKITEM;
 
 //-----------------------------------------------------------------------------
 
 //! Magnetic sensor structure
-NMEA0183_PACKITEM
-typedef struct __NMEA0183_PACKED__ NMEA0183_Magnetic
+NMEA0183_DATA_PACKITEM
+typedef struct __NMEA0183_DATA_PACKED__ NMEA0183_Magnetic
 {
     uint16_t Value; //!< Value of the sensor extracted (divide by 10^2 to get the real value)
     char Direction; //!< Direction: 'E' = East ; 'W' = West
 } NMEA0183_Magnetic;
-NMEA0183_UNPACKITEM;
+NMEA0183_DATA_UNPACKITEM;
+
+#ifdef NMEA0183_NATURAL_ALIGNMENT
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Time)       == 6, "NMEA0183_Time shall be 6 bytes in natural alignment");
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Date)       == 4, "NMEA0183_Date shall be 4 bytes in natural alignment");
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Coordinate) == 8, "NMEA0183_Coordinate shall be 8 bytes in natural alignment");
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Magnetic)   == 4, "NMEA0183_Magnetic shall be 4 bytes in natural alignment");
+#else
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Time)       == 5, "NMEA0183_Time shall be packed");
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Date)       == 4, "NMEA0183_Date shall be packed");
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Coordinate) == 6, "NMEA0183_Coordinate shall be packed");
+NMEA0183_STATIC_ASSERT(sizeof(NMEA0183_Magnetic)   == 3, "NMEA0183_Magnetic shall be packed");
+#endif
 
 //-----------------------------------------------------------------------------
 
@@ -261,6 +314,15 @@ typedef struct NMEA0183_SatelliteView
   uint8_t SNR;         //!< SNR (C/No) 00-99 dB-Hz, 0xFF when not tracking
 } NMEA0183_SatelliteView;
 
+//-----------------------------------------------------------------------------
+
+//! String view structure, the chars of a string field are not copied and stay in the parsed frame (see NMEA0183_StringViewToString() to get the string)
+typedef struct NMEA0183_StringView
+{
+  const char* pChars; //!< First char of the field in the parsed frame (not '\0' terminated, the code delimiters '^' are not decoded). The frame shall stay available while the view is used
+  uint8_t Size;       //!< Count of chars of the field in the frame (0 if the field is empty)
+} NMEA0183_StringView;
+
 //*****************************************************************************
 
 #define NMEA0183_AAM_WAYPOINT_ID_MAX_SIZE  ( 25 ) //! ASCII characters + 0 terminal
@@ -274,7 +336,11 @@ typedef struct NMEA0183_AAMdata
   char ArrivalStatus;    //!< Status of arrival: 'A' = arrival circle entered ; 'V' = arrival circle not entered
   char PassedWaypoint;   //!< Status of the passed waypoint: 'A' = arrival circle entered ; 'V' = arrival circle not entered
   uint32_t CircleRadius; //!< Arrival circle radius in nautical miles (divide by 10^4 to get the circle radius in nautical miles)
+#ifdef NMEA0183_STRING_VIEWS
+  NMEA0183_StringView WaypointID; //!< Waypoint ID
+#else
   char WaypointID[NMEA0183_AAM_WAYPOINT_ID_MAX_SIZE]; //!< Waypoint ID
+#endif
 } NMEA0183_AAMdata;
 
 //-----------------------------------------------------------------------------
@@ -381,7 +447,11 @@ typedef struct NMEA0183_APBdata
   char PassedWaypoint;           //!< Status of the passed waypoint: 'A' = arrival circle entered ; 'V' = arrival circle not entered
   uint16_t BearingOriginToDest;  //!< Bearing origin to destination, see BearingOtoDunit for the unit (divide by 10^2 to get the real bearing origin to destination)
   char BearingOtoDunit;          //!< Bearing origin to destination unit: 'M' = magnetic ; 'T' = true
+#ifdef NMEA0183_STRING_VIEWS
+  NMEA0183_StringView WaypointID; //!< Destination waypoint ID
+#else
   char WaypointID[NMEA0183_APB_WAYPOINT_ID_MAX_SIZE]; //!< Destination waypoint ID
+#endif
   uint16_t BearingCurPosToDest;  //!< Bearing present position to destination, see BearingCPtoDunit for the unit (divide by 10^2 to get the real Bearing, present position to destination)
   char BearingCPtoDunit;         //!< Bearing present position to destination unit: 'M' = magnetic ; 'T' = true
   uint16_t HeadingToSteerToDest; //!< Heading-to-steer to destination waypoint, see H2StoDunit for the unit (divide by 10^2 to get the real heading-to-steer to destination waypoint)
@@ -405,7 +475,11 @@ typedef struct NMEA0183_BECdata
   uint16_t BearingTrue;             //!< Bearing, degrees True (divide by 10^2 to get the real bearing True)
   uint16_t BearingMagnetic;         //!< Bearing, degrees Magnetic (divide by 10^2 to get the real bearing Magnetic)
   uint32_t Distance;                //!< Distance, nautical miles (divide by 10^4 to get the real distance)
+#ifdef NMEA0183_STRING_VIEWS
+  NMEA0183_StringView WaypointID; //!< Destination waypoint ID
+#else
   char WaypointID[NMEA0183_BEC_WAYPOINT_ID_MAX_SIZE]; //!< Destination waypoint ID
+#endif
 } NMEA0183_BECdata;
 
 //-----------------------------------------------------------------------------
@@ -420,8 +494,13 @@ typedef struct NMEA0183_BODdata
 {
   uint16_t BearingTrue;     //!< Bearing, degrees True (divide by 10^2 to get the real bearing True)
   uint16_t BearingMagnetic; //!< Bearing, degrees Magnetic (divide by 10^2 to get the real bearing Magnetic)
+#ifdef NMEA0183_STRING_VIEWS
+  NMEA0183_StringView DestWaypointID;   //!< Destination waypoint ID
+  NMEA0183_StringView OriginWaypointID; //!< Origin waypoint ID
+#else
   char DestWaypointID[NMEA0183_BOD_WAYPOINT_ID_MAX_SIZE];   //!< Destination waypoint ID
   char OriginWaypointID[NMEA0183_BOD_WAYPOINT_ID_MAX_SIZE]; //!< Origin waypoint ID
+#endif
 } NMEA0183_BODdata;
 
 //-----------------------------------------------------------------------------
@@ -436,8 +515,13 @@ typedef struct NMEA0183_BWWdata
 {
   uint16_t BearingTrue;     //!< Bearing, degrees True (divide by 10^2 to get the real bearing True)
   uint16_t BearingMagnetic; //!< Bearing, degrees Magnetic (divide by 10^2 to get the real bearing Magnetic)
+#ifdef NMEA0183_STRING_VIEWS
+  NMEA0183_StringView FromWaypointID; //!< FROM waypoint ID
+  NMEA0183_StringView ToWaypointID;   //!< TO waypoint ID
+#else
   char FromWaypointID[NMEA0183_BWW_WAYPOINT_ID_MAX_SIZE]; //!< FROM waypoint ID
   char ToWaypointID[NMEA0183_BWW_WAYPOINT_ID_MAX_SIZE];   //!< TO waypoint ID
+#endif
 } NMEA0183_BWWdata;
 
 //-----------------------------------------------------------------------------
@@ -648,7 +732,11 @@ typedef struct NMEA0183_TXTdata
   uint8_t TotalSentence;  //!< Total number of sentences (01 to 99) extracted
   uint8_t SentenceNumber; //!< Sentence number (01 to 99) extracted
   uint8_t TextIdentifier; //!< Text identifier (01 to 99) extracted
+#ifdef NMEA0183_STRING_VIEWS
+  NMEA0183_StringView TextMessage; //!< Text in the frame (the code delimiters '^' are decoded by NMEA0183_StringViewToString())
+#else
   char TextMessage[NMEA0183_TXT_MESSAGE_MAX_SIZE+1]; //!< Text extracted (with a 0 terminal)
+#endif
 } NMEA0183_TXTdata;
 
 //-----------------------------------------------------------------------------
@@ -702,12 +790,39 @@ typedef struct NMEA0183_ZDAdata
 
 //*****************************************************************************
 
+#ifdef NMEA0183_PARSE_ERROR_DIAGNOSTICS
+#define NMEA0183_NO_ERROR_POSITION  ( 0xFF ) //! Position of a parse error unknown
+
+//! Parse error of a sentence parser that stopped at an offset of the sentence fields (the offset is in the context bits of the error, see ErrorsDef.h)
+#define NMEA0183_PARSE_ERROR_AT(offset)         ERR_CONTEXTUALIZE(((size_t)(offset) < 0xFEu ? (size_t)(offset) + 1u : 0xFFu), ERR__PARSE_ERROR)
+//! Get the offset of the sentence fields where a sentence parser stopped, NMEA0183_NO_ERROR_POSITION if the error does not have an offset
+#define NMEA0183_PARSE_ERROR_OFFSET_Get(error)  ( (uint8_t)ERR_ERROR_CONTEXT_Get(error) == 0 ? NMEA0183_NO_ERROR_POSITION : (uint8_t)ERR_ERROR_CONTEXT_Get(error) - 1 )
+#endif
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+typedef NMEA0183_RECEIVE_TIMESTAMPS NMEA0183_Timestamp; //! Timestamp read from the receive clock hook (see NMEA0183_SetReceiveClock())
+#endif
+
 //! NMEA0183 decoded values buffer
 typedef struct NMEA0183_DecodedData
 {
   eNMEA0183_TalkerID TalkerID;      //!< This is the talker ID of the last decoded frame
   eNMEA0183_SentencesID SentenceID; //!< This is the sentence ID of the last decoded frame
   bool ParseIsValid;                //!< 'true' to indicate that the parsing of the frame is valid else 'false'
+#ifdef NMEA0183_PARSE_ERROR_DIAGNOSTICS
+  uint8_t ParseErrorField;          //!< Field where the parsing stopped, 0 for the first field after the address. Only set when ERR__PARSE_ERROR is returned, NMEA0183_NO_ERROR_POSITION if unknown
+  uint8_t ParseErrorOffset;         //!< Offset in the frame (from the '$') of the char where the parsing stopped. Only set when ERR__PARSE_ERROR is returned, NMEA0183_NO_ERROR_POSITION if unknown
+#endif
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+  uint32_t ChangedFields;           //!< Fields changed since the previous frame of the same address, bit 0 for the first field after the address (bit 31 for the fields 31 and more). Only set by NMEA0183_ProcessFrame()
+#endif
+#ifdef NMEA0183_PRESENT_FIELDS
+  uint32_t PresentFields;           //!< Fields not empty in the sentence, bit 0 for the first field after the address (bit 31 for the fields 31 and more, see NMEA0183_IS_FIELD_PRESENT()). Set by the parser while each field is parsed (the fields before the error on a parse error), not set by the sentence parsers alone (NMEA0183_ProcessXXX())
+#endif
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+  NMEA0183_Timestamp StartTimestamp; //!< Time when the start delimiter '$' of the frame was received. Only set by NMEA0183_ProcessFrame()
+  NMEA0183_Timestamp EndTimestamp;   //!< Time when the end delimiter of the frame was received. Only set by NMEA0183_ProcessFrame()
+#endif
   union
   {
 #ifdef NMEA0183_DECODE_AAM
@@ -785,12 +900,39 @@ typedef struct NMEA0183_DecodedData
 #ifdef NMEA0183_DECODE_ZDA
     NMEA0183_ZDAdata ZDA;                   //!< ZDA (Time & Date) extracted. Use if 'SentenceID' = NMEA0183_ZDA
 #endif
-    char Frame[NMEA0183_FRAME_BUFFER_SIZE]; //!< Raw of the frame. This is the default result of an unknown sentence
+    char Frame[NMEA0183_DECODED_FRAME_SIZE]; //!< Raw of the frame, truncated to NMEA0183_DECODED_FRAME_SIZE chars. This is the default result of an unknown sentence
   };
 } NMEA0183_DecodedData;
 
 //-----------------------------------------------------------------------------
 
+#ifdef NMEA0183_COMPACT_OUTPUT
+//! Header of a compact record, followed by the data of the sentence with its exact type (NMEA0183_GGAdata for a GGA...) or by the raw frame for a sentence unknown by this library
+NMEA0183_DATA_PACKITEM
+typedef struct __NMEA0183_DATA_PACKED__ NMEA0183_CompactHeader
+{
+  eNMEA0183_SentencesID SentenceID; //!< This is the sentence ID of the record, NMEA0183_UNKNOWN if the payload is the raw frame
+  eNMEA0183_TalkerID TalkerID;      //!< This is the talker ID of the record
+  uint8_t ParseIsValid;             //!< Not 0 to indicate that the parsing of the frame is valid else 0
+  uint8_t PayloadSize;              //!< Count of bytes of the payload after the header (all the sentences data and the frames are less than 256 bytes)
+#ifdef NMEA0183_PRESENT_FIELDS
+  uint32_t PresentFields;           //!< Fields not empty in the sentence of the record, see NMEA0183_DecodedData.PresentFields
+#endif
+} NMEA0183_CompactHeader;
+NMEA0183_DATA_UNPACKITEM;
+
+#ifdef NMEA0183_NATURAL_ALIGNMENT
+#  define NMEA0183_COMPACT_RECORD_ALIGN  ( 8 ) //! Alignment of the compact records, the payload of a record in an aligned buffer is naturally aligned
+#else
+#  define NMEA0183_COMPACT_RECORD_ALIGN  ( 1 ) //! Alignment of the compact records, the records are packed one after the other
+#endif
+#define NMEA0183_COMPACT_RECORD_SIZE(payloadSize)  ( (sizeof(NMEA0183_CompactHeader) + (size_t)(payloadSize) + (NMEA0183_COMPACT_RECORD_ALIGN - 1)) & ~(size_t)(NMEA0183_COMPACT_RECORD_ALIGN - 1) ) //! Size of a compact record with its payload
+#define NMEA0183_COMPACT_PAYLOAD(pHeader)          ( (void*)((NMEA0183_CompactHeader*)(pHeader) + 1) )                                                                    //! Payload of a compact record
+#define NMEA0183_COMPACT_NEXT_RECORD(pHeader)      ( (NMEA0183_CompactHeader*)((uint8_t*)(pHeader) + NMEA0183_COMPACT_RECORD_SIZE((pHeader)->PayloadSize)) )              //! Next compact record of a batch
+#endif
+
+//-----------------------------------------------------------------------------
+
 
 
 
@@ -811,10 +953,53 @@ typedef enum
 //-----------------------------------------------------------------------------
 
 
-typedef struct NMEA0183_InputBuffer NMEA0183_DecodeInput; //! Type definition of the NMEA0183 decoder
+#if defined(NMEA0183_DIFFERENTIAL_DECODING) || defined(NMEA0183_FRAME_CACHE_SIZE)
+typedef struct NMEA0183_DecodeInput NMEA0183_DecodeInput;     //! Type definition of the NMEA0183 decoder (input buffer and previous frames)
+#else
+typedef struct NMEA0183_InputBuffer NMEA0183_DecodeInput;     //! Type definition of the NMEA0183 decoder (input buffer only)
+#endif
+typedef struct NMEA0183_DecodeHistory NMEA0183_DecodeHistory; //! Type definition of the previous frames kept by a NMEA0183 decoder
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+/*! @brief Clock hook of the decoder, called by NMEA0183_AddReceivedCharacter() when the start and the end delimiters of a frame are received
+ *
+ * This function is called from where the characters are received (interrupt...), it shall be short and monotonic
+ * @param[in] *pContext Is the context given to NMEA0183_SetReceiveClock()
+ * @return Returns the current time, in the unit of the user
+ */
+typedef NMEA0183_Timestamp (*NMEA0183_Clock_Func)(void* pContext);
+#endif
+
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+#define NMEA0183_ALL_FIELDS_CHANGED  ( 0xFFFFFFFFu ) //! Changed fields of a frame without previous frame
+
+//! Previous frame of a sentence kept for the differential decoding
+typedef struct NMEA0183_PreviousFrame
+{
+  size_t Size;                                 //!< Count of chars of the raw frame, 0 if the entry is free
+  char RawFrame[NMEA0183_FRAME_BUFFER_SIZE];   //!< Raw of the previous frame
+  uint8_t FieldCount;                          //!< Count of field delimiters ',' of the previous frame
+  uint8_t FieldPos[NMEA0183_FIELD_INDEX_SIZE]; //!< Field index of the previous frame
+  eERRORRESULT Error;                          //!< Result of the decoding of the previous frame
+  NMEA0183_DecodedData Data;                   //!< Decoded data of the previous frame
+} NMEA0183_PreviousFrame;
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+//! Frame kept in the decoded frames cache
+typedef struct NMEA0183_CachedFrame
+{
+  uint32_t Hash;                               //!< Hash of the raw frame
+  uint8_t CRC;                                 //!< Checksum of the raw frame
+  uint8_t Size;                                //!< Count of chars of the raw frame, 0 if the entry is free
+  char RawFrame[NMEA0183_FRAME_BUFFER_SIZE];   //!< Raw of the frame
+  eERRORRESULT Error;                          //!< Result of the decoding of the frame
+  NMEA0183_DecodedData Data;                   //!< Decoded data of the frame
+} NMEA0183_CachedFrame;
+#endif
 
-//! NMEA0183 Input buffer
-struct NMEA0183_InputBuffer
+//! NMEA0183 Input buffer (frame being received)
+typedef struct NMEA0183_InputBuffer
 {
   //--- Frame buffer ---
   size_t BufferPos;                          //!< Position in the buffer
@@ -825,7 +1010,94 @@ struct NMEA0183_InputBuffer
   uint8_t CurrCalcCRC;                       //!< CRC currently calculated
   char CRC[2];                               //!< CRC from the frame
   size_t PosCRC;                             //!< If <2 then the frame character is for CRC else for frame buffer
+
+  //--- Field index ---
+  uint8_t FieldCount;                            //!< Count of field delimiters ',' received in the frame (can be greater than NMEA0183_FIELD_INDEX_SIZE)
+  uint8_t FieldPos[NMEA0183_FIELD_INDEX_SIZE];   //!< Position in the raw frame of each field delimiter ',', the first one ends the address field. The parsers jump to each field with it
+
+  //--- Resynchronization ---
+  uint32_t ResyncCount;                          //!< Count of frames cut by a start delimiter '$' or '!' (lost end delimiter), the decoder resumed from the start delimiter
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+  //--- Receive timestamps ---
+  NMEA0183_Clock_Func fnClock;                   //!< Clock hook read when the start and the end delimiters of a frame are received, NULL if not set
+  void* pClockContext;                           //!< Context given to the clock hook
+  NMEA0183_Timestamp StartTimestamp;             //!< Time when the start delimiter '$' of the frame was received
+  NMEA0183_Timestamp EndTimestamp;               //!< Time when the end delimiter of the frame was received
+#endif
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+  //--- Subscription ---
+  uint32_t SentenceMask;                         //!< Sentences to decode, one bit per NMEA0183_SENTENCE_HASH() slot (see NMEA0183_SUBSCRIBE())
+  uint16_t TalkerFilter;                         //!< Only talker ID to decode, NMEA0183_ANY_TALKER to decode all talkers
+#endif
+} NMEA0183_InputBuffer;
+
+#if defined(NMEA0183_DIFFERENTIAL_DECODING) || defined(NMEA0183_FRAME_CACHE_SIZE)
+//! Previous frames kept by a NMEA0183 decoder, shared by all the frames decoded
+struct NMEA0183_DecodeHistory
+{
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+  //--- Differential decoding ---
+  NMEA0183_PreviousFrame Previous[NMEA0183_DIFFERENTIAL_DECODING]; //!< Last frame of the last sentences decoded, one entry per address
+  uint8_t NextPrevious;                                            //!< Next entry to replace when a new address is received
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+  //--- Decoded frames cache ---
+  NMEA0183_CachedFrame Cache[NMEA0183_FRAME_CACHE_SIZE];           //!< Last frames of the sentences known by this library with their decoded data
+  uint8_t NextCache;                                               //!< Next entry to replace when a frame is not in the cache
+  uint32_t CacheHits;                                              //!< Count of frames found in the cache (not parsed)
+  uint32_t CacheMisses;                                            //!< Count of frames not found in the cache (parsed)
+#endif
+};
+#endif
+
+#if defined(NMEA0183_DIFFERENTIAL_DECODING) || defined(NMEA0183_FRAME_CACHE_SIZE)
+//! NMEA0183 decoder with previous frames
+struct NMEA0183_DecodeInput
+{
+  NMEA0183_InputBuffer Input;                    //!< Frame being received
+  NMEA0183_DecodeHistory History;                //!< Previous frames of the decoder
 };
+#  define NMEA0183_DECODER_INPUT(pDecoder)  ( &(pDecoder)->Input ) //! Input buffer (frame being received) of a decoder
+#else
+#  define NMEA0183_DECODER_INPUT(pDecoder)  ( pDecoder )           //! Input buffer (frame being received) of a decoder, the decoder is its input buffer
+#endif
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+#define NMEA0183_SUBSCRIBE(sentenceID)  ( 1u << NMEA0183_SENTENCE_HASH(sentenceID) )  //! Subscription bit of a sentence known by this library
+#define NMEA0183_SUBSCRIBE_OTHERS       ( 1u << NMEA0183_SENTENCE_HASH_OTHERS )       //! Subscription bit of all the sentences unknown by this library (including proprietary sentences)
+#define NMEA0183_SUBSCRIBE_ALL          ( 0xFFFFFFFFu )                               //! Subscribe to all the sentences
+#define NMEA0183_ANY_TALKER             ( 0 )                                         //! No talker ID filter
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Function that is called each time a complete frame is ready to process
+ *
+ * The frame is still in the decoder when this function is called, use NMEA0183_ProcessFrame() to decode it
+ * @param[in] *pDecoder Is the decode input where the frame is ready
+ * @param[in] *pContext Is the context given to NMEA0183_AddReceivedBuffer()
+ */
+typedef void (*NMEA0183_FrameReady_Func)(NMEA0183_DecodeInput* pDecoder, void* pContext);
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+//! NMEA0183 frame queue (single producer, single consumer ring of frame slots)
+typedef struct NMEA0183_FrameQueue
+{
+  NMEA0183_InputBuffer Slots[NMEA0183_FRAME_QUEUE_DEPTH]; //!< Frame slots of the ring
+  volatile size_t Head;                                   //!< Slot where the characters are accumulated. Only modified by the producer (AddReceivedCharacter side)
+  volatile size_t Tail;                                   //!< Oldest frame to process. Only modified by the consumer (ProcessFrame side)
+#if defined(NMEA0183_DIFFERENTIAL_DECODING) || defined(NMEA0183_FRAME_CACHE_SIZE)
+  NMEA0183_DecodeHistory History;                         //!< Previous frames of the queue, only used by the consumer (ProcessFrame side)
+#endif
+} NMEA0183_FrameQueue;
+#endif
 
 //-----------------------------------------------------------------------------
 
@@ -841,14 +1113,81 @@ eERRORRESULT Init_NMEA0183(NMEA0183_DecodeInput* pDecoder);
 //-----------------------------------------------------------------------------
 
 
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+/*! @brief Set the sentences subscribed by the decoder
+ *
+ * The address of each frame is checked as soon as it is received. A frame not subscribed is skipped until the next '$' without checksum nor parsing
+ * All the sentences of all the talkers are subscribed after the initialization of the decoder
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[in] sentenceMask Is the sentences to decode, a combination of NMEA0183_SUBSCRIBE(), NMEA0183_SUBSCRIBE_OTHERS or NMEA0183_SUBSCRIBE_ALL
+ * @param[in] talkerID Is the only talker ID to decode (ex: NMEA0183_GP), or NMEA0183_ANY_TALKER. Proprietary sentences are not filtered by talker ID
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_SetSentenceSubscription(NMEA0183_DecodeInput* pDecoder, uint32_t sentenceMask, uint16_t talkerID);
+#endif
+
+/*! @brief Get the count of resynchronizations of the decoder
+ *
+ * A frame is cut when a start delimiter '$' or '!' is received before its end delimiter (lost CR/LF, frame longer than NMEA0183_FRAME_BUFFER_SIZE).
+ * The decoder resumes from the start delimiter so the next frame is not lost. If the checksum of the cut frame is complete, NMEA0183_AddReceivedBuffer() and the frame queue
+ * also set the cut frame ready to process, its checksum is checked as usual. Encapsulation sentences ('!') are not decoded by this library and are skipped
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[out] *pCount Is the count of frames cut by a start delimiter
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_GetResyncCount(NMEA0183_DecodeInput* pDecoder, uint32_t* pCount);
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+/*! @brief Set the clock hook of the decoder
+ *
+ * The clock is read when the start delimiter '$' and the end delimiter of each frame are received. NMEA0183_ProcessFrame() copies both timestamps in the decoded data
+ * to measure the queueing latency of the frames or to align several sources on a common timeline
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[in] fnClock Is the clock hook, NULL to stop reading the clock
+ * @param[in] *pContext Is the context given to the clock hook (can be NULL)
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_SetReceiveClock(NMEA0183_DecodeInput* pDecoder, NMEA0183_Clock_Func fnClock, void* pContext);
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+/*! @brief Get the statistics of the decoded frames cache
+ *
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[out] *pHits Is the count of frames found in the cache, not parsed again (can be NULL)
+ * @param[out] *pMisses Is the count of frames not found in the cache, parsed (can be NULL)
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_GetFrameCacheStatistics(NMEA0183_DecodeInput* pDecoder, uint32_t* pHits, uint32_t* pMisses);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
 /*! @brief Add NMEA0183 received frame character data
  *
+ * A frame that lost its end delimiter is dropped when the start delimiter of the next frame is received, and counted by NMEA0183_GetResyncCount(). NMEA0183_AddReceivedBuffer() keeps it if its checksum is complete
  * @param[in] *pDecoder Is the decode input to use
  * @param[in] data Is the char to add to input data buffer
  * @return Returns an #eERRORRESULT value enum
  */
 eERRORRESULT NMEA0183_AddReceivedCharacter(NMEA0183_DecodeInput* pDecoder, char data);
 
+/*! @brief Add a buffer of NMEA0183 received characters
+ *
+ * The buffer is processed by runs of characters instead of character per character. The result is the same as calling NMEA0183_AddReceivedCharacter() for each character, except for a frame that lost its end delimiter:
+ * if the start delimiter of the next frame comes right after its '*' and 2 checksum chars, this function gives the frame to @p fnFrameReady before starting the next one. NMEA0183_AddReceivedCharacter() drops such a frame
+ * Each time a frame is complete, the function @p fnFrameReady is called. If the frame is not processed by this function, the next frame will override it
+ * This function is not meant to be called in an interrupt, use NMEA0183_AddReceivedCharacter() instead
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[in] *pBuffer Is the buffer of received characters to add to the input data buffer
+ * @param[in] size Is the count of characters in the buffer
+ * @param[in] fnFrameReady Is the function called each time a frame is ready to process
+ * @param[in] *pContext Is a user context given to the @p fnFrameReady function (can be NULL)
+ * @return Returns an #eERRORRESULT value enum. If errors occur while adding characters, the last one is returned
+ */
+eERRORRESULT NMEA0183_AddReceivedBuffer(NMEA0183_DecodeInput* pDecoder, const char* pBuffer, size_t size, NMEA0183_FrameReady_Func fnFrameReady, void* pContext);
+
 /*! @brief Get decoder state
  *
  * @param[in] *pDecoder Is the decode input to use
@@ -865,11 +1204,122 @@ bool NMEA0183_IsFrameReadyToProcess(NMEA0183_DecodeInput* pDecoder);
 
 /*! @brief Process the NMEA0183 frame (used with the decode structure)
  *
+ * With NMEA0183_DIFFERENTIAL_DECODING, a frame identical to the previous frame of the same address is not parsed again (the previous decoded data and result are given back),
+ * a frame of a sentence known by this library with as many fields as the previous valid frame of the same address only has its changed fields parsed again
+ * and pData->ChangedFields reports the fields changed since the previous frame of the same address
+ * With NMEA0183_FRAME_CACHE_SIZE, a frame of a sentence known by this library that is in the cache of the last decoded frames is not parsed again (the decoded data and result are given back)
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, the ParseErrorField and ParseErrorOffset of pData tell where the parsing stopped if ERR__PARSE_ERROR is returned
+ * With NMEA0183_STRING_VIEWS, the string views of pData are in the frame buffer of the decoder (or in its previous frames), use them before the next frame is received
  * @param[in] *pDecoder Is the decode input to use
  * @param[out] *pData Is the decoded data
  * @return Returns an #eERRORRESULT value enum
  */
 eERRORRESULT NMEA0183_ProcessFrame(NMEA0183_DecodeInput* pDecoder, NMEA0183_DecodedData* pData);
+
+/*! @brief Check the NMEA0183 frame of the decode structure and locate its sentence
+ *
+ * Same frame control as NMEA0183_ProcessFrame() with the checksum computed while receiving the frame, the frame is not read again. Then the fields can be given to a sentence parser (NMEA0183_ProcessXXX())
+ * The state of the decoder is not changed, the frame shall not be overwritten by received characters while its fields are used
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[out] *pTalkerID Is the talker ID of the sentence
+ * @param[out] *pSentenceID Is the sentence ID of a 5 chars address (can be a sentence unknown by this library), else NMEA0183_UNKNOWN
+ * @param[out] **ppFields Is the first field of the sentence in the frame buffer of the decoder
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_CheckFrame(NMEA0183_DecodeInput* pDecoder, eNMEA0183_TalkerID* pTalkerID, eNMEA0183_SentencesID* pSentenceID, const char** ppFields);
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+/*! @brief Initialize a NMEA0183 frame queue
+ *
+ * The frame queue lets the interrupt accumulate the next frames while the main loop processes the previous ones.
+ * Up to NMEA0183_FRAME_QUEUE_DEPTH-1 frames can wait to be processed while the next one is accumulated
+ * @param[in] *pQueue Is the frame queue to initialize
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_NMEA0183FrameQueue(NMEA0183_FrameQueue* pQueue);
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+/*! @brief Set the sentences subscribed by the frame queue
+ *
+ * See NMEA0183_SetSentenceSubscription(). This function shall not be called while characters are received
+ * @param[in] *pQueue Is the frame queue to use
+ * @param[in] sentenceMask Is the sentences to decode, a combination of NMEA0183_SUBSCRIBE(), NMEA0183_SUBSCRIBE_OTHERS or NMEA0183_SUBSCRIBE_ALL
+ * @param[in] talkerID Is the only talker ID to decode (ex: NMEA0183_GP), or NMEA0183_ANY_TALKER
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_FrameQueue_SetSentenceSubscription(NMEA0183_FrameQueue* pQueue, uint32_t sentenceMask, uint16_t talkerID);
+#endif
+
+/*! @brief Get the count of resynchronizations of all the slots of the frame queue
+ *
+ * See NMEA0183_GetResyncCount(). A frame cut with a complete checksum is published before the start delimiter is added to the next slot
+ * @param[in] *pQueue Is the frame queue to use
+ * @param[out] *pCount Is the count of frames cut by a start delimiter
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_FrameQueue_GetResyncCount(NMEA0183_FrameQueue* pQueue, uint32_t* pCount);
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+/*! @brief Set the clock hook of all the slots of the frame queue
+ *
+ * See NMEA0183_SetReceiveClock(). This function shall not be called while characters are received
+ * @param[in] *pQueue Is the frame queue to use
+ * @param[in] fnClock Is the clock hook, NULL to stop reading the clock
+ * @param[in] *pContext Is the context given to the clock hook (can be NULL)
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_FrameQueue_SetReceiveClock(NMEA0183_FrameQueue* pQueue, NMEA0183_Clock_Func fnClock, void* pContext);
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+/*! @brief Get the statistics of the decoded frames cache of the frame queue
+ *
+ * See NMEA0183_GetFrameCacheStatistics(). The cache is kept by the queue (not by each slot) for all the slots
+ * @param[in] *pQueue Is the frame queue to use
+ * @param[out] *pHits Is the count of frames found in the cache, not parsed again (can be NULL)
+ * @param[out] *pMisses Is the count of frames not found in the cache, parsed (can be NULL)
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_FrameQueue_GetFrameCacheStatistics(NMEA0183_FrameQueue* pQueue, uint32_t* pHits, uint32_t* pMisses);
+#endif
+
+/*! @brief Add NMEA0183 received frame character data to the frame queue
+ *
+ * This function is the only producer of the queue, it can be called in an interrupt
+ * @param[in] *pQueue Is the frame queue to use
+ * @param[in] data Is the char to add to the queue
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_OVERRIDE if a frame have been lost because the queue is full
+ */
+eERRORRESULT NMEA0183_FrameQueue_AddReceivedCharacter(NMEA0183_FrameQueue* pQueue, char data);
+
+/*! @brief Is a frame of the queue ready to process?
+ *
+ * @param[in] *pQueue Is the frame queue to use
+ * @return Returns 'true' if at least one frame is ready to process else 'false'
+ */
+bool NMEA0183_FrameQueue_IsFrameReadyToProcess(NMEA0183_FrameQueue* pQueue);
+
+/*! @brief Get the count of frames ready to process in the queue
+ *
+ * @param[in] *pQueue Is the frame queue to use
+ * @return Returns the count of frames waiting to be processed
+ */
+size_t NMEA0183_FrameQueue_GetFrameCount(NMEA0183_FrameQueue* pQueue);
+
+/*! @brief Process the oldest NMEA0183 frame of the queue
+ *
+ * This function is the only consumer of the queue. The slot is released after the frame is processed
+ * With NMEA0183_DIFFERENTIAL_DECODING, the previous frames are kept by the queue (not by each slot) for all the slots
+ * With NMEA0183_STRING_VIEWS, the string views of pData are in the released slot (or in the previous frames), use them before the slot is filled again
+ * @param[in] *pQueue Is the frame queue to use
+ * @param[out] *pData Is the decoded data
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__NO_DATA_AVAILABLE if no frame is ready to process
+ */
+eERRORRESULT NMEA0183_FrameQueue_ProcessFrame(NMEA0183_FrameQueue* pQueue, NMEA0183_DecodedData* pData);
+#endif
 #endif
 //-----------------------------------------------------------------------------
 
@@ -878,12 +1328,424 @@ eERRORRESULT NMEA0183_ProcessFrame(NMEA0183_DecodeInput* pDecoder, NMEA0183_Deco
  *
  * This function can be used alone without using the NMEA0183_DecodeInput structure
  * This fucntion process a whole NMEA0183 line at once (from '$' to the char before the \r or \n terminal)
+ * A sentence known by this library is parsed in a single pass: the chars of each field are added to the checksum while the field is parsed, and the checksum is checked at the '*'. ERR__CRC_ERROR is returned before ERR__PARSE_ERROR, the data of pData can then be partly written but ParseIsValid is false
+ * Another sentence is checked up to the '*' or the '\0' terminal first (the length of the line is not computed before), then given to the user decoders or copied in pData
+ * With NMEA0183_STRING_VIEWS, the string views of pData are in the line
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, the ParseErrorField and ParseErrorOffset of pData tell where the parsing stopped if ERR__PARSE_ERROR is returned
  * @param[in] *pDecoder Is the frame string (with '\0' terminal) to process
  * @param[out] *pData Is the decoded data
  * @return Returns an #eERRORRESULT value enum
  */
 eERRORRESULT NMEA0183_ProcessLine(const char* string, NMEA0183_DecodedData* pData);
 
+/*! @brief Process the NMEA0183 frame line of a known length
+ *
+ * This function can be used alone without using the NMEA0183_DecodeInput structure
+ * This function process a whole NMEA0183 line at once (from '$' to the checksum, the \r\n terminal is optional) in place, without '\0' terminal
+ * The line is never read past length, so it can be decoded directly from a mapped file or a reception buffer
+ * The checksum is checked and the address field is located in a single pass, then the sentence is parsed from the first field
+ * With NMEA0183_STRING_VIEWS, the string views of pData are in the line
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, the ParseErrorField and ParseErrorOffset of pData tell where the parsing stopped if ERR__PARSE_ERROR is returned
+ * @param[in] *pLine Is the frame line to process
+ * @param[in] length Is the count of characters of the line
+ * @param[out] *pData Is the decoded data
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_ProcessLineN(const char* pLine, size_t length, NMEA0183_DecodedData* pData);
+
+#ifdef NMEA0183_COMPACT_OUTPUT
+/*! @brief Process the NMEA0183 frame line of a known length in a compact record
+ *
+ * This function can be used alone without using the NMEA0183_DecodeInput structure
+ * The record is a NMEA0183_CompactHeader followed by the data of the sentence with its exact type, there is no NMEA0183_DecodedData so the record only costs the size of its sentence
+ * A sentence unknown by this library (or decoded by a decoder registered by the user) is written as its raw frame without '\0' terminal, the error is then ERR__UNKNOWN_ELEMENT
+ * The records of a batch of lines can be written one after the other, the next record is at NMEA0183_COMPACT_RECORD_SIZE() of the payload size (see NMEA0183_COMPACT_NEXT_RECORD())
+ * With NMEA0183_NATURAL_ALIGNMENT, the buffer shall be aligned on NMEA0183_COMPACT_RECORD_ALIGN
+ * With NMEA0183_STRING_VIEWS, the string views of the payload are in the line
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, a parse error of the sentence parser is returned with its offset in the fields (see NMEA0183_PARSE_ERROR_OFFSET_Get())
+ * @param[in] *pLine Is the frame line to process (from '$' to the checksum, the \r\n terminal is optional)
+ * @param[in] length Is the count of characters of the line
+ * @param[out] *pRecord Is the buffer where the record will be written
+ * @param[in] size Is the count of bytes available in the buffer
+ * @param[out] *pRecordSize Is the count of bytes used by the record (with its alignment), 0 if no record is written
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_FULL if the record does not fit in the buffer
+ */
+eERRORRESULT NMEA0183_ProcessLineCompact(const char* pLine, size_t length, void* pRecord, size_t size, size_t* pRecordSize);
+#endif
+
+/*! @brief Check a NMEA0183 frame line of a known length and locate its sentence
+ *
+ * The start delimiter and the checksum are checked, then the fields can be given to a sentence parser (NMEA0183_ProcessXXX())
+ * @param[in] *pLine Is the frame line to check (from '$' to the checksum, the \r\n terminal is optional)
+ * @param[in] length Is the count of characters of the line
+ * @param[out] *pTalkerID Is the talker ID of the sentence
+ * @param[out] *pSentenceID Is the sentence ID of a 5 chars address (can be a sentence unknown by this library), else NMEA0183_UNKNOWN
+ * @param[out] **ppFields Is the first field of the sentence in the line
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_CheckLineN(const char* pLine, size_t length, eNMEA0183_TalkerID* pTalkerID, eNMEA0183_SentencesID* pSentenceID, const char** ppFields);
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef NMEA0183_RING_FRAMER
+#define NMEA0183_RING_NO_FRAME  ( (size_t)-1 ) //! No frame being scanned by the ring framer
+
+//! Frame in a ring buffer, in two segments if the frame wraps around the end of the ring (from '$' to the checksum, without the end delimiter)
+typedef struct NMEA0183_RingSpan
+{
+  const char* pFirst;  //!< First chars of the frame, from the '$'
+  size_t FirstSize;    //!< Count of chars of the first segment
+  const char* pSecond; //!< Next chars of the frame at the start of the ring, NULL if the frame does not wrap
+  size_t SecondSize;   //!< Count of chars of the second segment, 0 if the frame does not wrap
+} NMEA0183_RingSpan;
+
+//! NMEA0183 ring framer (finds the frames in a ring buffer owned by the caller without copying them)
+typedef struct NMEA0183_RingFramer
+{
+  const char* pRing;                           //!< Ring buffer where the caller writes the received characters
+  size_t RingSize;                             //!< Size of the ring buffer
+  size_t ReadPos;                              //!< The characters before this position are released, the caller can write over them
+  size_t ScanPos;                              //!< Position of the next character to scan
+  size_t FrameStart;                           //!< Position of the start delimiter of the frame being scanned, NMEA0183_RING_NO_FRAME if none
+  bool FramePending;                           //!< 'true' if a frame is given by NMEA0183_RingFramer_GetFrame() and not released
+  bool FrameOverflow;                          //!< 'true' if the frame being skipped is longer than the frame buffer, until its end delimiter or the next start delimiter
+  uint32_t ResyncCount;                        //!< Count of frames cut by a start delimiter '$' or '!' (see NMEA0183_GetResyncCount())
+  char WrapFrame[NMEA0183_FRAME_BUFFER_SIZE];  //!< Copy of a frame that wraps around the end of the ring, the parsers need contiguous characters
+} NMEA0183_RingFramer;
+
+
+/*! @brief Initialize a NMEA0183 ring framer
+ *
+ * This function can be used alone without using the NMEA0183_DecodeInput structure
+ * @param[in] *pFramer Is the ring framer to initialize
+ * @param[in] *pRing Is the ring buffer where the caller writes the received characters, the scan starts at position 0
+ * @param[in] ringSize Is the size of the ring buffer, at least NMEA0183_FRAME_BUFFER_SIZE+2
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_NMEA0183RingFramer(NMEA0183_RingFramer* pFramer, const char* pRing, size_t ringSize);
+
+/*! @brief Get the next frame of the ring buffer
+ *
+ * The characters are scanned from the last call up to the write position of the caller. The frame is not copied, its span stays valid until NMEA0183_RingFramer_ReleaseFrame()
+ * The resynchronizations are the same as NMEA0183_AddReceivedBuffer(): a start delimiter cuts the frame being scanned, a frame cut after its complete checksum is given
+ * The caller shall not write over the characters from NMEA0183_RingFramer_GetReadPos() and shall not fill the ring completely (write position = read position is an empty ring)
+ * @param[in] *pFramer Is the ring framer to use
+ * @param[in] writePos Is the position in the ring where the caller will write the next received character
+ * @param[out] *pSpan Is the span of the frame in the ring
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__NO_DATA_AVAILABLE if there is no complete frame, ERR__BUSY if the previous frame is not released,
+ *         ERR__BUFFER_FULL if a frame longer than NMEA0183_FRAME_BUFFER_SIZE is dropped (call again for the next frames). As in the receive path, a start delimiter that ends a dropped frame is a resynchronization
+ */
+eERRORRESULT NMEA0183_RingFramer_GetFrame(NMEA0183_RingFramer* pFramer, size_t writePos, NMEA0183_RingSpan* pSpan);
+
+/*! @brief Process a NMEA0183 frame of the ring buffer
+ *
+ * A frame that does not wrap is parsed in place in the ring with NMEA0183_ProcessLineN(), else it is copied in the ring framer before being parsed
+ * With NMEA0183_STRING_VIEWS, the string views of pData are in the ring until the frame is released (in the ring framer for a frame that wraps)
+ * @param[in] *pFramer Is the ring framer to use
+ * @param[in] *pSpan Is the span of the frame given by NMEA0183_RingFramer_GetFrame()
+ * @param[out] *pData Is the decoded data
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_RingFramer_ProcessFrame(NMEA0183_RingFramer* pFramer, const NMEA0183_RingSpan* pSpan, NMEA0183_DecodedData* pData);
+
+/*! @brief Release the frame given by NMEA0183_RingFramer_GetFrame()
+ *
+ * The characters of the frame and the characters before it are released, see NMEA0183_RingFramer_GetReadPos()
+ * @param[in] *pFramer Is the ring framer to use
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_RingFramer_ReleaseFrame(NMEA0183_RingFramer* pFramer);
+
+/*! @brief Get the read position of the ring framer
+ *
+ * The characters before this position are not needed anymore, the caller can write over them
+ * @param[in] *pFramer Is the ring framer to use
+ * @return Returns the position of the first character still needed by the ring framer
+ */
+size_t NMEA0183_RingFramer_GetReadPos(NMEA0183_RingFramer* pFramer);
+
+/*! @brief Get the count of resynchronizations of the ring framer
+ *
+ * See NMEA0183_GetResyncCount()
+ * @param[in] *pFramer Is the ring framer to use
+ * @param[out] *pCount Is the count of frames cut by a start delimiter
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_RingFramer_GetResyncCount(NMEA0183_RingFramer* pFramer, uint32_t* pCount);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Sentence parsers
+ *
+ * Each parser extracts the fields of one sentence in a structure of its exact type, they are used by the dispatch table and can be called directly
+ * With NMEA0183_STRING_VIEWS, the string fields of pData are views in pSentence
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, a parse error carries the offset in pSentence where the parser stopped (use ERR_ERROR_Get() to compare the error and NMEA0183_PARSE_ERROR_OFFSET_Get() to get the offset)
+ * @param[in] *pSentence Is the first field of the sentence (just after the ',' that ends the address field). The sentence shall end with the '*' of the checksum or a '\0'
+ * @param[out] *pData Is the decoded data of the sentence
+ * @return Returns an #eERRORRESULT value enum
+ */
+#ifdef NMEA0183_DECODE_AAM
+eERRORRESULT NMEA0183_ProcessAAM(const char* pSentence, NMEA0183_AAMdata* pData); //!< Waypoint Arrival Alarm
+#endif
+#ifdef NMEA0183_DECODE_ALM
+eERRORRESULT NMEA0183_ProcessALM(const char* pSentence, NMEA0183_ALMdata* pData); //!< GPS Almanac Data
+#endif
+#ifdef NMEA0183_DECODE_APB
+eERRORRESULT NMEA0183_ProcessAPB(const char* pSentence, NMEA0183_APBdata* pData); //!< Heading/Track Controller (Autopilot) Sentence "B"
+#endif
+#ifdef NMEA0183_DECODE_BEC
+eERRORRESULT NMEA0183_ProcessBEC(const char* pSentence, NMEA0183_BECdata* pData); //!< Bearing and distance to waypoint - dead reckoning
+#endif
+#ifdef NMEA0183_DECODE_BOD
+eERRORRESULT NMEA0183_ProcessBOD(const char* pSentence, NMEA0183_BODdata* pData); //!< Bearing - Origin to Destination
+#endif
+#ifdef NMEA0183_DECODE_BWW
+eERRORRESULT NMEA0183_ProcessBWW(const char* pSentence, NMEA0183_BWWdata* pData); //!< Bearing - Waypoint to Waypoint
+#endif
+#if defined(NMEA0183_DECODE_DBK) || defined(NMEA0183_DECODE_DBS) || defined(NMEA0183_DECODE_DBT)
+eERRORRESULT NMEA0183_ProcessDBx(const char* pSentence, NMEA0183_DBxdata* pData); //!< Depth Below Keel, Surface or Transducer
+#endif
+#ifdef NMEA0183_DECODE_DPT
+eERRORRESULT NMEA0183_ProcessDPT(const char* pSentence, NMEA0183_DPTdata* pData); //!< Depth
+#endif
+#ifdef NMEA0183_DECODE_FSI
+eERRORRESULT NMEA0183_ProcessFSI(const char* pSentence, NMEA0183_FSIdata* pData); //!< Frequency Set Information
+#endif
+#ifdef NMEA0183_DECODE_GGA
+eERRORRESULT NMEA0183_ProcessGGA(const char* pSentence, NMEA0183_GGAdata* pData); //!< Global positioning system fixed data
+#endif
+#ifdef NMEA0183_DECODE_GLL
+eERRORRESULT NMEA0183_ProcessGLL(const char* pSentence, NMEA0183_GLLdata* pData); //!< Geographic position - latitude / longitude
+#endif
+#ifdef NMEA0183_DECODE_GSA
+eERRORRESULT NMEA0183_ProcessGSA(const char* pSentence, NMEA0183_GSAdata* pData); //!< GNSS DOP and active satellites
+#endif
+#ifdef NMEA0183_DECODE_GSV
+eERRORRESULT NMEA0183_ProcessGSV(const char* pSentence, NMEA0183_GSVdata* pData); //!< GNSS satellites in view
+#endif
+#ifdef NMEA0183_DECODE_HDG
+eERRORRESULT NMEA0183_ProcessHDG(const char* pSentence, NMEA0183_HDGdata* pData); //!< Heading, Deviation & Variation
+#endif
+#ifdef NMEA0183_DECODE_HDM
+eERRORRESULT NMEA0183_ProcessHDM(const char* pSentence, NMEA0183_HDMdata* pData); //!< Heading - Magnetic
+#endif
+#ifdef NMEA0183_DECODE_HDT
+eERRORRESULT NMEA0183_ProcessHDT(const char* pSentence, NMEA0183_HDTdata* pData); //!< Heading - True
+#endif
+#ifdef NMEA0183_DECODE_MTW
+eERRORRESULT NMEA0183_ProcessMTW(const char* pSentence, NMEA0183_MTWdata* pData); //!< Water Temperature
+#endif
+#ifdef NMEA0183_DECODE_MWV
+eERRORRESULT NMEA0183_ProcessMWV(const char* pSentence, NMEA0183_MWVdata* pData); //!< Wind Speed and Angle
+#endif
+#ifdef NMEA0183_DECODE_RMC
+eERRORRESULT NMEA0183_ProcessRMC(const char* pSentence, NMEA0183_RMCdata* pData); //!< Recommended minimum specific GNSS data
+#endif
+#ifdef NMEA0183_DECODE_TXT
+eERRORRESULT NMEA0183_ProcessTXT(const char* pSentence, NMEA0183_TXTdata* pData); //!< Texte message
+#endif
+#ifdef NMEA0183_DECODE_VHW
+eERRORRESULT NMEA0183_ProcessVHW(const char* pSentence, NMEA0183_VHWdata* pData); //!< Water Speed and Heading
+#endif
+#ifdef NMEA0183_DECODE_VTG
+eERRORRESULT NMEA0183_ProcessVTG(const char* pSentence, NMEA0183_VTGdata* pData); //!< Course Over Ground and Ground Speed
+#endif
+#ifdef NMEA0183_DECODE_ZDA
+eERRORRESULT NMEA0183_ProcessZDA(const char* pSentence, NMEA0183_ZDAdata* pData); //!< Time & Date
+#endif
+
+//-----------------------------------------------------------------------------
+
+/*! @brief Field parsers
+ *
+ * Each parser extracts one field (or a value field and its direction field for the coordinates) and stops on the delimiter that ends it (',' or '*'), the delimiter is not checked
+ * They are the primitives of the sentence parsers and of the sentence schemas of the C++ version
+ * @param[in/out] **ppStr Is the first char of the field (the original pointer will be advanced) and returns the position of the delimiter that ends the field
+ * @param[in] digits Is the digit count to extract after the decimal separator '.' (the value is multiplied by 10^digits)
+ * @param[out] *pData Is the value extracted
+ */
+int32_t NMEA0183_ParseFieldInt(char** ppStr, size_t digits);                   //!< Decimal or fixed point value, returns NMEA0183_NO_VALUE if the field is empty
+int32_t NMEA0183_ParseFieldIntDigits(char** ppStr, size_t count);              //!< Integer value of count digits at most, the parser stops after them even if the field has more chars. Returns NMEA0183_NO_VALUE if the field is empty
+uint32_t NMEA0183_ParseFieldHex(char** ppStr);                                 //!< Hexadecimal value, returns NMEA0183_NO_VALUE if the field is empty
+void NMEA0183_ParseFieldTime(char** ppStr, NMEA0183_Time* pData);              //!< Time <hhmmss[.zzz]>
+void NMEA0183_ParseFieldDate(char** ppStr, NMEA0183_Date* pData);              //!< Date <ddmmyy>
+bool NMEA0183_ParseFieldCoordinate(char** ppStr, NMEA0183_Coordinate* pData);  //!< Coordinate <(d)ddmm.mmmm[m][m][m]>,<N/S or E/W>, returns 'false' if the ',' between the 2 fields is missing
+bool NMEA0183_ParseFieldEscapedText(char** ppStr, char* pText, size_t size);  //!< Text of the last field up to the '*' with the '^hh' chars decoded, in pText of size chars with '\0' terminal (size shall not be 0). Returns 'false' if a '^' has no code
+
+/*! @brief Get the fields present in a sentence
+ *
+ * With NMEA0183_PRESENT_FIELDS, the PresentFields of the decoded data is set while the fields are parsed. Use this function with the sentence given to a parser alone (NMEA0183_ProcessXXX()) or in a sentence decoder registered by the user
+ * @param[in] *pSentence Is the first field of the sentence (just after the ',' that ends the address field). The sentence shall end with the '*' of the checksum or a '\0'
+ * @return Returns the fields not empty, bit N for the field N (the field 0 is the first field after the address, bit 31 for the fields 31 and more)
+ */
+uint32_t NMEA0183_GetPresentFields(const char* pSentence);
+
+#define NMEA0183_FIELD_BIT(field)                 ( 1u << ((field) < 31u ? (field) : 31u) )                     //! Bit of a field in PresentFields or ChangedFields
+#define NMEA0183_IS_FIELD_PRESENT(pData, field)   ( ((pData)->PresentFields & NMEA0183_FIELD_BIT(field)) != 0 ) //! Is the field of the decoded data not empty?
+#define NMEA0183_ARE_FIELDS_PRESENT(pData, mask)  ( ((pData)->PresentFields & (mask)) == (mask) )               //! Are all the fields of the mask not empty?
+
+/*! @brief Copy the chars of a string view to a string
+ *
+ * The HEX representations of ISO 8859-1 characters ('^' followed by 2 hex chars) are decoded here, the sentence parsers only set the view
+ * @param[in] *pView Is the string view to copy
+ * @param[out] *pString Is the string where the decoded chars will be copied (always '\0' terminated)
+ * @param[in] size Is the size of the string buffer, including the '\0' terminal
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_FULL if the string is truncated, ERR__PARSE_ERROR if a '^' is not followed by 2 hex chars
+ */
+eERRORRESULT NMEA0183_StringViewToString(const NMEA0183_StringView* pView, char* pString, size_t size);
+
+//-----------------------------------------------------------------------------
+
+
+#define NMEA0183_SENTENCE_VIEW_FIELDS_MAX  ( NMEA0183_FRAME_BUFFER_SIZE - 2 ) //! Maximum count of fields of a sentence view (an empty field is only its ',' delimiter, all the chars between the '$' and the '*' can be ',')
+
+//! NMEA0183 sentence view (the fields are parsed only when they are asked)
+typedef struct NMEA0183_SentenceView
+{
+  const char* pSentence;                                //!< Line of the sentence, starts with the '$'. The line shall stay available while the view is used
+  eNMEA0183_TalkerID TalkerID;                          //!< Talker ID of the sentence (first 2 chars of the address)
+  eNMEA0183_SentencesID SentenceID;                     //!< Sentence ID of a 5 chars address (can be a sentence unknown by this library), else NMEA0183_UNKNOWN
+  uint8_t AddressSize;                                  //!< Count of chars of the address field (after the '$')
+  uint8_t FieldCount;                                   //!< Count of fields after the address
+  uint8_t FieldPos[NMEA0183_SENTENCE_VIEW_FIELDS_MAX + 1]; //!< Position in the line of the delimiter before each field. The last one is the position of the '*'
+} NMEA0183_SentenceView;
+
+
+/*! @brief Initialize a sentence view on a NMEA0183 line
+ *
+ * The checksum is checked and the fields are tokenized in the same pass, each field is parsed only when a getter is called
+ * The line is never read past length and is not copied, it can be a known sentence, a sentence unknown by this library or NMEA0183_DecodedData.Frame
+ * @param[out] *pView Is the sentence view to initialize
+ * @param[in] *pLine Is the frame line to view (from '$' to the checksum, the \r\n terminal is optional)
+ * @param[in] length Is the count of characters of the line
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_FULL if the line is longer than a NMEA0183 frame
+ */
+eERRORRESULT Init_NMEA0183SentenceView(NMEA0183_SentenceView* pView, const char* pLine, size_t length);
+
+/*! @brief Get a raw field of the sentence view
+ *
+ * @param[in] *pView Is the sentence view to use
+ * @param[in] field Is the index of the field (0 is the first field after the address)
+ * @param[out] **ppField Is the first char of the field in the line (not '\0' terminated)
+ * @param[out] *pSize Is the count of chars of the field (0 if the field is empty)
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__OUT_OF_RANGE if the sentence does not have this field
+ */
+eERRORRESULT NMEA0183_SentenceView_GetField(const NMEA0183_SentenceView* pView, size_t field, const char** ppField, size_t* pSize);
+
+/*! @brief Get the char of a field of the sentence view (ex: <A/V>, <N/S>)
+ *
+ * @param[in] *pView Is the sentence view to use
+ * @param[in] field Is the index of the field (0 is the first field after the address)
+ * @param[out] *pValue Is the char of the field
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__EMPTY_DATA if the field is empty
+ */
+eERRORRESULT NMEA0183_SentenceView_GetChar(const NMEA0183_SentenceView* pView, size_t field, char* pValue);
+
+/*! @brief Get the integer value of a field of the sentence view
+ *
+ * @param[in] *pView Is the sentence view to use
+ * @param[in] field Is the index of the field (0 is the first field after the address)
+ * @param[in] digits Is the digit count to extract after the decimal separator '.' (the value is multiplied by 10^digits)
+ * @param[out] *pValue Is the value of the field
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__EMPTY_DATA if the field is empty
+ */
+eERRORRESULT NMEA0183_SentenceView_GetInt(const NMEA0183_SentenceView* pView, size_t field, size_t digits, int32_t* pValue);
+
+/*! @brief Get the coordinate of a field of the sentence view
+ *
+ * @param[in] *pView Is the sentence view to use
+ * @param[in] field Is the index of the coordinate field <(d)ddmm.mmmm[m][m][m]>, the next field is the direction <N/S or E/W>
+ * @param[out] *pValue Is the coordinate of the field
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__EMPTY_DATA if the field is empty
+ */
+eERRORRESULT NMEA0183_SentenceView_GetCoordinate(const NMEA0183_SentenceView* pView, size_t field, NMEA0183_Coordinate* pValue);
+
+/*! @brief Get the time of a field of the sentence view
+ *
+ * @param[in] *pView Is the sentence view to use
+ * @param[in] field Is the index of the time field <hhmmss[.zzz]>
+ * @param[out] *pValue Is the time of the field
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__EMPTY_DATA if the field is empty
+ */
+eERRORRESULT NMEA0183_SentenceView_GetTime(const NMEA0183_SentenceView* pView, size_t field, NMEA0183_Time* pValue);
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+typedef struct NMEA0183_SentenceHandler NMEA0183_SentenceHandler; //! Type definition of a sentence handler
+
+/*! @brief Function that calls the handler of a sentence
+ *
+ * @param[in] *pHandler Is the handler of the sentence
+ * @param[in] *pData Is the data of the sentence decoded on the stack (NMEA0183_xxxdata of the sentence, or NMEA0183_SentenceView for the sentences unknown by this library)
+ */
+typedef void (*NMEA0183_SentenceInvoke_Func)(const NMEA0183_SentenceHandler* pHandler, const void* pData);
+
+//! Sentence handler, one per NMEA0183_SENTENCE_HASH() slot of the sentence (the NMEA0183_SENTENCE_HASH_OTHERS slot is for the sentences unknown by this library)
+struct NMEA0183_SentenceHandler
+{
+  NMEA0183_SentenceInvoke_Func fnInvoke; //!< Function called with the data of the sentence, NULL if the sentence shall not be parsed
+  void (*fnHandler)(void);               //!< User handler of the sentence, free for fnInvoke
+  void* pContext;                        //!< User context of the handler, free for fnInvoke
+};
+
+
+#ifdef NMEA0183_USE_INPUT_BUFFER
+/*! @brief Dispatch the NMEA0183 frame to its handler (used with the decode structure)
+ *
+ * The sentence is parsed in a structure of its exact type on the stack then given to the handler of its slot, there is no NMEA0183_DecodedData
+ * The frame control is the same as NMEA0183_ProcessFrame(). The decoders registered with NMEA0183_RegisterSentenceDecoder() are not called, their sentences go to the NMEA0183_SENTENCE_HASH_OTHERS handler
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, a parse error of the sentence parser is returned with its offset in the fields (see NMEA0183_PARSE_ERROR_OFFSET_Get())
+ * @param[in] *pDecoder Is the decode input to use
+ * @param[in] *pHandlers Is the table of NMEA0183_SENTENCE_HASH_SLOTS handlers
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__UNKNOWN_ELEMENT if there is no handler for the sentence
+ */
+eERRORRESULT NMEA0183_DispatchFrame(NMEA0183_DecodeInput* pDecoder, const NMEA0183_SentenceHandler* pHandlers);
+#endif
+
+/*! @brief Dispatch the NMEA0183 frame line of a known length to its handler
+ *
+ * The sentence is parsed in a structure of its exact type on the stack then given to the handler of its slot, there is no NMEA0183_DecodedData
+ * With NMEA0183_PARSE_ERROR_DIAGNOSTICS, a parse error of the sentence parser is returned with its offset in the fields (see NMEA0183_PARSE_ERROR_OFFSET_Get())
+ * @param[in] *pLine Is the frame line to process (from '$' to the checksum, the \r\n terminal is optional)
+ * @param[in] length Is the count of characters of the line
+ * @param[in] *pHandlers Is the table of NMEA0183_SENTENCE_HASH_SLOTS handlers
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__UNKNOWN_ELEMENT if there is no handler for the sentence
+ */
+eERRORRESULT NMEA0183_DispatchLineN(const char* pLine, size_t length, const NMEA0183_SentenceHandler* pHandlers);
+#endif
+
+#ifdef NMEA0183_USER_SENTENCE_DECODERS_COUNT
+#define NMEA0183_ADDRESS_MAX_SIZE  ( 8 ) //! Maximum size of an address field registered with NMEA0183_RegisterSentenceDecoder()
+
+/*! @brief Sentence decoder registered by the user
+ *
+ * @param[in] *pFields Is the first field of the sentence (just after the address field and its ',')
+ * @param[out] *pData Is the decoded data. TalkerID and SentenceID are already set, the union is free for the decoder. With NMEA0183_PRESENT_FIELDS, PresentFields is 0 and can be set by the decoder (see NMEA0183_GetPresentFields())
+ * @param[in] *pContext Is the context given at registration
+ * @return Returns an #eERRORRESULT value enum
+ */
+typedef eERRORRESULT (*NMEA0183_UserSentenceDecoder_Func)(const char* pFields, NMEA0183_DecodedData* pData, void* pContext);
+
+/*! @brief Register a sentence decoder for a sentence unknown by this library
+ *
+ * The sentences decoded by this library have priority over the registered decoders
+ * A 3 characters address is a sentence ID from any talker (ex: "XDR"), any other address is the whole address field (ex: "PGRME", "PUBX")
+ * Registering again the same address replaces its decoder, a NULL decoder unregisters it
+ * The decoders are shared by all the decoders and shall be registered before decoding
+ * The registered decoders are not called by NMEA0183_DispatchFrame() and NMEA0183_DispatchLineN(), these sentences go to the NMEA0183_SENTENCE_HASH_OTHERS handler as a sentence view
+ * @param[in] *pAddress Is the address to decode (3 to NMEA0183_ADDRESS_MAX_SIZE characters)
+ * @param[in] fnDecode Is the decoder to call with the fields of the sentence, NULL to unregister
+ * @param[in] *pContext Is the context to give to the decoder
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT NMEA0183_RegisterSentenceDecoder(const char* pAddress, NMEA0183_UserSentenceDecoder_Func fnDecode, void* pContext);
+#endif
+
 //********************************************************************************************************************
 
 
@@ -48,6 +48,14 @@
 #ifdef NMEA0183_FLOAT_BASED_TOOLS
 #  include <math.h>
 #endif
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#  define NMEA0183_HAS_STRING_VIEW
+#  define NMEA0183_HAS_VARIANT
+#  include <string_view>
+#  include <variant>
+#  include <array>
+#  include <utility>
+#endif
 //-----------------------------------------------------------------------------
 
 
@@ -60,7 +68,7 @@
 class NMEA0183decoder
 {
   protected:
-    struct NMEA0183_InputBuffer InputData; // NMEA0183 decoder structure
+    NMEA0183_DecodeInput InputData; // NMEA0183 decoder structure
 
   public:
     /*! @brief Constructor
@@ -81,6 +89,56 @@ class NMEA0183decoder
      */
     eERRORRESULT AddReceivedCharacter(char data) { return NMEA0183_AddReceivedCharacter(&InputData, data); };
 
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+    /*! @brief Set the sentences subscribed by the decoder
+     *
+     * @param[in] sentenceMask Is the sentences to decode, a combination of NMEA0183_SUBSCRIBE(), NMEA0183_SUBSCRIBE_OTHERS or NMEA0183_SUBSCRIBE_ALL
+     * @param[in] talkerID Is the only talker ID to decode (ex: NMEA0183_GP), or NMEA0183_ANY_TALKER
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT SetSentenceSubscription(uint32_t sentenceMask, uint16_t talkerID = NMEA0183_ANY_TALKER) { return NMEA0183_SetSentenceSubscription(&InputData, sentenceMask, talkerID); };
+#endif
+
+    /*! @brief Get the count of resynchronizations of the decoder
+     *
+     * See NMEA0183_GetResyncCount()
+     * @param[out] *pCount Is the count of frames cut by a start delimiter
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT GetResyncCount(uint32_t* pCount) { return NMEA0183_GetResyncCount(&InputData, pCount); };
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+    /*! @brief Set the clock hook of the decoder
+     *
+     * See NMEA0183_SetReceiveClock()
+     * @param[in] fnClock Is the clock hook, NULL to stop reading the clock
+     * @param[in] *pContext Is the context given to the clock hook (can be NULL)
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT SetReceiveClock(NMEA0183_Clock_Func fnClock, void* pContext = NULL) { return NMEA0183_SetReceiveClock(&InputData, fnClock, pContext); };
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+    /*! @brief Get the statistics of the decoded frames cache
+     *
+     * @param[out] *pHits Is the count of frames found in the cache, not parsed again (can be NULL)
+     * @param[out] *pMisses Is the count of frames not found in the cache, parsed (can be NULL)
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT GetFrameCacheStatistics(uint32_t* pHits, uint32_t* pMisses) { return NMEA0183_GetFrameCacheStatistics(&InputData, pHits, pMisses); };
+#endif
+
+    /*! @brief Add a buffer of NMEA0183 received characters
+     *
+     * Each time a frame is complete, the function @p fnFrameReady is called with the decode input of this decoder
+     * @param[in] *pBuffer Is the buffer of received characters to add to the input data buffer
+     * @param[in] size Is the count of characters in the buffer
+     * @param[in] fnFrameReady Is the function called each time a frame is ready to process
+     * @param[in] *pContext Is a user context given to the @p fnFrameReady function (can be NULL)
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT AddReceivedBuffer(const char* pBuffer, size_t size, NMEA0183_FrameReady_Func fnFrameReady, void* pContext = NULL) { return NMEA0183_AddReceivedBuffer(&InputData, pBuffer, size, fnFrameReady, pContext); };
+
     /*! @brief Get decoder state
      * @return Returns an #eNMEA0183_State value enum
      */
@@ -110,6 +168,41 @@ class NMEA0183decoder
      */
     eERRORRESULT ProcessLine(const char* string, NMEA0183_DecodedData* pData);
 
+    /*! @brief Process the NMEA0183 frame line of a known length
+     *
+     * This function does not use the decoder, the line is decoded in place (from '$' to the checksum, the \r\n terminal is optional) and never read past length
+     * @param[in] *pLine Is the frame line to process
+     * @param[in] length Is the count of characters of the line
+     * @param[out] *pData Is the decoded data
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT ProcessLine(const char* pLine, size_t length, NMEA0183_DecodedData* pData) { return NMEA0183_ProcessLineN(pLine, length, pData); };
+
+#ifdef NMEA0183_COMPACT_OUTPUT
+    /*! @brief Process the NMEA0183 frame line of a known length in a compact record
+     *
+     * This function does not use the decoder, the record is a NMEA0183_CompactHeader followed by the data of the sentence with its exact type (see NMEA0183_ProcessLineCompact())
+     * @param[in] *pLine Is the frame line to process
+     * @param[in] length Is the count of characters of the line
+     * @param[out] *pRecord Is the buffer where the record will be written
+     * @param[in] size Is the count of bytes available in the buffer
+     * @param[out] *pRecordSize Is the count of bytes used by the record, 0 if no record is written
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT ProcessLineCompact(const char* pLine, size_t length, void* pRecord, size_t size, size_t* pRecordSize) { return NMEA0183_ProcessLineCompact(pLine, length, pRecord, size, pRecordSize); };
+#endif
+
+#ifdef NMEA0183_HAS_STRING_VIEW
+    /*! @brief Process the NMEA0183 frame line of a string view
+     *
+     * This function does not use the decoder, the line is decoded in place (from '$' to the checksum, the \r\n terminal is optional) and never read past its size
+     * @param[in] line Is the frame line to process
+     * @param[out] *pData Is the decoded data
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT ProcessLine(std::string_view line, NMEA0183_DecodedData* pData) { return NMEA0183_ProcessLineN(line.data(), line.size(), pData); };
+#endif
+
 #ifdef NMEA0183_FLOAT_BASED_TOOLS
   public:
     /*! @brief Convert coordinate to degree (D.d)
@@ -142,6 +235,1075 @@ class NMEA0183decoder
 
 
 
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+//********************************************************************************************************************
+// NMEA0183 frame queue decoder Class
+//********************************************************************************************************************
+class NMEA0183queueDecoder
+{
+  protected:
+    NMEA0183_FrameQueue InputQueue; // NMEA0183 frame queue structure
+
+  public:
+    /*! @brief Constructor
+     * Initialize NMEA0183 frame queue
+     */
+    NMEA0183queueDecoder() { (void)Init_NMEA0183FrameQueue(&InputQueue); };
+
+    /*! @brief Destructor
+     * Do nothing in this case
+     */
+    ~NMEA0183queueDecoder() { };
+
+  public:
+    /*! @brief Add NMEA0183 received frame character data (can be called in an interrupt)
+     *
+     * @param[in] data Is the char to add to the queue
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT AddReceivedCharacter(char data) { return NMEA0183_FrameQueue_AddReceivedCharacter(&InputQueue, data); };
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+    /*! @brief Set the sentences subscribed by the frame queue (shall not be called while characters are received)
+     *
+     * @param[in] sentenceMask Is the sentences to decode, a combination of NMEA0183_SUBSCRIBE(), NMEA0183_SUBSCRIBE_OTHERS or NMEA0183_SUBSCRIBE_ALL
+     * @param[in] talkerID Is the only talker ID to decode (ex: NMEA0183_GP), or NMEA0183_ANY_TALKER
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT SetSentenceSubscription(uint32_t sentenceMask, uint16_t talkerID = NMEA0183_ANY_TALKER) { return NMEA0183_FrameQueue_SetSentenceSubscription(&InputQueue, sentenceMask, talkerID); };
+#endif
+
+    /*! @brief Get the count of resynchronizations of all the slots of the frame queue
+     *
+     * See NMEA0183_FrameQueue_GetResyncCount()
+     * @param[out] *pCount Is the count of frames cut by a start delimiter
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT GetResyncCount(uint32_t* pCount) { return NMEA0183_FrameQueue_GetResyncCount(&InputQueue, pCount); };
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+    /*! @brief Set the clock hook of all the slots of the frame queue
+     *
+     * See NMEA0183_FrameQueue_SetReceiveClock()
+     * @param[in] fnClock Is the clock hook, NULL to stop reading the clock
+     * @param[in] *pContext Is the context given to the clock hook (can be NULL)
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT SetReceiveClock(NMEA0183_Clock_Func fnClock, void* pContext = NULL) { return NMEA0183_FrameQueue_SetReceiveClock(&InputQueue, fnClock, pContext); };
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+    /*! @brief Get the statistics of the decoded frames cache of the frame queue
+     *
+     * @param[out] *pHits Is the count of frames found in the cache, not parsed again (can be NULL)
+     * @param[out] *pMisses Is the count of frames not found in the cache, parsed (can be NULL)
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT GetFrameCacheStatistics(uint32_t* pHits, uint32_t* pMisses) { return NMEA0183_FrameQueue_GetFrameCacheStatistics(&InputQueue, pHits, pMisses); };
+#endif
+
+    /*! @brief Is a frame ready to process?
+     * @return Returns 'true' if at least one frame is ready to process else 'false'
+     */
+    bool IsFrameReadyToProcess(void) { return NMEA0183_FrameQueue_IsFrameReadyToProcess(&InputQueue); };
+
+    /*! @brief Get the count of frames ready to process
+     * @return Returns the count of frames waiting to be processed
+     */
+    size_t GetFrameCount(void) { return NMEA0183_FrameQueue_GetFrameCount(&InputQueue); };
+
+    /*! @brief Process the oldest NMEA0183 frame of the queue
+     *
+     * @param[out] *pData Is the decoded data
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT ProcessFrame(NMEA0183_DecodedData* pData) { return NMEA0183_FrameQueue_ProcessFrame(&InputQueue, pData); };
+};
+#endif
+
+
+
+
+
+#ifdef NMEA0183_RING_FRAMER
+//********************************************************************************************************************
+// NMEA0183 ring framer Class
+//********************************************************************************************************************
+class NMEA0183ringFramer
+{
+  protected:
+    NMEA0183_RingFramer Framer; // NMEA0183 ring framer structure
+
+  public:
+    /*! @brief Constructor
+     * Initialize NMEA0183 ring framer
+     * @param[in] *pRing Is the ring buffer where the caller writes the received characters
+     * @param[in] ringSize Is the size of the ring buffer, at least NMEA0183_FRAME_BUFFER_SIZE+2
+     */
+    NMEA0183ringFramer(const char* pRing, size_t ringSize) { (void)Init_NMEA0183RingFramer(&Framer, pRing, ringSize); };
+
+    /*! @brief Destructor
+     * Do nothing in this case
+     */
+    ~NMEA0183ringFramer() { };
+
+  public:
+    /*! @brief Get the next frame of the ring buffer
+     *
+     * See NMEA0183_RingFramer_GetFrame()
+     * @param[in] writePos Is the position in the ring where the caller will write the next received character
+     * @param[out] *pSpan Is the span of the frame in the ring
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT GetFrame(size_t writePos, NMEA0183_RingSpan* pSpan) { return NMEA0183_RingFramer_GetFrame(&Framer, writePos, pSpan); };
+
+    /*! @brief Process a NMEA0183 frame of the ring buffer
+     *
+     * @param[in] *pSpan Is the span of the frame given by GetFrame()
+     * @param[out] *pData Is the decoded data
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT ProcessFrame(const NMEA0183_RingSpan* pSpan, NMEA0183_DecodedData* pData) { return NMEA0183_RingFramer_ProcessFrame(&Framer, pSpan, pData); };
+
+    /*! @brief Release the frame given by GetFrame()
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT ReleaseFrame(void) { return NMEA0183_RingFramer_ReleaseFrame(&Framer); };
+
+    /*! @brief Get the read position of the ring framer, the caller can write over the characters before it
+     * @return Returns the position of the first character still needed by the ring framer
+     */
+    size_t GetReadPos(void) { return NMEA0183_RingFramer_GetReadPos(&Framer); };
+
+    /*! @brief Get the count of resynchronizations of the ring framer
+     *
+     * @param[out] *pCount Is the count of frames cut by a start delimiter
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT GetResyncCount(uint32_t* pCount) { return NMEA0183_RingFramer_GetResyncCount(&Framer, pCount); };
+};
+#endif
+
+
+
+
+
+//********************************************************************************************************************
+// NMEA0183 sentence view Class
+//********************************************************************************************************************
+class NMEA0183sentenceView
+{
+  protected:
+    NMEA0183_SentenceView View; // NMEA0183 sentence view structure
+
+  public:
+    /*! @brief Constructor
+     * The view is empty until Open() is called
+     */
+    NMEA0183sentenceView() { View.pSentence = NULL; View.FieldCount = 0; };
+
+    /*! @brief Destructor
+     * Do nothing in this case
+     */
+    ~NMEA0183sentenceView() { };
+
+  public:
+    /*! @brief Open the view on a NMEA0183 line (the line is not copied and shall stay available while the view is used)
+     *
+     * @param[in] *pLine Is the frame line to view (from '$' to the checksum, the \r\n terminal is optional)
+     * @param[in] length Is the count of characters of the line
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT Open(const char* pLine, size_t length) { return Init_NMEA0183SentenceView(&View, pLine, length); };
+
+#ifdef NMEA0183_HAS_STRING_VIEW
+    /*! @brief Open the view on a NMEA0183 line of a string view (the line is not copied and shall stay available while the view is used)
+     *
+     * @param[in] line Is the frame line to view
+     * @return Returns an #eERRORRESULT value enum
+     */
+    eERRORRESULT Open(std::string_view line) { return Init_NMEA0183SentenceView(&View, line.data(), line.size()); };
+#endif
+
+    //! Get the talker ID of the sentence
+    eNMEA0183_TalkerID GetTalkerID(void) const { return View.TalkerID; };
+    //! Get the sentence ID of the sentence (NMEA0183_UNKNOWN if the address is not 5 chars)
+    eNMEA0183_SentencesID GetSentenceID(void) const { return View.SentenceID; };
+    //! Get the count of fields after the address
+    size_t GetFieldCount(void) const { return View.FieldCount; };
+
+    //! Get a raw field of the sentence (see NMEA0183_SentenceView_GetField())
+    eERRORRESULT GetField(size_t field, const char** ppField, size_t* pSize) const { return NMEA0183_SentenceView_GetField(&View, field, ppField, pSize); };
+    //! Get the char of a field of the sentence (see NMEA0183_SentenceView_GetChar())
+    eERRORRESULT GetChar(size_t field, char* pValue) const { return NMEA0183_SentenceView_GetChar(&View, field, pValue); };
+    //! Get the integer value of a field of the sentence (see NMEA0183_SentenceView_GetInt())
+    eERRORRESULT GetInt(size_t field, size_t digits, int32_t* pValue) const { return NMEA0183_SentenceView_GetInt(&View, field, digits, pValue); };
+    //! Get the coordinate of a field of the sentence (see NMEA0183_SentenceView_GetCoordinate())
+    eERRORRESULT GetCoordinate(size_t field, NMEA0183_Coordinate* pValue) const { return NMEA0183_SentenceView_GetCoordinate(&View, field, pValue); };
+    //! Get the time of a field of the sentence (see NMEA0183_SentenceView_GetTime())
+    eERRORRESULT GetTime(size_t field, NMEA0183_Time* pValue) const { return NMEA0183_SentenceView_GetTime(&View, field, pValue); };
+};
+
+
+
+
+
+//********************************************************************************************************************
+// NMEA0183 sentence schemas
+//********************************************************************************************************************
+//! Fields of a sentence schema (Data is the structure of the sentence, Member the member where the field is stored)
+#define NMEA0183_SCHEMA_INT(Data, Member, Digits)  NMEA0183::Schema::Int<Data, decltype(Data::Member), &Data::Member, Digits> //!< Decimal or fixed point value (multiplied by 10^Digits)
+#define NMEA0183_SCHEMA_INT_DIGITS(Data, Member, Count) NMEA0183::Schema::IntDigits<Data, decltype(Data::Member), &Data::Member, Count> //!< Integer value of Count digits at most
+#define NMEA0183_SCHEMA_INT_DEFAULT(Data, Member, Digits, Default) NMEA0183::Schema::IntDefault<Data, decltype(Data::Member), &Data::Member, Digits, Default> //!< Decimal or fixed point value, Default if the field is empty
+#define NMEA0183_SCHEMA_HEX(Data, Member)          NMEA0183::Schema::Hex<Data, decltype(Data::Member), &Data::Member>         //!< Hexadecimal value
+#define NMEA0183_SCHEMA_HEX_SIGNED(Data, Member, Bits) NMEA0183::Schema::HexSigned<Data, decltype(Data::Member), &Data::Member, Bits> //!< Hexadecimal value of a signed integer of Bits bits (two's complement)
+#define NMEA0183_SCHEMA_CHAR(Data, Member)         NMEA0183::Schema::Char<Data, &Data::Member>                                //!< Char, the field shall not be empty
+#define NMEA0183_SCHEMA_CHAR_OR_SPACE(Data, Member) NMEA0183::Schema::CharOrSpace<Data, &Data::Member>                        //!< Char, ' ' if the field is empty
+#define NMEA0183_SCHEMA_TEXT(Data, Member)         NMEA0183::Schema::Text<Data, decltype(Data::Member), &Data::Member, false> //!< Text in a char array, '\0' terminated (or a view with NMEA0183_StringView member)
+#define NMEA0183_SCHEMA_LAST_TEXT(Data, Member)    NMEA0183::Schema::Text<Data, decltype(Data::Member), &Data::Member, true>  //!< Text of the last field, it can have ',' chars
+#define NMEA0183_SCHEMA_ESCAPED_TEXT(Data, Member) NMEA0183::Schema::EscapedText<Data, decltype(Data::Member), &Data::Member> //!< Text of the last field with the '^hh' chars decoded (a view is not decoded)
+#define NMEA0183_SCHEMA_STRING_VIEW(Data, Member) NMEA0183::Schema::StringView<Data, &Data::Member>                         //!< Text not copied, view in the parsed sentence
+#define NMEA0183_SCHEMA_TIME(Data, Member)         NMEA0183::Schema::Time<Data, &Data::Member>                                //!< Time <hhmmss[.zzz]>
+#define NMEA0183_SCHEMA_DATE(Data, Member)         NMEA0183::Schema::Date<Data, &Data::Member>                                //!< Date <ddmmyy>
+#define NMEA0183_SCHEMA_COORDINATE(Data, Member)   NMEA0183::Schema::Coordinate<Data, &Data::Member>                          //!< Coordinate and its direction (2 fields)
+#define NMEA0183_SCHEMA_ZONE(Data, Hour, Minute)   NMEA0183::Schema::Zone<Data, &Data::Hour, &Data::Minute>                   //!< Local zone hours and minutes, the minutes are negative for a -00 hour (2 fields)
+#define NMEA0183_SCHEMA_UNIT(Unit)                 NMEA0183::Schema::Literal<Unit>                                            //!< Literal char (unit), not stored
+#define NMEA0183_SCHEMA_UNIT_OR_EMPTY(Unit)        NMEA0183::Schema::LiteralOrEmpty<Unit>                                     //!< Literal char (unit) or empty field, not stored
+#define NMEA0183_SCHEMA_SKIP                       NMEA0183::Schema::Skip                                                     //!< Field ignored
+#define NMEA0183_SCHEMA_SET(Data, Member, Value)   NMEA0183::Schema::Set<Data, decltype(Data::Member), &Data::Member, Value>  //!< Value set in the data, not a field of the sentence
+#define NMEA0183_SCHEMA_IN(Data, Member, Field)    NMEA0183::Schema::Nested<Data, decltype(Data::Member), &Data::Member, Field> //!< Field of a structure member (the Field is declared on the structure of the member)
+#define NMEA0183_SCHEMA_INT_ARRAY(Data, Member, Digits) NMEA0183::Schema::Array<Data, decltype(Data::Member), &Data::Member, NMEA0183::Schema::ArrayTraits<decltype(Data::Member)>::COUNT, \
+                                                        NMEA0183::Schema::IntValue<NMEA0183::Schema::ArrayTraits<decltype(Data::Member)>::Element, Digits> > //!< One decimal value field for each item of the array
+#define NMEA0183_SCHEMA_GROUPS(Data, Member, MinCount, ...) NMEA0183::Schema::Array<Data, decltype(Data::Member), &Data::Member, MinCount, __VA_ARGS__> //!< Group of fields for each item of the array (the fields are declared on the item structure), the groups after MinCount can be missing, even partly
+#define NMEA0183_SCHEMA_OPTIONAL(Field)            NMEA0183::Schema::Optional<Field>                                          //!< Trailing field that can be missing
+
+/*! @brief Sentence schemas
+ *
+ * A sentence is declared as the list of its fields, its parser is generated at compile time: the type of each field is resolved by the compiler and there is no test of the field type while parsing.
+ * Example: struct ROT : NMEA0183::Schema::Sentence<ROTdata, NMEA0183_SCHEMA_INT(ROTdata, Rate, 1), NMEA0183_SCHEMA_CHAR(ROTdata, Status)> {};
+ * Each field stops on the delimiter that ends it, the schema checks the ',' between the fields and the final '*'.
+ * The optional fields shall be the last ones: a missing field is parsed on the '*' (NMEA0183_NO_VALUE, ' ' or empty text), like the hand-written parsers.
+ * The schemas of the sentences decoded by the library are NMEA0183::Schema::AAM to NMEA0183::Schema::ZDA
+ */
+namespace NMEA0183
+{
+  namespace Schema
+  {
+    //! Base of the field types, the type FieldT is one required field and a missing field is parsed on the '*'
+    template<class FieldT> struct FieldType
+    {
+      static const bool OPTIONAL = false;
+      static const size_t FIELDS = 1;
+      template<class DataT> static bool Missing(char* pEnd, DataT* pData) { return FieldT::Parse(&pEnd, pData); };
+    };
+
+    //! Decimal or fixed point value field
+    template<class DataT, typename T, T DataT::*Member, size_t Digits> struct Int : public FieldType<Int<DataT, T, Member, Digits> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { pData->*Member = (T)NMEA0183_ParseFieldInt(ppStr, Digits); return true; };
+    };
+
+    //! Integer value field of Count digits at most
+    template<class DataT, typename T, T DataT::*Member, size_t Count> struct IntDigits : public FieldType<IntDigits<DataT, T, Member, Count> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { pData->*Member = (T)NMEA0183_ParseFieldIntDigits(ppStr, Count); return true; };
+    };
+
+    //! Decimal or fixed point value field, Default if the field is empty
+    template<class DataT, typename T, T DataT::*Member, size_t Digits, T Default> struct IntDefault : public FieldType<IntDefault<DataT, T, Member, Digits, Default> >
+    {
+      static bool Parse(char** ppStr, DataT* pData)
+      {
+        if ((**ppStr == NMEA0183_FIELD_DELIMITER) || (**ppStr == NMEA0183_CHECKSUM_DELIMITER)) { pData->*Member = Default; return true; }
+        pData->*Member = (T)NMEA0183_ParseFieldInt(ppStr, Digits);
+        return true;
+      };
+    };
+
+    //! Hexadecimal value field
+    template<class DataT, typename T, T DataT::*Member> struct Hex : public FieldType<Hex<DataT, T, Member> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { pData->*Member = (T)NMEA0183_ParseFieldHex(ppStr); return true; };
+    };
+
+    //! Hexadecimal value field of a signed integer of Bits bits, sign extended to the member
+    template<class DataT, typename T, T DataT::*Member, size_t Bits> struct HexSigned : public FieldType<HexSigned<DataT, T, Member, Bits> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { pData->*Member = NMEA0183_DATA_EXTRACT_TO_SIGNED(T, NMEA0183_ParseFieldHex(ppStr), 0, Bits); return true; };
+    };
+
+    //! Char field, the char is taken even if the field is empty (then the schema fails on the delimiter check)
+    template<class DataT, char DataT::*Member> struct Char : public FieldType<Char<DataT, Member> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { pData->*Member = **ppStr; ++(*ppStr); return true; };
+      static bool Missing(char*, DataT* pData) { pData->*Member = ' '; return true; };
+    };
+
+    //! Char field that can be empty
+    template<class DataT, char DataT::*Member> struct CharOrSpace : public FieldType<CharOrSpace<DataT, Member> >
+    {
+      static bool Parse(char** ppStr, DataT* pData)
+      {
+        if ((**ppStr == NMEA0183_FIELD_DELIMITER) || (**ppStr == NMEA0183_CHECKSUM_DELIMITER) || (**ppStr == '\0')) { pData->*Member = ' '; return true; }
+        pData->*Member = **ppStr;
+        ++(*ppStr);
+        return true;
+      };
+    };
+
+    //! Text field stored in a char array, the text of the last field can have ',' chars
+    template<class DataT, typename T, T DataT::*Member, bool LastField> struct Text : public FieldType<Text<DataT, T, Member, LastField> >
+    {
+      static bool Parse(char** ppStr, DataT* pData)
+      {
+        char* pText = &(pData->*Member)[0];
+        size_t TxtPos = 0;
+        while ((TxtPos < (sizeof(T) - 1)) && (**ppStr != NMEA0183_CHECKSUM_DELIMITER) && (**ppStr != '\0'))
+        {
+          if ((LastField == false) && (**ppStr == NMEA0183_FIELD_DELIMITER)) break;
+          pText[TxtPos++] = *((*ppStr)++);
+        }
+        pText[TxtPos] = '\0';
+        return true;
+      };
+    };
+
+    //! Text field not copied, stored as a view in the parsed sentence
+    template<class DataT, NMEA0183_StringView DataT::*Member, bool LastField> struct Text<DataT, NMEA0183_StringView, Member, LastField> : public FieldType<Text<DataT, NMEA0183_StringView, Member, LastField> >
+    {
+      static bool Parse(char** ppStr, DataT* pData)
+      {
+        const char* pStart = *ppStr;
+        while ((*ppStr - pStart < 0xFF) && (**ppStr != NMEA0183_CHECKSUM_DELIMITER) && (**ppStr != '\0'))
+        {
+          if ((LastField == false) && (**ppStr == NMEA0183_FIELD_DELIMITER)) break;
+          ++(*ppStr);
+        }
+        (pData->*Member).pChars = pStart;
+        (pData->*Member).Size   = (uint8_t)(*ppStr - pStart);
+        return true;
+      };
+    };
+
+    //! Text field not copied, stored as a view in the parsed sentence
+    template<class DataT, NMEA0183_StringView DataT::*Member> struct StringView : public Text<DataT, NMEA0183_StringView, Member, false> {};
+
+    //! Text of the last field with the '^hh' chars decoded, stored in a char array
+    template<class DataT, typename T, T DataT::*Member> struct EscapedText : public FieldType<EscapedText<DataT, T, Member> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { return NMEA0183_ParseFieldEscapedText(ppStr, &(pData->*Member)[0], sizeof(T)); };
+    };
+
+    //! Text of the last field stored as a view, the '^hh' chars are decoded by NMEA0183_StringViewToString()
+    template<class DataT, NMEA0183_StringView DataT::*Member> struct EscapedText<DataT, NMEA0183_StringView, Member> : public Text<DataT, NMEA0183_StringView, Member, true> {};
+
+    //! Time field
+    template<class DataT, NMEA0183_Time DataT::*Member> struct Time : public FieldType<Time<DataT, Member> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { NMEA0183_ParseFieldTime(ppStr, &(pData->*Member)); return true; };
+    };
+
+    //! Date field
+    template<class DataT, NMEA0183_Date DataT::*Member> struct Date : public FieldType<Date<DataT, Member> >
+    {
+      static bool Parse(char** ppStr, DataT* pData) { NMEA0183_ParseFieldDate(ppStr, &(pData->*Member)); return true; };
+    };
+
+    //! Coordinate and direction fields
+    template<class DataT, NMEA0183_Coordinate DataT::*Member> struct Coordinate : public FieldType<Coordinate<DataT, Member> >
+    {
+      static const size_t FIELDS = 2;
+      static bool Parse(char** ppStr, DataT* pData) { return NMEA0183_ParseFieldCoordinate(ppStr, &(pData->*Member)); };
+      static bool Missing(char*, DataT* pData) { (pData->*Member).Direction = ' '; (pData->*Member).Degree = (uint8_t)NMEA0183_NO_VALUE; (pData->*Member).Minute = (uint32_t)NMEA0183_NO_VALUE; return true; };
+    };
+
+    //! Local zone hours and minutes fields, the minutes are negative if the hours are -00
+    template<class DataT, int8_t DataT::*Hour, int8_t DataT::*Minute> struct Zone : public FieldType<Zone<DataT, Hour, Minute> >
+    {
+      static const size_t FIELDS = 2;
+      static bool Parse(char** ppStr, DataT* pData)
+      {
+        const char* pHour = *ppStr;
+        pData->*Hour = (int8_t)NMEA0183_ParseFieldInt(ppStr, 0);
+        if (**ppStr != NMEA0183_FIELD_DELIMITER) return false;          // Parsing: Should be a ','
+        ++(*ppStr);
+        pData->*Minute = (int8_t)NMEA0183_ParseFieldInt(ppStr, 0);
+        if ((pData->*Hour == 0) && (*pHour == '-')) pData->*Minute = (int8_t)(-(pData->*Minute));
+        return true;
+      };
+      static bool Missing(char*, DataT* pData) { pData->*Hour = (int8_t)NMEA0183_NO_VALUE; pData->*Minute = (int8_t)NMEA0183_NO_VALUE; return true; };
+    };
+
+    //! Literal char field (unit)
+    template<char Unit> struct Literal : public FieldType<Literal<Unit> >
+    {
+      template<class DataT> static bool Parse(char** ppStr, DataT*) { if (**ppStr != Unit) return false; ++(*ppStr); return true; };
+      template<class DataT> static bool Missing(char*, DataT*) { return true; };
+    };
+
+    //! Literal char field (unit) that can be empty
+    template<char Unit> struct LiteralOrEmpty : public FieldType<LiteralOrEmpty<Unit> >
+    {
+      template<class DataT> static bool Parse(char** ppStr, DataT*) { if (**ppStr == Unit) ++(*ppStr); return true; };
+    };
+
+    //! Field ignored
+    struct Skip : public FieldType<Skip>
+    {
+      template<class DataT> static bool Parse(char** ppStr, DataT*) { while ((**ppStr != NMEA0183_FIELD_DELIMITER) && (**ppStr != NMEA0183_CHECKSUM_DELIMITER) && (**ppStr != '\0')) ++(*ppStr); return true; };
+    };
+
+    //! Value set in the data, no field of the sentence is parsed
+    template<class DataT, typename T, T DataT::*Member, T Value> struct Set
+    {
+      static const bool OPTIONAL = true;
+      static const size_t FIELDS = 0;
+      static bool Parse(char**, DataT* pData) { pData->*Member = Value; return true; };
+      static bool Missing(char*, DataT* pData) { pData->*Member = Value; return true; };
+    };
+
+    //! Field of a structure member, the Field is declared on the structure T of the member
+    template<class DataT, typename T, T DataT::*Member, class Field> struct Nested
+    {
+      static const bool OPTIONAL = false;
+      static const size_t FIELDS = Field::FIELDS;
+      static bool Parse(char** ppStr, DataT* pData) { return Field::Parse(ppStr, &(pData->*Member)); };
+      static bool Missing(char* pEnd, DataT* pData) { return Field::Missing(pEnd, &(pData->*Member)); };
+    };
+
+    //! Trailing field that can be missing
+    template<class Field> struct Optional : public Field
+    {
+      static const bool OPTIONAL = true;
+    };
+
+    //! Item type and count of an array member
+    template<class ArrayT> struct ArrayTraits;
+    template<typename T, size_t N> struct ArrayTraits<T[N]>
+    {
+      typedef T Element;
+      static const size_t COUNT = N;
+    };
+
+    //! Decimal or fixed point value field of an array item
+    template<typename T, size_t Digits> struct IntValue : public FieldType<IntValue<T, Digits> >
+    {
+      static bool Parse(char** ppStr, T* pValue) { *pValue = (T)NMEA0183_ParseFieldInt(ppStr, Digits); return true; };
+    };
+
+    //! Result of the parse of the fields of an array item
+    enum eArrayParse
+    {
+      ARRAY_NEXT,  //!< The fields of the item are parsed, the next item follows
+      ARRAY_END,   //!< The sentence ends in the item, the fields left are parsed on the '*'
+      ARRAY_ERROR, //!< Parse error
+    };
+
+    //! Fields of an array item, each one is preceded by its ',' except the first field of the array
+    template<class... Fields> struct ElementFields;
+    template<> struct ElementFields<>
+    {
+      static const size_t FIELDS = 0;
+      template<class ElementT> static eArrayParse Parse(char**, ElementT*, bool, bool) { return ARRAY_NEXT; };
+      template<class ElementT> static bool Missing(char*, ElementT*) { return true; };
+    };
+    template<class Field, class... Rest> struct ElementFields<Field, Rest...>
+    {
+      static const size_t FIELDS = Field::FIELDS + ElementFields<Rest...>::FIELDS;
+      template<class ElementT> static eArrayParse Parse(char** ppStr, ElementT* pElement, bool first, bool required)
+      {
+        if (first == false)
+        {
+          if (**ppStr != NMEA0183_FIELD_DELIMITER)
+          {
+            if (required) return ARRAY_ERROR;                           // Parsing: Should be a ','
+            return (Missing(*ppStr, pElement) ? ARRAY_END : ARRAY_ERROR); // The first missing field ends the array
+          }
+          ++(*ppStr);                                                   // Parsing: Skip ','
+        }
+        if (Field::Parse(ppStr, pElement) == false) return ARRAY_ERROR;
+        return ElementFields<Rest...>::Parse(ppStr, pElement, false, required);
+      };
+      template<class ElementT> static bool Missing(char* pEnd, ElementT* pElement)
+      {
+        if (Field::Missing(pEnd, pElement) == false) return false;
+        return ElementFields<Rest...>::Missing(pEnd, pElement);
+      };
+    };
+
+    //! Array of items, each item is a group of fields. The items after MinCount can be missing, even partly, their fields are parsed on the '*'
+    template<class DataT, class ArrayT, ArrayT DataT::*Member, size_t MinCount, class... Fields> struct Array
+    {
+      typedef typename ArrayTraits<ArrayT>::Element Element;
+      static_assert((MinCount > 0) && (MinCount <= ArrayTraits<ArrayT>::COUNT), "The array shall have at least one item");
+      static const bool OPTIONAL = false;
+      static const size_t FIELDS = ArrayTraits<ArrayT>::COUNT * ElementFields<Fields...>::FIELDS;
+      static const size_t REQUIRED_FIELDS = MinCount * ElementFields<Fields...>::FIELDS;
+      static bool Parse(char** ppStr, DataT* pData)
+      {
+        Element* pElements = &(pData->*Member)[0];
+        for (size_t z = 0; z < ArrayTraits<ArrayT>::COUNT; ++z)
+        {
+          const eArrayParse Result = ElementFields<Fields...>::Parse(ppStr, &pElements[z], (z == 0), (z < MinCount));
+          if (Result == ARRAY_ERROR) return false;
+          if (Result == ARRAY_END) return Missing(*ppStr, pData, z + 1);
+        }
+        return true;
+      };
+      static bool Missing(char* pEnd, DataT* pData, size_t first = 0)
+      {
+        Element* pElements = &(pData->*Member)[0];
+        for (size_t z = first; z < ArrayTraits<ArrayT>::COUNT; ++z)
+          if (ElementFields<Fields...>::Missing(pEnd, &pElements[z]) == false) return false;
+        return true;
+      };
+    };
+
+    //! Count of fields that shall be in the sentence for a field type
+    template<class Field> struct RequiredFields { static const size_t VALUE = (Field::OPTIONAL ? 0 : Field::FIELDS); };
+    template<class DataT, class ArrayT, ArrayT DataT::*Member, size_t MinCount, class... Fields> struct RequiredFields<Array<DataT, ArrayT, Member, MinCount, Fields...> >
+    {
+      static const size_t VALUE = Array<DataT, ArrayT, Member, MinCount, Fields...>::REQUIRED_FIELDS;
+    };
+
+    //! Set the bits of the fields not empty between pField and pEnd (the chars consumed by a field type) if the data has a PresentFields member
+    template<class DataT> auto SetPresentFields(DataT* pData, size_t field, size_t count, const char* pField, const char* pEnd, int) -> decltype((void)(pData->PresentFields = 0u))
+    {
+      if (count == 1) { if (pEnd != pField) pData->PresentFields |= NMEA0183_FIELD_BIT(field); return; } // The parser stopped on the delimiter, the field is not empty if it moved
+      for (; pField != pEnd; ++pField)                                  // Field type over several fields (ex: coordinate and its direction)
+        if (*pField == NMEA0183_FIELD_DELIMITER) ++field; else pData->PresentFields |= NMEA0183_FIELD_BIT(field);
+    }
+    template<class DataT> void SetPresentFields(DataT*, size_t, size_t, const char*, const char*, long) {}
+
+    //! Clear the fields present if the data has a PresentFields member
+    template<class DataT> auto ClearPresentFields(DataT* pData, int) -> decltype((void)(pData->PresentFields = 0u)) { pData->PresentFields = 0; }
+    template<class DataT> void ClearPresentFields(DataT*, long) {}
+
+    //! Parse a field type and set the bits of its fields not empty
+    template<class Field, class DataT> inline bool ParseField(char** ppStr, DataT* pData, size_t field)
+    {
+      const char* pField = *ppStr;
+      if (Field::Parse(ppStr, pData) == false) return false;
+      SetPresentFields(pData, field, Field::FIELDS, pField, *ppStr, 0);
+      return true;
+    }
+
+    //! Fields after the first one, each one is preceded by its ',' (except the values set without field)
+    template<class... Fields> struct FieldList;
+    template<> struct FieldList<>
+    {
+      static const size_t FIELDS = 0;
+      static const size_t MIN_FIELDS = 0;
+      template<class DataT> static bool Parse(char**, DataT*, size_t) { return true; };
+      template<class DataT> static bool Missing(char*, DataT*) { return true; };
+    };
+    template<class Field, class... Rest> struct FieldList<Field, Rest...>
+    {
+      static const size_t FIELDS = Field::FIELDS + FieldList<Rest...>::FIELDS;
+      static const size_t MIN_FIELDS = RequiredFields<Field>::VALUE + FieldList<Rest...>::MIN_FIELDS;
+      template<class DataT> static bool Parse(char** ppStr, DataT* pData, size_t field)
+      {
+        if (Field::FIELDS > 0)
+        {
+          if (**ppStr != NMEA0183_FIELD_DELIMITER) return Missing(*ppStr, pData); // The first missing field ends the sentence
+          ++(*ppStr);                                                   // Parsing: Skip ','
+        }
+        if (ParseField<Field>(ppStr, pData, field) == false) return false;
+        return FieldList<Rest...>::Parse(ppStr, pData, field + Field::FIELDS);
+      };
+      template<class DataT> static bool Missing(char* pEnd, DataT* pData)
+      {
+        if (Field::OPTIONAL == false) return false;                     // Parsing: Should be a ','
+        if (Field::Missing(pEnd, pData) == false) return false;         // The missing optional fields are parsed on the '*'
+        return FieldList<Rest...>::Missing(pEnd, pData);
+      };
+    };
+
+    //! Parse error of a sentence at the current character (the offset is in the error with NMEA0183_PARSE_ERROR_DIAGNOSTICS, as the hand-written parsers)
+    inline eERRORRESULT ParseError(const char* pSentence, const char* pStr)
+    {
+#ifdef NMEA0183_PARSE_ERROR_DIAGNOSTICS
+      return NMEA0183_PARSE_ERROR_AT(pStr - pSentence);
+#else
+      (void)pSentence; (void)pStr;
+      return ERR__PARSE_ERROR;
+#endif
+    }
+
+    //! Sentence schema, the sentence parser is generated from the list of its fields
+    template<class DataT, class Field, class... Rest> struct Sentence
+    {
+      static_assert(Field::OPTIONAL == false, "The first field of a sentence cannot be optional");
+      typedef DataT Data;
+      static const size_t FIELDS = Field::FIELDS + FieldList<Rest...>::FIELDS;                              //!< Count of fields of the sentence
+      static const size_t MIN_FIELDS = RequiredFields<Field>::VALUE + FieldList<Rest...>::MIN_FIELDS;      //!< Count of fields that shall be in the sentence
+
+      /*! @brief Parse a sentence
+       * @param[in] *pSentence Is the first field of the sentence (just after the ',' that ends the address field). The sentence shall end with the '*' of the checksum or a '\0'
+       * @param[out] *pData Is the decoded data of the sentence
+       * @return Returns an #eERRORRESULT value enum
+       */
+      static eERRORRESULT Parse(const char* pSentence, Data* pData)
+      {
+        char* pStr = (char*)pSentence;
+        ClearPresentFields(pData, 0);                                   // The bit of each field is set while it is parsed, as the decoded data of the library
+        if ((ParseField<Field>(&pStr, pData, 0) == false) || (FieldList<Rest...>::Parse(&pStr, pData, Field::FIELDS) == false)
+         || (*pStr != NMEA0183_CHECKSUM_DELIMITER)) return ParseError(pSentence, pStr); // Should end with a '*'
+        return ERR_OK;
+      };
+    };
+
+    //! Sentence with an older format with less fields, the older format is used if the sentence has less fields than the ones required by the current format
+    template<class Current, class Older> struct SentenceWithOlderFormat
+    {
+      typedef typename Current::Data Data;
+
+      //! Parse a sentence (see Sentence::Parse())
+      static eERRORRESULT Parse(const char* pSentence, Data* pData)
+      {
+        size_t FieldCount = 1;
+        for (const char* pChar = pSentence; (*pChar != NMEA0183_CHECKSUM_DELIMITER) && (*pChar != '\0'); ++pChar)
+          if (*pChar == NMEA0183_FIELD_DELIMITER) ++FieldCount;
+        if (FieldCount < Current::MIN_FIELDS) return Older::Parse(pSentence, pData);
+        return Current::Parse(pSentence, pData);
+      };
+    };
+  }
+}
+
+
+
+
+
+//********************************************************************************************************************
+// NMEA0183 sentence schemas of the library (each one decodes as its hand-written parser NMEA0183_ProcessXXX())
+//********************************************************************************************************************
+namespace NMEA0183
+{
+  namespace Schema
+  {
+#ifdef NMEA0183_DECODE_AAM
+    //! AAM sentence schema
+    struct AAM : public Sentence<NMEA0183_AAMdata, NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_AAMdata, ArrivalStatus), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_AAMdata, PassedWaypoint),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_AAMdata, CircleRadius, 4), NMEA0183_SCHEMA_UNIT('N'), NMEA0183_SCHEMA_LAST_TEXT(NMEA0183_AAMdata, WaypointID)> {};
+#endif
+#ifdef NMEA0183_DECODE_ALM
+    //! ALM sentence schema
+    struct ALM : public Sentence<NMEA0183_ALMdata, NMEA0183_SCHEMA_INT(NMEA0183_ALMdata, TotalSentence, 0), NMEA0183_SCHEMA_INT(NMEA0183_ALMdata, SentenceNumber, 0),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_ALMdata, SatellitePRNnumber, 0), NMEA0183_SCHEMA_INT(NMEA0183_ALMdata, GPSweekNumber, 0),
+                                 NMEA0183_SCHEMA_HEX(NMEA0183_ALMdata, SV_NAVhealth), NMEA0183_SCHEMA_HEX(NMEA0183_ALMdata, e), NMEA0183_SCHEMA_HEX(NMEA0183_ALMdata, toa),
+                                 NMEA0183_SCHEMA_HEX(NMEA0183_ALMdata, Sigma_i), NMEA0183_SCHEMA_HEX(NMEA0183_ALMdata, OMEGADOT), NMEA0183_SCHEMA_HEX(NMEA0183_ALMdata, Root_A),
+                                 NMEA0183_SCHEMA_HEX_SIGNED(NMEA0183_ALMdata, OMEGA, 24), NMEA0183_SCHEMA_HEX_SIGNED(NMEA0183_ALMdata, OMEGA_0, 24), NMEA0183_SCHEMA_HEX_SIGNED(NMEA0183_ALMdata, Mo, 24),
+                                 NMEA0183_SCHEMA_HEX_SIGNED(NMEA0183_ALMdata, af0, 11), NMEA0183_SCHEMA_HEX_SIGNED(NMEA0183_ALMdata, af1, 11)> {};
+#endif
+#ifdef NMEA0183_DECODE_APB
+    //! APB sentence schema
+    struct APB : public Sentence<NMEA0183_APBdata, NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, Status1), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, Status2),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_APBdata, MagnitudeXTE, 4), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, DirectionSteer), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, XTEunit),
+                                 NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, ArrivalStatus), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, PassedWaypoint),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_APBdata, BearingOriginToDest, 2), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, BearingOtoDunit), NMEA0183_SCHEMA_TEXT(NMEA0183_APBdata, WaypointID),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_APBdata, BearingCurPosToDest, 2), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, BearingCPtoDunit),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_APBdata, HeadingToSteerToDest, 2), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, H2StoDunit),
+                                 NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_APBdata, FAAmode))> {};
+#endif
+#ifdef NMEA0183_DECODE_BEC
+    //! BEC sentence schema
+    struct BEC : public Sentence<NMEA0183_BECdata, NMEA0183_SCHEMA_TIME(NMEA0183_BECdata, Time), NMEA0183_SCHEMA_COORDINATE(NMEA0183_BECdata, WaypointLat), NMEA0183_SCHEMA_COORDINATE(NMEA0183_BECdata, WaypointLong),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_BECdata, BearingTrue, 2), NMEA0183_SCHEMA_UNIT('T'), NMEA0183_SCHEMA_INT(NMEA0183_BECdata, BearingMagnetic, 2), NMEA0183_SCHEMA_UNIT('M'),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_BECdata, Distance, 4), NMEA0183_SCHEMA_UNIT('N'), NMEA0183_SCHEMA_LAST_TEXT(NMEA0183_BECdata, WaypointID)> {};
+#endif
+#ifdef NMEA0183_DECODE_BOD
+    //! BOD sentence schema
+    struct BOD : public Sentence<NMEA0183_BODdata, NMEA0183_SCHEMA_INT(NMEA0183_BODdata, BearingTrue, 2), NMEA0183_SCHEMA_UNIT('T'), NMEA0183_SCHEMA_INT(NMEA0183_BODdata, BearingMagnetic, 2), NMEA0183_SCHEMA_UNIT('M'),
+                                 NMEA0183_SCHEMA_TEXT(NMEA0183_BODdata, DestWaypointID), NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_LAST_TEXT(NMEA0183_BODdata, OriginWaypointID))> {};
+#endif
+#ifdef NMEA0183_DECODE_BWW
+    //! BWW sentence schema
+    struct BWW : public Sentence<NMEA0183_BWWdata, NMEA0183_SCHEMA_INT(NMEA0183_BWWdata, BearingTrue, 2), NMEA0183_SCHEMA_UNIT('T'), NMEA0183_SCHEMA_INT(NMEA0183_BWWdata, BearingMagnetic, 2), NMEA0183_SCHEMA_UNIT('M'),
+                                 NMEA0183_SCHEMA_TEXT(NMEA0183_BWWdata, FromWaypointID), NMEA0183_SCHEMA_LAST_TEXT(NMEA0183_BWWdata, ToWaypointID)> {};
+#endif
+#if defined(NMEA0183_DECODE_DBK) || defined(NMEA0183_DECODE_DBS) || defined(NMEA0183_DECODE_DBT)
+    //! DBK, DBS and DBT sentences schema
+    struct DBx : public Sentence<NMEA0183_DBxdata, NMEA0183_SCHEMA_INT(NMEA0183_DBxdata, DepthFeet, 3), NMEA0183_SCHEMA_UNIT('f'), NMEA0183_SCHEMA_INT(NMEA0183_DBxdata, DepthMeter, 3), NMEA0183_SCHEMA_UNIT('M'),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_DBxdata, DepthFathom, 3), NMEA0183_SCHEMA_UNIT('F')> {};
+#endif
+#ifdef NMEA0183_DECODE_DPT
+    //! DPT sentence schema
+    struct DPT : public Sentence<NMEA0183_DPTdata, NMEA0183_SCHEMA_INT(NMEA0183_DPTdata, DepthMeter, 3), NMEA0183_SCHEMA_INT_DEFAULT(NMEA0183_DPTdata, OffsetTrans, 2, 0),
+                                 NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_INT(NMEA0183_DPTdata, RangeScale, 0))> {};
+#endif
+#ifdef NMEA0183_DECODE_FSI
+    //! FSI sentence schema
+    struct FSI : public Sentence<NMEA0183_FSIdata, NMEA0183_SCHEMA_INT(NMEA0183_FSIdata, TxFrequency, 3), NMEA0183_SCHEMA_INT(NMEA0183_FSIdata, RxFrequency, 3),
+                                 NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_FSIdata, Mode), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_FSIdata, PowerLevel)> {};
+#endif
+#ifdef NMEA0183_DECODE_GGA
+    //! GGA sentence schema
+    struct GGA : public Sentence<NMEA0183_GGAdata, NMEA0183_SCHEMA_TIME(NMEA0183_GGAdata, Time), NMEA0183_SCHEMA_COORDINATE(NMEA0183_GGAdata, Latitude), NMEA0183_SCHEMA_COORDINATE(NMEA0183_GGAdata, Longitude),
+                                 NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_GGAdata, GPSquality), NMEA0183_SCHEMA_INT(NMEA0183_GGAdata, SatellitesUsed, 0), NMEA0183_SCHEMA_INT(NMEA0183_GGAdata, HDOP, 2),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_GGAdata, Altitude, 2), NMEA0183_SCHEMA_UNIT('M'), NMEA0183_SCHEMA_INT(NMEA0183_GGAdata, GeoidSeparation, 2), NMEA0183_SCHEMA_UNIT('M'),
+                                 NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_INT(NMEA0183_GGAdata, AgeOfDiffCorr, 2)), NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_INT(NMEA0183_GGAdata, DiffRefStationID, 0))> {};
+#endif
+#ifdef NMEA0183_DECODE_GLL
+    //! GLL sentence schema
+    struct GLL : public Sentence<NMEA0183_GLLdata, NMEA0183_SCHEMA_COORDINATE(NMEA0183_GLLdata, Latitude), NMEA0183_SCHEMA_COORDINATE(NMEA0183_GLLdata, Longitude), NMEA0183_SCHEMA_TIME(NMEA0183_GLLdata, Time),
+                                 NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_GLLdata, Status), NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_GLLdata, FAAmode))> {};
+#endif
+#ifdef NMEA0183_DECODE_GSA
+    //! GSA sentence schema
+    struct GSA : public Sentence<NMEA0183_GSAdata, NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_GSAdata, Mode1), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_GSAdata, Mode2), NMEA0183_SCHEMA_INT_ARRAY(NMEA0183_GSAdata, SatelliteIDs, 0),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_GSAdata, PDOP, 2), NMEA0183_SCHEMA_INT(NMEA0183_GSAdata, HDOP, 2), NMEA0183_SCHEMA_INT(NMEA0183_GSAdata, VDOP, 2)> {};
+#endif
+#ifdef NMEA0183_DECODE_GSV
+    //! GSV sentence schema
+    struct GSV : public Sentence<NMEA0183_GSVdata, NMEA0183_SCHEMA_INT(NMEA0183_GSVdata, TotalSentence, 0), NMEA0183_SCHEMA_INT(NMEA0183_GSVdata, SentenceNumber, 0), NMEA0183_SCHEMA_INT(NMEA0183_GSVdata, TotalSatellite, 0),
+                                 NMEA0183_SCHEMA_GROUPS(NMEA0183_GSVdata, SatView, 1, NMEA0183_SCHEMA_INT(NMEA0183_SatelliteView, SatelliteID, 0), NMEA0183_SCHEMA_INT(NMEA0183_SatelliteView, Elevation, 0),
+                                                        NMEA0183_SCHEMA_INT(NMEA0183_SatelliteView, Azimuth, 0), NMEA0183_SCHEMA_INT_DIGITS(NMEA0183_SatelliteView, SNR, 2))> {};
+#endif
+#ifdef NMEA0183_DECODE_HDG
+    //! HDG sentence schema
+    struct HDG : public Sentence<NMEA0183_HDGdata, NMEA0183_SCHEMA_INT(NMEA0183_HDGdata, Heading, 2),
+                                 NMEA0183_SCHEMA_IN(NMEA0183_HDGdata, Deviation, NMEA0183_SCHEMA_INT(NMEA0183_Magnetic, Value, 2)), NMEA0183_SCHEMA_IN(NMEA0183_HDGdata, Deviation, NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_Magnetic, Direction)),
+                                 NMEA0183_SCHEMA_IN(NMEA0183_HDGdata, Variation, NMEA0183_SCHEMA_INT(NMEA0183_Magnetic, Value, 2)), NMEA0183_SCHEMA_IN(NMEA0183_HDGdata, Variation, NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_Magnetic, Direction))> {};
+#endif
+#ifdef NMEA0183_DECODE_HDM
+    //! HDM sentence schema
+    struct HDM : public Sentence<NMEA0183_HDMdata, NMEA0183_SCHEMA_INT(NMEA0183_HDMdata, Heading, 2), NMEA0183_SCHEMA_UNIT('M')> {};
+#endif
+#ifdef NMEA0183_DECODE_HDT
+    //! HDT sentence schema
+    struct HDT : public Sentence<NMEA0183_HDTdata, NMEA0183_SCHEMA_INT(NMEA0183_HDTdata, Heading, 2), NMEA0183_SCHEMA_UNIT('T')> {};
+#endif
+#ifdef NMEA0183_DECODE_MTW
+    //! MTW sentence schema
+    struct MTW : public Sentence<NMEA0183_MTWdata, NMEA0183_SCHEMA_INT(NMEA0183_MTWdata, WaterTemp, 2), NMEA0183_SCHEMA_UNIT('C')> {};
+#endif
+#ifdef NMEA0183_DECODE_MWV
+    //! MWV sentence schema
+    struct MWV : public Sentence<NMEA0183_MWVdata, NMEA0183_SCHEMA_INT(NMEA0183_MWVdata, WindAngle, 2), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_MWVdata, Reference),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_MWVdata, WindSpeed, 2), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_MWVdata, WindSpeedUnit), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_MWVdata, Status)> {};
+#endif
+#ifdef NMEA0183_DECODE_RMC
+    //! RMC sentence schema
+    struct RMC : public Sentence<NMEA0183_RMCdata, NMEA0183_SCHEMA_TIME(NMEA0183_RMCdata, Time), NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_RMCdata, Status),
+                                 NMEA0183_SCHEMA_COORDINATE(NMEA0183_RMCdata, Latitude), NMEA0183_SCHEMA_COORDINATE(NMEA0183_RMCdata, Longitude),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_RMCdata, Speed, 4), NMEA0183_SCHEMA_INT(NMEA0183_RMCdata, Track, 4), NMEA0183_SCHEMA_DATE(NMEA0183_RMCdata, Date),
+                                 NMEA0183_SCHEMA_IN(NMEA0183_RMCdata, Variation, NMEA0183_SCHEMA_INT(NMEA0183_Magnetic, Value, 2)), NMEA0183_SCHEMA_IN(NMEA0183_RMCdata, Variation, NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_Magnetic, Direction)),
+                                 NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_RMCdata, FAAmode)), NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_RMCdata, NavigationStatus))> {};
+#endif
+#ifdef NMEA0183_DECODE_TXT
+    //! TXT sentence schema
+    struct TXT : public Sentence<NMEA0183_TXTdata, NMEA0183_SCHEMA_INT(NMEA0183_TXTdata, TotalSentence, 0), NMEA0183_SCHEMA_INT(NMEA0183_TXTdata, SentenceNumber, 0),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_TXTdata, TextIdentifier, 0), NMEA0183_SCHEMA_ESCAPED_TEXT(NMEA0183_TXTdata, TextMessage)> {};
+#endif
+#ifdef NMEA0183_DECODE_VHW
+    //! VHW sentence schema
+    struct VHW : public Sentence<NMEA0183_VHWdata, NMEA0183_SCHEMA_INT(NMEA0183_VHWdata, HeadingTrue, 4), NMEA0183_SCHEMA_UNIT('T'), NMEA0183_SCHEMA_INT(NMEA0183_VHWdata, HeadingMagnetic, 4), NMEA0183_SCHEMA_UNIT('M'),
+                                 NMEA0183_SCHEMA_INT(NMEA0183_VHWdata, SpeedKnots, 4), NMEA0183_SCHEMA_UNIT('N'), NMEA0183_SCHEMA_INT(NMEA0183_VHWdata, SpeedKmHr, 4), NMEA0183_SCHEMA_UNIT('K')> {};
+#endif
+#ifdef NMEA0183_DECODE_VTG
+    //! VTG sentence schema, and the older VTG sentence without units and FAA mode if it has less than 8 fields
+    struct VTG : public SentenceWithOlderFormat<
+                          Sentence<NMEA0183_VTGdata, NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, CourseTrue, 4), NMEA0183_SCHEMA_UNIT_OR_EMPTY('T'), NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, CourseMagnetic, 4), NMEA0183_SCHEMA_UNIT_OR_EMPTY('M'),
+                                   NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, SpeedKnots, 4), NMEA0183_SCHEMA_UNIT_OR_EMPTY('N'), NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, SpeedKmHr, 4), NMEA0183_SCHEMA_UNIT_OR_EMPTY('K'),
+                                   NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_CHAR_OR_SPACE(NMEA0183_VTGdata, FAAmode))>,
+                          Sentence<NMEA0183_VTGdata, NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, CourseTrue, 4), NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, CourseMagnetic, 4),
+                                   NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, SpeedKnots, 4), NMEA0183_SCHEMA_INT(NMEA0183_VTGdata, SpeedKmHr, 4), NMEA0183_SCHEMA_SET(NMEA0183_VTGdata, FAAmode, ' ')> > {};
+#endif
+#ifdef NMEA0183_DECODE_ZDA
+    //! ZDA sentence schema
+    struct ZDA : public Sentence<NMEA0183_ZDAdata, NMEA0183_SCHEMA_TIME(NMEA0183_ZDAdata, Time), NMEA0183_SCHEMA_IN(NMEA0183_ZDAdata, Date, NMEA0183_SCHEMA_INT(NMEA0183_Date, Day, 0)),
+                                 NMEA0183_SCHEMA_IN(NMEA0183_ZDAdata, Date, NMEA0183_SCHEMA_INT(NMEA0183_Date, Month, 0)), NMEA0183_SCHEMA_IN(NMEA0183_ZDAdata, Date, NMEA0183_SCHEMA_INT(NMEA0183_Date, Year, 0)),
+                                 NMEA0183_SCHEMA_ZONE(NMEA0183_ZDAdata, LocalZoneHour, LocalZoneMinute)> {};
+#endif
+  }
+}
+
+
+
+
+
+//********************************************************************************************************************
+// NMEA0183 sentence tags (select the sentences of NMEA0183handlerDecoder::On<>() and NMEA0183sentenceSetDecoder<>)
+//********************************************************************************************************************
+namespace NMEA0183
+{
+  struct Others { typedef NMEA0183_SentenceView Data; static const uint32_t Slot = NMEA0183_SENTENCE_HASH_OTHERS; }; //!< Sentences unknown by this library
+#ifdef NMEA0183_DECODE_AAM
+  struct AAM { typedef NMEA0183_AAMdata Data; static const uint32_t ID = NMEA0183_AAM; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessAAM(pSentence, pData); } }; //!< AAM sentence
+#endif
+#ifdef NMEA0183_DECODE_ALM
+  struct ALM { typedef NMEA0183_ALMdata Data; static const uint32_t ID = NMEA0183_ALM; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessALM(pSentence, pData); } }; //!< ALM sentence
+#endif
+#ifdef NMEA0183_DECODE_APB
+  struct APB { typedef NMEA0183_APBdata Data; static const uint32_t ID = NMEA0183_APB; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessAPB(pSentence, pData); } }; //!< APB sentence
+#endif
+#ifdef NMEA0183_DECODE_BEC
+  struct BEC { typedef NMEA0183_BECdata Data; static const uint32_t ID = NMEA0183_BEC; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessBEC(pSentence, pData); } }; //!< BEC sentence
+#endif
+#ifdef NMEA0183_DECODE_BOD
+  struct BOD { typedef NMEA0183_BODdata Data; static const uint32_t ID = NMEA0183_BOD; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessBOD(pSentence, pData); } }; //!< BOD sentence
+#endif
+#ifdef NMEA0183_DECODE_BWW
+  struct BWW { typedef NMEA0183_BWWdata Data; static const uint32_t ID = NMEA0183_BWW; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessBWW(pSentence, pData); } }; //!< BWW sentence
+#endif
+#ifdef NMEA0183_DECODE_DBK
+  struct DBK { typedef NMEA0183_DBxdata Data; static const uint32_t ID = NMEA0183_DBK; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessDBx(pSentence, pData); } }; //!< DBK sentence
+#endif
+#ifdef NMEA0183_DECODE_DBS
+  struct DBS { typedef NMEA0183_DBxdata Data; static const uint32_t ID = NMEA0183_DBS; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessDBx(pSentence, pData); } }; //!< DBS sentence
+#endif
+#ifdef NMEA0183_DECODE_DBT
+  struct DBT { typedef NMEA0183_DBxdata Data; static const uint32_t ID = NMEA0183_DBT; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessDBx(pSentence, pData); } }; //!< DBT sentence
+#endif
+#ifdef NMEA0183_DECODE_DPT
+  struct DPT { typedef NMEA0183_DPTdata Data; static const uint32_t ID = NMEA0183_DPT; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessDPT(pSentence, pData); } }; //!< DPT sentence
+#endif
+#ifdef NMEA0183_DECODE_FSI
+  struct FSI { typedef NMEA0183_FSIdata Data; static const uint32_t ID = NMEA0183_FSI; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessFSI(pSentence, pData); } }; //!< FSI sentence
+#endif
+#ifdef NMEA0183_DECODE_GGA
+  struct GGA { typedef NMEA0183_GGAdata Data; static const uint32_t ID = NMEA0183_GGA; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessGGA(pSentence, pData); } }; //!< GGA sentence
+#endif
+#ifdef NMEA0183_DECODE_GLL
+  struct GLL { typedef NMEA0183_GLLdata Data; static const uint32_t ID = NMEA0183_GLL; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessGLL(pSentence, pData); } }; //!< GLL sentence
+#endif
+#ifdef NMEA0183_DECODE_GSA
+  struct GSA { typedef NMEA0183_GSAdata Data; static const uint32_t ID = NMEA0183_GSA; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessGSA(pSentence, pData); } }; //!< GSA sentence
+#endif
+#ifdef NMEA0183_DECODE_GSV
+  struct GSV { typedef NMEA0183_GSVdata Data; static const uint32_t ID = NMEA0183_GSV; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessGSV(pSentence, pData); } }; //!< GSV sentence
+#endif
+#ifdef NMEA0183_DECODE_HDG
+  struct HDG { typedef NMEA0183_HDGdata Data; static const uint32_t ID = NMEA0183_HDG; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessHDG(pSentence, pData); } }; //!< HDG sentence
+#endif
+#ifdef NMEA0183_DECODE_HDM
+  struct HDM { typedef NMEA0183_HDMdata Data; static const uint32_t ID = NMEA0183_HDM; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessHDM(pSentence, pData); } }; //!< HDM sentence
+#endif
+#ifdef NMEA0183_DECODE_HDT
+  struct HDT { typedef NMEA0183_HDTdata Data; static const uint32_t ID = NMEA0183_HDT; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessHDT(pSentence, pData); } }; //!< HDT sentence
+#endif
+#ifdef NMEA0183_DECODE_MTW
+  struct MTW { typedef NMEA0183_MTWdata Data; static const uint32_t ID = NMEA0183_MTW; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessMTW(pSentence, pData); } }; //!< MTW sentence
+#endif
+#ifdef NMEA0183_DECODE_MWV
+  struct MWV { typedef NMEA0183_MWVdata Data; static const uint32_t ID = NMEA0183_MWV; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessMWV(pSentence, pData); } }; //!< MWV sentence
+#endif
+#ifdef NMEA0183_DECODE_RMC
+  struct RMC { typedef NMEA0183_RMCdata Data; static const uint32_t ID = NMEA0183_RMC; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessRMC(pSentence, pData); } }; //!< RMC sentence
+#endif
+#ifdef NMEA0183_DECODE_TXT
+  struct TXT { typedef NMEA0183_TXTdata Data; static const uint32_t ID = NMEA0183_TXT; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessTXT(pSentence, pData); } }; //!< TXT sentence
+#endif
+#ifdef NMEA0183_DECODE_VHW
+  struct VHW { typedef NMEA0183_VHWdata Data; static const uint32_t ID = NMEA0183_VHW; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessVHW(pSentence, pData); } }; //!< VHW sentence
+#endif
+#ifdef NMEA0183_DECODE_VTG
+  struct VTG { typedef NMEA0183_VTGdata Data; static const uint32_t ID = NMEA0183_VTG; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessVTG(pSentence, pData); } }; //!< VTG sentence
+#endif
+#ifdef NMEA0183_DECODE_ZDA
+  struct ZDA { typedef NMEA0183_ZDAdata Data; static const uint32_t ID = NMEA0183_ZDA; static const uint32_t Slot = NMEA0183_SENTENCE_HASH(ID); static eERRORRESULT Parse(const char* pSentence, Data* pData) { return NMEA0183_ProcessZDA(pSentence, pData); } }; //!< ZDA sentence
+#endif
+}
+
+
+
+
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+//********************************************************************************************************************
+// NMEA0183 handler decoder Class
+//********************************************************************************************************************
+class NMEA0183handlerDecoder : public NMEA0183decoder
+{
+  protected:
+    NMEA0183_SentenceHandler Handlers[NMEA0183_SENTENCE_HASH_SLOTS]; // Handler of each sentence slot
+
+    //! Call a handler without context with the data of the sentence
+    template<typename Sentence> static void Invoke(const NMEA0183_SentenceHandler* pHandler, const void* pData)
+    { reinterpret_cast<void (*)(const typename Sentence::Data&)>(pHandler->fnHandler)(*static_cast<const typename Sentence::Data*>(pData)); };
+    //! Call a handler with context with the data of the sentence
+    template<typename Sentence> static void InvokeWithContext(const NMEA0183_SentenceHandler* pHandler, const void* pData)
+    { reinterpret_cast<void (*)(const typename Sentence::Data&, void*)>(pHandler->fnHandler)(*static_cast<const typename Sentence::Data*>(pData), pHandler->pContext); };
+
+  public:
+    /*! @brief Constructor
+     * Initialize NMEA0183 decoder input data, no handler set
+     */
+    NMEA0183handlerDecoder() { for (size_t z = 0; z < NMEA0183_SENTENCE_HASH_SLOTS; ++z) Off(z); };
+
+  public:
+    /*! @brief Set the handler of a sentence (ex: On<NMEA0183::GGA>([](const NMEA0183_GGAdata& gga) { ... }))
+     *
+     * The sentences without handler are not parsed
+     * @param[in] fnHandler Is the function called with the data of each sentence decoded
+     */
+    template<typename Sentence> void On(void (*fnHandler)(const typename Sentence::Data&))
+    { Handlers[Sentence::Slot].fnInvoke = Invoke<Sentence>; Handlers[Sentence::Slot].fnHandler = reinterpret_cast<void (*)(void)>(fnHandler); Handlers[Sentence::Slot].pContext = NULL; };
+
+    /*! @brief Set the handler of a sentence with a user context
+     *
+     * @param[in] fnHandler Is the function called with the data of each sentence decoded and the context
+     * @param[in] *pContext Is the context given to the handler
+     */
+    template<typename Sentence> void On(void (*fnHandler)(const typename Sentence::Data&, void*), void* pContext)
+    { Handlers[Sentence::Slot].fnInvoke = InvokeWithContext<Sentence>; Handlers[Sentence::Slot].fnHandler = reinterpret_cast<void (*)(void)>(fnHandler); Handlers[Sentence::Slot].pContext = pContext; };
+
+    //! Remove the handler of a sentence, the sentence will not be parsed
+    template<typename Sentence> void Off(void) { Off(Sentence::Slot); };
+
+    using NMEA0183decoder::ProcessFrame;
+    /*! @brief Dispatch the NMEA0183 frame to the handler of its sentence
+     *
+     * @return Returns an #eERRORRESULT value enum. Returns ERR__UNKNOWN_ELEMENT if there is no handler for the sentence
+     */
+    eERRORRESULT ProcessFrame(void) { return NMEA0183_DispatchFrame(&InputData, Handlers); };
+
+    /*! @brief Dispatch a NMEA0183 frame line of a known length to the handler of its sentence
+     *
+     * This function does not use the decoder input, the line is decoded in place
+     * @param[in] *pLine Is the frame line to process
+     * @param[in] length Is the count of characters of the line
+     * @return Returns an #eERRORRESULT value enum. Returns ERR__UNKNOWN_ELEMENT if there is no handler for the sentence
+     */
+    eERRORRESULT DispatchLine(const char* pLine, size_t length) { return NMEA0183_DispatchLineN(pLine, length, Handlers); };
+
+  private:
+    void Off(size_t slot) { Handlers[slot].fnInvoke = NULL; Handlers[slot].fnHandler = NULL; Handlers[slot].pContext = NULL; };
+};
+#endif
+
+
+
+
+
+#ifdef NMEA0183_HAS_VARIANT
+//********************************************************************************************************************
+// NMEA0183 sentence set decoder Class
+//********************************************************************************************************************
+namespace NMEA0183
+{
+  //! Index of a sentence tag in a list of sentence tags
+  template<class Sentence, class... List> struct IndexOf;
+  template<class Sentence, class... Rest> struct IndexOf<Sentence, Sentence, Rest...> { static constexpr size_t Value = 0; };
+  template<class Sentence, class First, class... Rest> struct IndexOf<Sentence, First, Rest...> { static constexpr size_t Value = 1 + IndexOf<Sentence, Rest...>::Value; };
+}
+
+/*! @brief Decoder of a set of sentences chosen at compile time (ex: NMEA0183sentenceSetDecoder<NMEA0183::GGA, NMEA0183::RMC>)
+ *
+ * Only the parsers of the sentences of the set are referenced by the decoder, the dispatch table and the result are sized to the set
+ * The sentences of the set shall be enabled in the configuration file (NMEA0183_DECODE_xxx)
+ */
+template<class... Sentences>
+class NMEA0183sentenceSetDecoder : public NMEA0183decoder
+{
+  static_assert((sizeof...(Sentences) > 0) && (sizeof...(Sentences) < 0xFF), "The sentence set shall contain 1 to 254 sentences");
+
+  public:
+    typedef std::variant<std::monostate, typename Sentences::Data...> Result; //!< Decoded sentence, std::monostate if no sentence of the set has been decoded
+
+  protected:
+    typedef eERRORRESULT (*Parser_Func)(const char* pSentence, Result& result);
+    static constexpr uint8_t NO_SENTENCE = 0xFF;
+
+    //! Parse a sentence of the set directly in the result
+    template<size_t Index, class Sentence> static eERRORRESULT Parse(const char* pSentence, Result& result) { return Sentence::Parse(pSentence, &result.template emplace<Index + 1>()); };
+
+    //! Build the index of the sentence of the set of each NMEA0183_SENTENCE_HASH() slot
+    static constexpr std::array<uint8_t, NMEA0183_SENTENCE_HASH_SLOTS> BuildSlots(void)
+    {
+      std::array<uint8_t, NMEA0183_SENTENCE_HASH_SLOTS> Slots = {};
+      for (size_t z = 0; z < NMEA0183_SENTENCE_HASH_SLOTS; ++z) Slots[z] = NO_SENTENCE;
+      const uint32_t SentenceSlots[] = { Sentences::Slot... };
+      for (size_t z = 0; z < sizeof...(Sentences); ++z) Slots[SentenceSlots[z]] = (uint8_t)z;
+      return Slots;
+    };
+    //! Check that each sentence of the set has its own NMEA0183_SENTENCE_HASH() slot
+    static constexpr bool SlotsAreUnique(void)
+    {
+      const uint32_t SentenceSlots[] = { Sentences::Slot... };
+      for (size_t z1 = 0; z1 < sizeof...(Sentences); ++z1)
+        for (size_t z2 = z1 + 1; z2 < sizeof...(Sentences); ++z2)
+          if (SentenceSlots[z1] == SentenceSlots[z2]) return false;
+      return true;
+    };
+    //! Build the parser of each sentence of the set
+    template<size_t... Indexes> static constexpr std::array<Parser_Func, sizeof...(Sentences)> BuildParsers(std::index_sequence<Indexes...>) { return {{ &Parse<Indexes, Sentences>... }}; };
+
+    static constexpr std::array<uint8_t, NMEA0183_SENTENCE_HASH_SLOTS> SLOTS = BuildSlots();                                  // Index in the set of each slot
+    static constexpr std::array<uint32_t, sizeof...(Sentences)> IDS = {{ Sentences::ID... }};                                 // Sentence ID of each sentence of the set
+    static constexpr std::array<Parser_Func, sizeof...(Sentences)> PARSERS = BuildParsers(std::index_sequence_for<Sentences...>()); // Parser of each sentence of the set
+
+    //! Parse the sentence checked by NMEA0183_CheckLineN() or NMEA0183_CheckFrame() if it is in the set
+    static eERRORRESULT ParseSentence(eNMEA0183_SentencesID sentenceID, const char* pSentence, Result& result)
+    {
+      static_assert(SlotsAreUnique(), "Two sentences of the set have the same NMEA0183_SENTENCE_HASH() slot");
+      const uint8_t Index = SLOTS[NMEA0183_SENTENCE_HASH(sentenceID)];
+      if ((Index == NO_SENTENCE) || (IDS[Index] != (uint32_t)sentenceID)) return ERR__UNKNOWN_ELEMENT; // Sentence not in the set
+      const eERRORRESULT Error = PARSERS[Index](pSentence, result);
+      if (Error != ERR_OK) result.template emplace<0>();
+      return Error;
+    };
+
+  public:
+    using NMEA0183decoder::ProcessFrame;
+    using NMEA0183decoder::ProcessLine;
+
+    /*! @brief Process a NMEA0183 frame line of a known length
+     *
+     * This function does not use the decoder input, the line is decoded in place
+     * @param[in] *pLine Is the frame line to process
+     * @param[in] length Is the count of characters of the line
+     * @param[out] &result Is the decoded sentence
+     * @return Returns an #eERRORRESULT value enum. Returns ERR__UNKNOWN_ELEMENT if the sentence is not in the set
+     */
+    eERRORRESULT ProcessLine(const char* pLine, size_t length, Result& result)
+    {
+      eNMEA0183_SentencesID SentenceID;
+      const char* pSentence;
+      result.template emplace<0>();
+      const eERRORRESULT Error = NMEA0183_CheckLineN(pLine, length, &TalkerID, &SentenceID, &pSentence);
+      if (Error != ERR_OK) return Error;
+      return ParseSentence(SentenceID, pSentence, result);
+    };
+
+    /*! @brief Process the NMEA0183 frame (used with the decode structure)
+     *
+     * The checksum and the first field position computed while receiving the frame are used, the frame is only read by the parser of the sentence
+     * The differential decoding and the frame cache do not apply to the result of the set, each sentence is fully parsed
+     * @param[out] &result Is the decoded sentence
+     * @return Returns an #eERRORRESULT value enum. Returns ERR__UNKNOWN_ELEMENT if the sentence is not in the set
+     */
+    eERRORRESULT ProcessFrame(Result& result)
+    {
+      eNMEA0183_SentencesID SentenceID;
+      const char* pSentence;
+      result.template emplace<0>();
+      NMEA0183_DECODER_INPUT(&InputData)->State = NMEA0183_IN_PROCESS; // Frame is in process
+      eERRORRESULT Error = NMEA0183_CheckFrame(&InputData, &TalkerID, &SentenceID, &pSentence); // The checksum was computed while receiving the frame
+      if (Error == ERR_OK) Error = ParseSentence(SentenceID, pSentence, result);
+      NMEA0183_DECODER_INPUT(&InputData)->State = NMEA0183_WAIT_START; // Frame is Processed, wait for a new frame
+      return Error;
+    };
+
+    //! Get the talker ID of the last sentence processed
+    eNMEA0183_TalkerID GetTalkerID(void) const { return TalkerID; };
+
+    /*! @brief Get the data of a sentence of the set in a result
+     * @param[in] &result Is the decoded sentence
+     * @return Returns the data of the sentence, or NULL if the result is not this sentence
+     */
+    template<class Sentence> static const typename Sentence::Data* Get(const Result& result) { return std::get_if<NMEA0183::IndexOf<Sentence, Sentences...>::Value + 1>(&result); };
+
+  protected:
+    eNMEA0183_TalkerID TalkerID = (eNMEA0183_TalkerID)0; // Talker ID of the last sentence processed
+};
+#endif
+
+
+
+
+
 #if defined(NMEA0183_GPS_DECODER_CLASS) && defined(NMEA0183_FLOAT_BASED_TOOLS)
 //********************************************************************************************************************
 // GPS decoder Class
@@ -149,7 +1311,7 @@ class NMEA0183decoder
 class GPSdecoder
 {
 protected:
-    struct NMEA0183_InputBuffer InputData; // NMEA0183 decoder structure
+    NMEA0183_DecodeInput InputData; // NMEA0183 decoder structure
 
 private:
     NMEA0183_Time _Time; bool _NewTimeAvailable;      // Time
@@ -0,0 +1,443 @@
+/*******************************************************************************
+ * @file    Benchmark_NMEA0183.cpp
+ * @brief   Benchmark of the NMEA0183 decoder on a recorded corpus
+ *
+ * Build (from the repository root) with the Conf_NMEA0183.h of the unit tests:
+ *   g++ -O2 -std=c++11 -I. -ITests/UnitTest NMEA0183.cpp Tests/Benchmark/Benchmark_NMEA0183.cpp -o Benchmark_NMEA0183
+ * Add -mavx2 to use the AVX2 path, or -DNMEA0183_NO_SIMD to measure the scalar path.
+ * Add -DNMEA0183_NATURAL_ALIGNMENT to measure the naturally aligned data structures instead of the packed ones.
+ *
+ * Usage:
+ *   Benchmark_NMEA0183 [corpus.nmea]
+ * The corpus file is a NMEA0183 log with one sentence per line. Without file, an embedded corpus is used
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define BENCHMARK_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  include <x86intrin.h>
+#  define BENCHMARK_HAS_RDTSC
+#endif
+#include <chrono>
+#include <string>
+#include <vector>
+#include "NMEA0183.hpp"
+//-----------------------------------------------------------------------------
+
+#define BENCHMARK_MIN_DURATION_MS  500 // Minimum duration of each benchmark
+
+
+
+//=============================================================================
+// Corpus
+//=============================================================================
+static const char* const EMBEDDED_CORPUS[] =
+{
+  "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n",
+  "$GNGSA,A,3,80,71,73,79,69,,,,,,,,1.83,1.09,1.47*17\r\n",
+  "$GPGSV,3,1,10,05,53,303,30,02,30,239,24,13,21,272,23,30,78,155,19*77\r\n",
+  "$GPGSV,3,1,12,01,00,000,,02,00,000,,03,00,000,,04,00,000,*7C\r\n",
+  "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n",
+  "$GNRMC,131807.00,A,5356.52249,N,02734.00205,E,,,180424,,,A,V*35\r\n",
+  "$GNGLL,4404.14012,N,12118.85993,W,001037.10,A,A*66\r\n",
+  "$GNGGA,001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,M,-21.3,M*47\r\n",
+  "$GPBOD,097.0,T,103.2,M,POINTB,POINTA*4A\r\n",
+  "$GPAAM,A,A,0.10,N,WPTNME*32\r\n",
+};
+
+//-----------------------------------------------------------------------------
+static bool LoadCorpus(const char* pFileName, std::vector<std::string>& corpus)
+{
+  FILE* pFile = fopen(pFileName, "rb");
+  if (pFile == NULL) return false;
+  char Line[256];
+  while (fgets(Line, sizeof(Line), pFile) != NULL)
+  {
+    if (Line[0] != NMEA0183_START_DELIMITER) continue; // Skip non NMEA0183 lines
+    corpus.push_back(std::string(Line));
+  }
+  fclose(pFile);
+  return true;
+}
+
+
+
+//=============================================================================
+// Benchmarks
+//=============================================================================
+typedef std::chrono::steady_clock BenchmarkClock;
+
+//-----------------------------------------------------------------------------
+//! Decode the corpus until BENCHMARK_MIN_DURATION_MS. Returns the frames per second processed and the count of sentences of the corpus decoded without error
+template<typename DecodeFunc>
+static double BenchmarkCorpus(const std::vector<std::string>& corpus, DecodeFunc decode, size_t* pDecoded)
+{
+  NMEA0183_DecodedData FrameData;
+  size_t Frames = 0;
+  const BenchmarkClock::time_point Start = BenchmarkClock::now();
+  double Elapsed = 0.0;
+  do
+  {
+    size_t Decoded = 0;
+    for (size_t z = 0; z < corpus.size(); ++z)
+      if (decode(corpus[z], &FrameData) == ERR_OK) ++Decoded;
+    Frames += corpus.size();
+    *pDecoded = Decoded;
+    Elapsed = std::chrono::duration<double>(BenchmarkClock::now() - Start).count();
+  } while (Elapsed < (BENCHMARK_MIN_DURATION_MS / 1000.0));
+  return (double)Frames / Elapsed;
+}
+
+static eERRORRESULT DecodeProcessLine(const std::string& line, NMEA0183_DecodedData* pData)  { return NMEA0183_ProcessLine(line.c_str(), pData); }
+static eERRORRESULT DecodeProcessLineN(const std::string& line, NMEA0183_DecodedData* pData) { return NMEA0183_ProcessLineN(line.data(), line.size(), pData); }
+
+#ifdef NMEA0183_COMPACT_OUTPUT
+static uint64_t BenchmarkRecord[sizeof(NMEA0183_DecodedData) / sizeof(uint64_t) + 1];
+static eERRORRESULT DecodeProcessLineCompact(const std::string& line, NMEA0183_DecodedData*) { size_t RecordSize; return NMEA0183_ProcessLineCompact(line.data(), line.size(), &BenchmarkRecord[0], sizeof(BenchmarkRecord), &RecordSize); }
+#endif
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+static NMEA0183_SentenceHandler BenchmarkHandlers[NMEA0183_SENTENCE_HASH_SLOTS];
+static volatile size_t HandledSentences = 0;
+static void HandleSentence(const NMEA0183_SentenceHandler*, const void*) { HandledSentences = HandledSentences + 1; }
+static eERRORRESULT DecodeDispatchLineN(const std::string& line, NMEA0183_DecodedData*) { return NMEA0183_DispatchLineN(line.data(), line.size(), BenchmarkHandlers); }
+#endif
+
+//-----------------------------------------------------------------------------
+template<typename DecodeFunc>
+static void RunCorpusBenchmark(const char* pName, const std::vector<std::string>& corpus, DecodeFunc decode)
+{
+  size_t Decoded = 0;
+  const double FramesPerSecond = BenchmarkCorpus(corpus, decode, &Decoded);
+  printf("%-28s %12.0f frames/s (%u/%u sentences decoded)\n", pName, FramesPerSecond, (unsigned)Decoded, (unsigned)corpus.size());
+}
+
+
+
+//=============================================================================
+// Receive path microbenchmark (character by character framing)
+//=============================================================================
+#define BENCHMARK_RECEIVE_PASSES  200 // Count of passes on the corpus for each measure of the receive path
+
+#ifdef NMEA0183_USE_INPUT_BUFFER
+//-----------------------------------------------------------------------------
+//! Get the timestamp counter of the CPU, or nanoseconds if there is no timestamp counter
+static inline uint64_t ReadCycleCounter(void)
+{
+#ifdef BENCHMARK_HAS_RDTSC
+  return (uint64_t)__rdtsc();
+#else
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchmarkClock::now().time_since_epoch()).count();
+#endif
+}
+
+//-----------------------------------------------------------------------------
+static void PrintCyclesPerByte(const char* pName, uint64_t cycles, size_t bytes)
+{
+#ifdef BENCHMARK_HAS_RDTSC
+  printf("%-28s %12.2f cycles/byte (rdtsc)\n", pName, (double)cycles / (double)bytes);
+#else
+  printf("%-28s %12.2f ns/byte\n", pName, (double)cycles / (double)bytes);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+//! Feed a stream char by char until BENCHMARK_MIN_DURATION_MS. The frames are not processed so only the framing is measured
+static void MeasureReceivePath(const char* pName, const std::string& stream)
+{
+  NMEA0183_DecodeInput Decoder;
+  (void)Init_NMEA0183(&Decoder);
+  uint64_t Cycles = 0;
+  size_t Bytes = 0;
+  volatile size_t Errors = 0;
+  const BenchmarkClock::time_point Start = BenchmarkClock::now();
+  do
+  {
+    const uint64_t StartCycles = ReadCycleCounter();
+    for (size_t zPass = 0; zPass < BENCHMARK_RECEIVE_PASSES; ++zPass)
+      for (size_t z = 0; z < stream.size(); ++z)
+        if (NMEA0183_AddReceivedCharacter(&Decoder, stream[z]) != ERR_OK) Errors = Errors + 1; // ERR__BUFFER_OVERRIDE on each new frame
+    Cycles += ReadCycleCounter() - StartCycles;
+    Bytes  += BENCHMARK_RECEIVE_PASSES * stream.size();
+  } while (std::chrono::duration<double>(BenchmarkClock::now() - Start).count() < (BENCHMARK_MIN_DURATION_MS / 1000.0));
+  PrintCyclesPerByte(pName, Cycles, Bytes);
+}
+
+#ifdef NMEA0183_RING_FRAMER
+//-----------------------------------------------------------------------------
+//! Find the frames of a stream already written in a ring buffer until BENCHMARK_MIN_DURATION_MS (the writes of the DMA are not measured). The frames are not processed
+static void MeasureRingFramer(const char* pName, const std::string& stream)
+{
+  std::vector<char> Ring(stream.begin(), stream.end());
+  Ring.resize(stream.size() + NMEA0183_FRAME_BUFFER_SIZE + 2);  // The ring is never full
+  NMEA0183_RingFramer Framer;
+  NMEA0183_RingSpan Span;
+  uint64_t Cycles = 0;
+  size_t Bytes = 0;
+  volatile size_t Frames = 0;
+  const BenchmarkClock::time_point Start = BenchmarkClock::now();
+  do
+  {
+    const uint64_t StartCycles = ReadCycleCounter();
+    for (size_t zPass = 0; zPass < BENCHMARK_RECEIVE_PASSES; ++zPass)
+    {
+      (void)Init_NMEA0183RingFramer(&Framer, &Ring[0], Ring.size());
+      eERRORRESULT Error;
+      while ((Error = NMEA0183_RingFramer_GetFrame(&Framer, stream.size(), &Span)) != ERR__NO_DATA_AVAILABLE)
+        if (Error == ERR_OK) { Frames = Frames + 1; (void)NMEA0183_RingFramer_ReleaseFrame(&Framer); }
+    }
+    Cycles += ReadCycleCounter() - StartCycles;
+    Bytes  += BENCHMARK_RECEIVE_PASSES * stream.size();
+  } while (std::chrono::duration<double>(BenchmarkClock::now() - Start).count() < (BENCHMARK_MIN_DURATION_MS / 1000.0));
+  PrintCyclesPerByte(pName, Cycles, Bytes);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+static void RunReceivePathBenchmark(const std::vector<std::string>& corpus)
+{
+  std::string Stream;
+  for (size_t z = 0; z < corpus.size(); ++z) Stream += corpus[z];
+  MeasureReceivePath("Receive path (corpus)", Stream);
+#ifdef NMEA0183_RING_FRAMER
+  MeasureRingFramer("Ring framer (corpus)", Stream);
+#endif
+
+  //--- Noisy link: some chars of the corpus are replaced by random bytes ---
+  uint32_t Random = 0x12345678u;
+  for (size_t z = 0; z < Stream.size(); ++z)
+  {
+    Random = Random * 1664525u + 1013904223u;                   // Linear congruential generator, same noise for each run
+    if ((Random >> 28) == 0) Stream[z] = (char)(Random >> 16);  // 1 char out of 16
+  }
+  MeasureReceivePath("Receive path (noisy link)", Stream);
+#ifdef NMEA0183_RING_FRAMER
+  MeasureRingFramer("Ring framer (noisy link)", Stream);
+#endif
+}
+#endif
+
+
+
+//=============================================================================
+// Sentence microbenchmarks (number fields heavy sentences)
+//=============================================================================
+static const char* const MICRO_SENTENCES[][2] =
+{
+  { "GGA", "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E" },
+  { "RMC", "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A" },
+  { "GSV", "$GPGSV,3,1,10,05,53,303,30,02,30,239,24,13,21,272,23,30,78,155,19*77" },
+};
+
+//-----------------------------------------------------------------------------
+static void RunSentenceMicrobenchmarks(void)
+{
+  for (size_t zSentence = 0; zSentence < (sizeof(MICRO_SENTENCES) / sizeof(MICRO_SENTENCES[0])); ++zSentence)
+  {
+    std::vector<std::string> Corpus(1, std::string(MICRO_SENTENCES[zSentence][1]));
+    char Name[32];
+    snprintf(Name, sizeof(Name), "%s decode", MICRO_SENTENCES[zSentence][0]);
+    size_t Decoded = 0;
+    const double FramesPerSecond = BenchmarkCorpus(Corpus, DecodeProcessLineN, &Decoded);
+    printf("%-28s %12.1f ns/sentence\n", Name, 1.0e9 / FramesPerSecond);
+  }
+}
+
+
+
+//=============================================================================
+// Number parser microbenchmark (library parser against the previous char by char parser)
+//=============================================================================
+//! Number fields of the GGA, RMC and GSV sentences, with the count of digits to extract after the '.'
+static const struct { const char* pField; size_t Digits; } NUMBER_FIELDS[] =
+{
+  { "1.2,",    1 }, { "27.0,",  1 }, { "-34.2,", 1 }, { "10,",    0 }, { "0.98,",    2 }, { "1113.0,", 1 },
+  { "000.5,",  1 }, { "054.7,", 1 }, { "020.3,", 1 }, { "12,",    0 }, { "4916.45,", 2 }, { "-21.3,",  1 },
+  { "53,",     0 }, { "303,",   0 }, { "30,",    0 }, { "239,",   0 }, { "002153.000,", 3 }, { ",",    1 },
+};
+
+//-----------------------------------------------------------------------------
+//! Previous __NMEA0183_StringToInt() of the library, it checks the stop char, the '.' and the digit count on every char
+static int32_t BaselineStringToInt(char** pStr, size_t max, size_t digits)
+{
+  if (**pStr == '\0') return NMEA0183_NO_VALUE;    // Empty string? return error value
+  bool Sign = (**pStr == '-');                     // Minus character? Save it
+  if (Sign || (**pStr == '+')) ++(*pStr);          // Minus character or Plus character? Go to next one
+  if (**pStr == '\0') return NMEA0183_NO_VALUE;    // Empty string? return error value
+  if ((**pStr == NMEA0183_FIELD_DELIMITER) || (**pStr == NMEA0183_CHECKSUM_DELIMITER)) return NMEA0183_NO_VALUE; // If the field is empty, set no data
+  size_t CharCount = (max == 0 ? NMEA0183_FRAME_BUFFER_SIZE : max); // If max = 0, then extract until ',', '*', or '\0'
+  int32_t Result = 0;
+
+  //--- Extract value ---
+  bool PointFound = false;
+  while (CharCount > 0)
+  {
+    if (**pStr == (char)max) break;                // Stop char found
+    if (**pStr != '.')
+    {
+      if ((uint_fast8_t)(**pStr - '0') > 9) break; // If pStr[0] = '\0' or other char, the result should be > 9 then break the while...
+      if (PointFound)                              // Decrement digit only if the char '.' have been found
+      {
+        if (digits == 0) break;
+        --digits;
+      }
+      Result *= 10;                                // Multiply the int part by 10
+      Result += (int32_t)(**pStr - '0');           // Add the unit value
+    }
+    else PointFound = true;
+    --CharCount;
+    ++(*pStr);                                     // Next char
+  }
+  while (digits > 0) { Result *= 10; --digits; }   // Force multiplier to digits
+  if (max == 0)
+    while ((**pStr != NMEA0183_FIELD_DELIMITER) && (**pStr != NMEA0183_CHECKSUM_DELIMITER) && (**pStr != 0)) ++(*pStr); // Go to the end of the field or the end of the string
+  if (Sign) Result = -Result;                      // If negative value, then set negative IntPart as result
+  return Result;                                   // Return the new position
+}
+
+static int32_t BaselineParseFieldInt(char** ppStr, size_t digits) { return BaselineStringToInt(ppStr, 0, digits); }
+
+typedef int32_t (*ParseFieldInt_Func)(char** ppStr, size_t digits);
+
+//-----------------------------------------------------------------------------
+//! Convert the number fields until BENCHMARK_MIN_DURATION_MS. The parser is called through a pointer so that none of them is inlined
+static void MeasureNumberParser(const char* pName, ParseFieldInt_Func fnParse)
+{
+  const size_t FieldsCount = sizeof(NUMBER_FIELDS) / sizeof(NUMBER_FIELDS[0]);
+  char Fields[sizeof(NUMBER_FIELDS) / sizeof(NUMBER_FIELDS[0])][16];
+  for (size_t z = 0; z < FieldsCount; ++z) snprintf(Fields[z], sizeof(Fields[z]), "%s", NUMBER_FIELDS[z].pField);
+  ParseFieldInt_Func volatile fnCall = fnParse;
+  size_t Conversions = 0;
+  volatile int32_t Sum = 0;
+  const BenchmarkClock::time_point Start = BenchmarkClock::now();
+  double Elapsed = 0.0;
+  do
+  {
+    int32_t Total = 0;
+    for (size_t zPass = 0; zPass < 1000; ++zPass)
+      for (size_t z = 0; z < FieldsCount; ++z)
+      {
+        char* pStr = &Fields[z][0];
+        Total += fnCall(&pStr, NUMBER_FIELDS[z].Digits);
+      }
+    Sum = Sum + Total;
+    Conversions += 1000 * FieldsCount;
+    Elapsed = std::chrono::duration<double>(BenchmarkClock::now() - Start).count();
+  } while (Elapsed < (BENCHMARK_MIN_DURATION_MS / 1000.0));
+  printf("%-28s %12.2f ns/field\n", pName, (Elapsed * 1.0e9) / (double)Conversions);
+}
+
+//-----------------------------------------------------------------------------
+static void RunNumberParserBenchmark(void)
+{
+  //--- Both parsers shall give the same values and stop at the same char ---
+  for (size_t z = 0; z < (sizeof(NUMBER_FIELDS) / sizeof(NUMBER_FIELDS[0])); ++z)
+  {
+    char Field[16];
+    snprintf(Field, sizeof(Field), "%s", NUMBER_FIELDS[z].pField);
+    char* pLibrary  = &Field[0];
+    char* pBaseline = &Field[0];
+    const int32_t Library  = NMEA0183_ParseFieldInt(&pLibrary, NUMBER_FIELDS[z].Digits);
+    const int32_t Baseline = BaselineParseFieldInt(&pBaseline, NUMBER_FIELDS[z].Digits);
+    if ((Library != Baseline) || (pLibrary != pBaseline)) printf("Number parsers differ on '%s'\n", NUMBER_FIELDS[z].pField);
+  }
+  MeasureNumberParser("Number field (library)", NMEA0183_ParseFieldInt);
+  MeasureNumberParser("Number field (baseline)", BaselineParseFieldInt);
+}
+
+
+
+//=============================================================================
+// Data layout microbenchmark (batch coordinate conversion)
+//=============================================================================
+#define BENCHMARK_COORDINATES_COUNT  4096 // Count of coordinates converted in each batch
+
+static NMEA0183_Coordinate BenchmarkCoordinates[BENCHMARK_COORDINATES_COUNT];
+static double BenchmarkDegrees[BENCHMARK_COORDINATES_COUNT];
+
+//-----------------------------------------------------------------------------
+//! Convert a batch of coordinates to signed degrees
+static void ConvertCoordinates(const NMEA0183_Coordinate* pCoordinates, double* pDegrees, size_t count)
+{
+  for (size_t z = 0; z < count; ++z)
+  {
+    const double Degree = (double)pCoordinates[z].Degree + ((double)pCoordinates[z].Minute / 600000000.0); // Minute is in 10^-7 minute
+    pDegrees[z] = ((pCoordinates[z].Direction == 'S') || (pCoordinates[z].Direction == 'W') ? -Degree : Degree);
+  }
+}
+
+//-----------------------------------------------------------------------------
+static void RunCoordinateBatchBenchmark(void)
+{
+  //--- Fill the coordinates with the decoder ---
+  char Line[96];
+  for (size_t z = 0; z < BENCHMARK_COORDINATES_COUNT; ++z)
+  {
+    char* pStr = &Line[0];
+    snprintf(Line, sizeof(Line), "%02u%02u.%05u,%c,", (unsigned)(z % 90), (unsigned)(z % 60), (unsigned)((z * 7919u) % 100000u), ((z & 1) != 0 ? 'N' : 'S'));
+    (void)NMEA0183_ParseFieldCoordinate(&pStr, &BenchmarkCoordinates[z]);
+  }
+
+  //--- Convert the coordinates ---
+  size_t Coordinates = 0;
+  const BenchmarkClock::time_point Start = BenchmarkClock::now();
+  double Elapsed = 0.0;
+  do
+  {
+    ConvertCoordinates(&BenchmarkCoordinates[0], &BenchmarkDegrees[0], BENCHMARK_COORDINATES_COUNT);
+    Coordinates += BENCHMARK_COORDINATES_COUNT;
+    Elapsed = std::chrono::duration<double>(BenchmarkClock::now() - Start).count();
+  } while (Elapsed < (BENCHMARK_MIN_DURATION_MS / 1000.0));
+  printf("%-28s %12.2f ns/coordinate (sizeof(NMEA0183_Coordinate) = %u)\n", "Coordinate to degree", (Elapsed * 1.0e9) / (double)Coordinates, (unsigned)sizeof(NMEA0183_Coordinate));
+}
+
+
+
+//=============================================================================
+// Main
+//=============================================================================
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> Corpus;
+  if (argc > 1)
+  {
+    if (LoadCorpus(argv[1], Corpus) == false) { fprintf(stderr, "Cannot open '%s'\n", argv[1]); return 1; }
+  }
+  else for (size_t z = 0; z < (sizeof(EMBEDDED_CORPUS) / sizeof(EMBEDDED_CORPUS[0])); ++z) Corpus.push_back(EMBEDDED_CORPUS[z]);
+  if (Corpus.empty()) { fprintf(stderr, "Empty corpus\n"); return 1; }
+
+#if defined(NMEA0183_NO_SIMD)
+  const char* const SIMD = "scalar";
+#elif defined(__AVX2__)
+  const char* const SIMD = "AVX2";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+  const char* const SIMD = "SSE2";
+#else
+  const char* const SIMD = "scalar";
+#endif
+#ifdef NMEA0183_NATURAL_ALIGNMENT
+  const char* const LAYOUT = "natural alignment";
+#else
+  const char* const LAYOUT = "packed";
+#endif
+  printf("Corpus: %u sentences, checksum path: %s, data layout: %s\n", (unsigned)Corpus.size(), SIMD, LAYOUT);
+
+  RunCorpusBenchmark("NMEA0183_ProcessLine", Corpus, DecodeProcessLine);
+  RunCorpusBenchmark("NMEA0183_ProcessLineN", Corpus, DecodeProcessLineN);
+#ifdef NMEA0183_COMPACT_OUTPUT
+  RunCorpusBenchmark("NMEA0183_ProcessLineCompact", Corpus, DecodeProcessLineCompact);
+#endif
+#ifdef NMEA0183_SENTENCE_HANDLERS
+  for (size_t z = 0; z < NMEA0183_SENTENCE_HASH_SLOTS; ++z) BenchmarkHandlers[z].fnInvoke = HandleSentence; // All the sentences are handled
+  RunCorpusBenchmark("NMEA0183_DispatchLineN", Corpus, DecodeDispatchLineN);
+#endif
+#ifdef NMEA0183_USE_INPUT_BUFFER
+  RunReceivePathBenchmark(Corpus);
+#endif
+  RunSentenceMicrobenchmarks();
+  RunNumberParserBenchmark();
+  RunCoordinateBatchBenchmark();
+  return 0;
+}
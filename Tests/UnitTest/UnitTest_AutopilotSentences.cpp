@@ -55,7 +55,11 @@ namespace NMEA0183test
             Assert::AreEqual('V', FrameData.APB.PassedWaypoint, L"Test (Full Data), PassedWaypoint should be 'V'");
             Assert::AreEqual((uint16_t)1100u, FrameData.APB.BearingOriginToDest, L"Test (Full Data), BearingOriginToDest should be 1100");
             Assert::AreEqual('M', FrameData.APB.BearingOtoDunit, L"Test (Full Data), BearingOtoDunit should be 'M'");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("DEST", FrameData.APB.WaypointID.pChars, FrameData.APB.WaypointID.Size), L"Test (Full Data), WaypointID should be 'DEST'");
+#else
             Assert::AreEqual(0, strncmp("DEST", &FrameData.APB.WaypointID[0], strlen(FrameData.APB.WaypointID)), L"Test (Full Data), WaypointID should be 'DEST'");
+#endif
             Assert::AreEqual((uint16_t)1100u, FrameData.APB.BearingCurPosToDest, L"Test (Full Data), BearingCurPosToDest should be 1100");
             Assert::AreEqual('M', FrameData.APB.BearingCPtoDunit, L"Test (Full Data), BearingCPtoDunit should be 'M'");
             Assert::AreEqual((uint16_t)1100u, FrameData.APB.HeadingToSteerToDest, L"Test (Full Data), HeadingToSteerToDest should be 1100");
@@ -98,7 +102,11 @@ namespace NMEA0183test
             Assert::AreEqual((uint16_t)21380u, FrameData.BEC.BearingTrue, L"Test (Full Data), BearingTrue should be 21380");
             Assert::AreEqual((uint16_t)21800u, FrameData.BEC.BearingMagnetic, L"Test (Full Data), BearingMagnetic should be 21800");
             Assert::AreEqual(46000u, FrameData.BEC.Distance, L"Test (Full Data), Distance should be 46000");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("EGLM", FrameData.BEC.WaypointID.pChars, FrameData.BEC.WaypointID.Size), L"Test (Full Data), WaypointID should be 'DEST'");
+#else
             Assert::AreEqual(0, strncmp("EGLM", &FrameData.BEC.WaypointID[0], strlen(FrameData.BEC.WaypointID)), L"Test (Full Data), WaypointID should be 'DEST'");
+#endif
         }
 #endif
     };
@@ -200,6 +200,318 @@ namespace NMEA0183test
             Assert::AreEqual('A', FrameData.RMC.FAAmode, L"Test (Full Data), FAAmode should be 'A'");
             Assert::AreEqual('S', FrameData.RMC.NavigationStatus, L"Test (Full Data), NavigationStatus should be 'S'");
         }
+
+#ifdef NMEA0183_HAS_STRING_VIEW
+        TEST_METHOD(TestMethod_ProcessLineStringView)
+        {
+            NMEA0183decoder NMEA;
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+            const std::string_view TEST_LINES = "$XXZZZ,data,00*4A\r\n$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+
+            //--- Test (Unknown frame) ---
+            const std::string_view TEST_UNKNOWN_FRAME = TEST_LINES.substr(0, TEST_LINES.find('\n') + 1);
+            LastError = NMEA.ProcessLine(TEST_UNKNOWN_FRAME, &FrameData);
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Unknown frame), error should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual(NMEA0183_UNKNOWN, FrameData.SentenceID, L"Test (Unknown frame), SentenceID should be NMEA0183_UNKNOWN");
+
+            //--- Test (Full Data) ---
+            const std::string_view TEST_RMC_FULL_DATA_FRAME = TEST_LINES.substr(TEST_UNKNOWN_FRAME.size(), TEST_LINES.size() - TEST_UNKNOWN_FRAME.size() - 2);
+            LastError = NMEA.ProcessLine(TEST_RMC_FULL_DATA_FRAME, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Full Data), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_RMC, FrameData.SentenceID, L"Test (Full Data), SentenceID should be NMEA0183_RMC");
+            Assert::AreEqual((uint8_t)22, FrameData.RMC.Time.Hour, L"Test (Full Data), Time.Hour should be 22");
+            Assert::AreEqual('S', FrameData.RMC.NavigationStatus, L"Test (Full Data), NavigationStatus should be 'S'");
+
+            //--- Test (Truncated checksum) ---
+            LastError = NMEA.ProcessLine(TEST_RMC_FULL_DATA_FRAME.substr(0, TEST_RMC_FULL_DATA_FRAME.size() - 1), &FrameData);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Truncated checksum), error should be ERR__CRC_ERROR");
+        }
+#endif
+
+#ifdef NMEA0183_SENTENCE_HANDLERS
+        struct HandlerContext
+        {
+            size_t GGAcount;
+            uint8_t Satellites;
+            size_t OthersCount;
+            uint8_t OthersFieldCount;
+        };
+
+        TEST_METHOD(TestMethod_SentenceHandlers)
+        {
+            NMEA0183handlerDecoder NMEA;
+            HandlerContext Context = { 0, 0, 0, 0 };
+            eERRORRESULT LastError = ERR_OK;
+            const char* const TEST_STREAM = "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n$XXZZZ,data,00*4A\r\n$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+            eERRORRESULT Errors[3];
+            size_t FrameCount = 0;
+
+            //--- Test (Handlers with context) ---
+            NMEA.On<NMEA0183::GGA>([](const NMEA0183_GGAdata& gga, void* pContext) { HandlerContext* pCtx = (HandlerContext*)pContext; ++pCtx->GGAcount; pCtx->Satellites = gga.SatellitesUsed; }, &Context);
+            NMEA.On<NMEA0183::Others>([](const NMEA0183_SentenceView& view, void* pContext) { HandlerContext* pCtx = (HandlerContext*)pContext; ++pCtx->OthersCount; pCtx->OthersFieldCount = view.FieldCount; }, &Context);
+            for (size_t z = 0; z < strlen(TEST_STREAM); ++z)
+            {
+                (void)NMEA.AddReceivedCharacter(TEST_STREAM[z]);
+                if ((NMEA.GetDecoderState() == NMEA0183_TO_PROCESS) && (FrameCount < 3)) Errors[FrameCount++] = NMEA.ProcessFrame();
+            }
+            Assert::AreEqual((size_t)3, FrameCount, L"Test (Handlers with context), FrameCount should be 3");
+            Assert::AreEqual(ERR_OK, Errors[0], L"Test (Handlers with context), Errors[0] should be ERR_OK");
+            Assert::AreEqual(ERR_OK, Errors[1], L"Test (Handlers with context), Errors[1] should be ERR_OK");
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, Errors[2], L"Test (Handlers with context), Errors[2] should be ERR__UNKNOWN_ELEMENT (no RMC handler)");
+            Assert::AreEqual((size_t)1, Context.GGAcount, L"Test (Handlers with context), GGAcount should be 1");
+            Assert::AreEqual((uint8_t)10, Context.Satellites, L"Test (Handlers with context), Satellites should be 10");
+            Assert::AreEqual((size_t)1, Context.OthersCount, L"Test (Handlers with context), OthersCount should be 1");
+            Assert::AreEqual((uint8_t)2, Context.OthersFieldCount, L"Test (Handlers with context), OthersFieldCount should be 2");
+
+            //--- Test (Handler without context) ---
+            static char NavigationStatus = '\0';
+            NMEA.On<NMEA0183::RMC>([](const NMEA0183_RMCdata& rmc) { NavigationStatus = rmc.NavigationStatus; });
+            const char* const TEST_RMC = strstr(TEST_STREAM, "$GPRMC");
+            LastError = NMEA.DispatchLine(TEST_RMC, strlen(TEST_RMC));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Handler without context), error should be ERR_OK");
+            Assert::AreEqual('S', NavigationStatus, L"Test (Handler without context), NavigationStatus should be 'S'");
+
+            //--- Test (Handler removed) ---
+            NMEA.Off<NMEA0183::GGA>();
+            LastError = NMEA.DispatchLine(TEST_STREAM, strlen(TEST_STREAM));
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Handler removed), error should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual((size_t)1, Context.GGAcount, L"Test (Handler removed), GGAcount should still be 1");
+            LastError = NMEA.DispatchLine(TEST_RMC, strlen(TEST_RMC) - 4);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Bad line), error should be ERR__CRC_ERROR");
+        }
+#endif
+
+#if defined(NMEA0183_HAS_VARIANT) && defined(NMEA0183_DECODE_GGA) && defined(NMEA0183_DECODE_RMC)
+        TEST_METHOD(TestMethod_SentenceSetDecoder)
+        {
+            typedef NMEA0183sentenceSetDecoder<NMEA0183::GGA, NMEA0183::RMC> GPSsetDecoder;
+            GPSsetDecoder NMEA;
+            GPSsetDecoder::Result Result;
+            eERRORRESULT LastError = ERR_OK;
+
+            //--- Test (Sentence of the set) ---
+            const char* const TEST_GGA = "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n";
+            LastError = NMEA.ProcessLine(TEST_GGA, strlen(TEST_GGA), Result);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Sentence of the set), error should be ERR_OK");
+            Assert::AreEqual((eNMEA0183_TalkerID)NMEA0183_GP, NMEA.GetTalkerID(), L"Test (Sentence of the set), TalkerID should be NMEA0183_GP");
+            const NMEA0183_GGAdata* pGGA = GPSsetDecoder::Get<NMEA0183::GGA>(Result);
+            Assert::IsTrue(pGGA != NULL, L"Test (Sentence of the set), result should be a GGA");
+            Assert::AreEqual((uint8_t)10, pGGA->SatellitesUsed, L"Test (Sentence of the set), SatellitesUsed should be 10");
+            Assert::IsTrue(GPSsetDecoder::Get<NMEA0183::RMC>(Result) == NULL, L"Test (Sentence of the set), result should not be a RMC");
+
+            //--- Test (Sentence of the set through the decoder input) ---
+            const char* const TEST_RMC = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+            for (size_t z = 0; z < strlen(TEST_RMC); ++z) (void)NMEA.AddReceivedCharacter(TEST_RMC[z]);
+            Assert::AreEqual(NMEA0183_TO_PROCESS, NMEA.GetDecoderState(), L"Test (Sentence of the set through the decoder input), state should be NMEA0183_TO_PROCESS");
+            LastError = NMEA.ProcessFrame(Result);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Sentence of the set through the decoder input), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_WAIT_START, NMEA.GetDecoderState(), L"Test (Sentence of the set through the decoder input), state should be NMEA0183_WAIT_START");
+            const NMEA0183_RMCdata* pRMC = GPSsetDecoder::Get<NMEA0183::RMC>(Result);
+            Assert::IsTrue(pRMC != NULL, L"Test (Sentence of the set through the decoder input), result should be a RMC");
+            Assert::AreEqual('S', pRMC->NavigationStatus, L"Test (Sentence of the set through the decoder input), NavigationStatus should be 'S'");
+
+            //--- Test (Sentence not in the set) ---
+            const char* const TEST_GLL = "$GNGLL,4404.14012,N,12118.85993,W,001037.10,A,A*66\r\n";
+            LastError = NMEA.ProcessLine(TEST_GLL, strlen(TEST_GLL), Result);
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Sentence not in the set), error should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual((size_t)0, Result.index(), L"Test (Sentence not in the set), result should be empty");
+            const char* const TEST_UNKNOWN = "$XXZZZ,data,00*4A\r\n";
+            LastError = NMEA.ProcessLine(TEST_UNKNOWN, strlen(TEST_UNKNOWN), Result);
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Sentence not in the set), error should be ERR__UNKNOWN_ELEMENT for an unknown sentence");
+
+            //--- Test (Bad line) ---
+            LastError = NMEA.ProcessLine(TEST_GGA, strlen(TEST_GGA) - 4, Result);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Bad line), error should be ERR__CRC_ERROR");
+            Assert::AreEqual((size_t)0, Result.index(), L"Test (Bad line), result should be empty");
+
+            //--- Test (Bad frame through the decoder input) ---
+            const char* const TEST_BAD_RMC = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7B\r\n";
+            for (size_t z = 0; z < strlen(TEST_BAD_RMC); ++z) (void)NMEA.AddReceivedCharacter(TEST_BAD_RMC[z]);
+            LastError = NMEA.ProcessFrame(Result);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Bad frame through the decoder input), error should be ERR__CRC_ERROR");
+            Assert::AreEqual((size_t)0, Result.index(), L"Test (Bad frame through the decoder input), result should be empty");
+            Assert::AreEqual(NMEA0183_WAIT_START, NMEA.GetDecoderState(), L"Test (Bad frame through the decoder input), state should be NMEA0183_WAIT_START");
+        }
+#endif
+
+        struct ROTdata
+        {
+            int32_t Rate;
+            char Status;
+            char Name[8];
+        };
+        typedef NMEA0183::Schema::Sentence<ROTdata, NMEA0183_SCHEMA_INT(ROTdata, Rate, 1), NMEA0183_SCHEMA_CHAR(ROTdata, Status), NMEA0183_SCHEMA_SKIP, NMEA0183_SCHEMA_OPTIONAL(NMEA0183_SCHEMA_TEXT(ROTdata, Name))> ROTschema;
+
+        template<class Schema, typename DataT>
+        static void CheckSchema(const char* pSentence, eERRORRESULT (*fnParser)(const char*, DataT*), const wchar_t* pMessage)
+        {
+            DataT Expected, Generated;
+            memset(&Expected, 0xA5, sizeof(DataT));
+            memset(&Generated, 0xA5, sizeof(DataT));
+            const eERRORRESULT ExpectedError = fnParser(pSentence, &Expected);
+            Assert::AreEqual(ExpectedError, Schema::Parse(pSentence, &Generated), pMessage);
+            if (ExpectedError == ERR_OK) Assert::IsTrue(memcmp(&Expected, &Generated, sizeof(DataT)) == 0, pMessage);
+        }
+
+        TEST_METHOD(TestMethod_SentenceSchema)
+        {
+            //--- Test (Generated parsers are the same as the hand-written ones) ---
+#ifdef NMEA0183_DECODE_AAM
+            CheckSchema<NMEA0183::Schema::AAM>("A,A,0.10,N,WPTNME*32", NMEA0183_ProcessAAM, L"Test (Schema AAM valid), should decode as NMEA0183_ProcessAAM");
+            CheckSchema<NMEA0183::Schema::AAM>(",,,N,*", NMEA0183_ProcessAAM, L"Test (Schema AAM empty fields), should decode as NMEA0183_ProcessAAM");
+            CheckSchema<NMEA0183::Schema::AAM>("A,A,0.10,N,WPT,NME*", NMEA0183_ProcessAAM, L"Test (Schema AAM text with ','), should decode as NMEA0183_ProcessAAM");
+            CheckSchema<NMEA0183::Schema::AAM>("A,A,0.10,M,WPTNME*", NMEA0183_ProcessAAM, L"Test (Schema AAM bad unit), should fail as NMEA0183_ProcessAAM");
+#endif
+#ifdef NMEA0183_DECODE_ALM
+            CheckSchema<NMEA0183::Schema::ALM>("1,1,15,1159,00,441d,4e,16be,fd5e,a10c9f,4a2da4,686e81,58cbe1,0a4,001*5B", NMEA0183_ProcessALM, L"Test (Schema ALM valid), should decode as NMEA0183_ProcessALM");
+            CheckSchema<NMEA0183::Schema::ALM>("1,1,15,1159,00,441d,4e,16be,fd5e,a10c9f,800000,ffffff,7fffff,400,7ff*", NMEA0183_ProcessALM, L"Test (Schema ALM negative values), should decode as NMEA0183_ProcessALM");
+            CheckSchema<NMEA0183::Schema::ALM>("1,1,15,1159,,,,,,,,,,,*", NMEA0183_ProcessALM, L"Test (Schema ALM empty fields), should decode as NMEA0183_ProcessALM");
+            CheckSchema<NMEA0183::Schema::ALM>("1,1,15,1159,00,441d,4e,16be,fd5e,a10c9f,4a2da4,686e81,58cbe1,0a4*", NMEA0183_ProcessALM, L"Test (Schema ALM missing field), should fail as NMEA0183_ProcessALM");
+#endif
+#ifdef NMEA0183_DECODE_APB
+            CheckSchema<NMEA0183::Schema::APB>("A,A,0.10,R,N,V,V,011,M,DEST,011,M,011,M*3C", NMEA0183_ProcessAPB, L"Test (Schema APB valid), should decode as NMEA0183_ProcessAPB");
+            CheckSchema<NMEA0183::Schema::APB>("A,A,0.10,R,N,V,V,011,M,DEST,011,M,011,M,A*", NMEA0183_ProcessAPB, L"Test (Schema APB with FAA mode), should decode as NMEA0183_ProcessAPB");
+            CheckSchema<NMEA0183::Schema::APB>(",,,,,,,,,,,,,,*", NMEA0183_ProcessAPB, L"Test (Schema APB empty fields), should decode as NMEA0183_ProcessAPB");
+            CheckSchema<NMEA0183::Schema::APB>("A,A,0.10,R,N,V,V,011,M,DEST,011,M,011*", NMEA0183_ProcessAPB, L"Test (Schema APB missing field), should fail as NMEA0183_ProcessAPB");
+#endif
+#ifdef NMEA0183_DECODE_BEC
+            CheckSchema<NMEA0183::Schema::BEC>("220516,5130.02,N,04607.42,W,213.8,T,218.0,M,0004.6,N,EGLM*11", NMEA0183_ProcessBEC, L"Test (Schema BEC valid), should decode as NMEA0183_ProcessBEC");
+            CheckSchema<NMEA0183::Schema::BEC>(",,,,,,T,,M,,N,*", NMEA0183_ProcessBEC, L"Test (Schema BEC empty fields), should decode as NMEA0183_ProcessBEC");
+            CheckSchema<NMEA0183::Schema::BEC>("220516,5130.02,N,04607.42,W,213.8,T,218.0,M,0004.6,K,EGLM*", NMEA0183_ProcessBEC, L"Test (Schema BEC bad unit), should fail as NMEA0183_ProcessBEC");
+#endif
+#ifdef NMEA0183_DECODE_BOD
+            CheckSchema<NMEA0183::Schema::BOD>("097.0,T,103.2,M,POINTB,POINTA*48", NMEA0183_ProcessBOD, L"Test (Schema BOD valid), should decode as NMEA0183_ProcessBOD");
+            CheckSchema<NMEA0183::Schema::BOD>("097.0,T,103.2,M,POINTB*", NMEA0183_ProcessBOD, L"Test (Schema BOD without optional field), should decode as NMEA0183_ProcessBOD");
+            CheckSchema<NMEA0183::Schema::BOD>(",T,,M,,*", NMEA0183_ProcessBOD, L"Test (Schema BOD empty fields), should decode as NMEA0183_ProcessBOD");
+            CheckSchema<NMEA0183::Schema::BOD>("097.0,T,103.2,M*", NMEA0183_ProcessBOD, L"Test (Schema BOD missing field), should fail as NMEA0183_ProcessBOD");
+#endif
+#ifdef NMEA0183_DECODE_BWW
+            CheckSchema<NMEA0183::Schema::BWW>("164.3,T,164.5,M,POINTB,POINTA*49", NMEA0183_ProcessBWW, L"Test (Schema BWW valid), should decode as NMEA0183_ProcessBWW");
+            CheckSchema<NMEA0183::Schema::BWW>("164.3,T,164.5,M,POINTB,POINT,A*", NMEA0183_ProcessBWW, L"Test (Schema BWW text with ','), should decode as NMEA0183_ProcessBWW");
+            CheckSchema<NMEA0183::Schema::BWW>("164.3,T,164.5,M,POINTB*", NMEA0183_ProcessBWW, L"Test (Schema BWW missing field), should fail as NMEA0183_ProcessBWW");
+#endif
+#if defined(NMEA0183_DECODE_DBK) || defined(NMEA0183_DECODE_DBS) || defined(NMEA0183_DECODE_DBT)
+            CheckSchema<NMEA0183::Schema::DBx>("10.5,f,3.2,M,1.7,F*", NMEA0183_ProcessDBx, L"Test (Schema DBx valid), should decode as NMEA0183_ProcessDBx");
+            CheckSchema<NMEA0183::Schema::DBx>(",f,,M,,F*", NMEA0183_ProcessDBx, L"Test (Schema DBx empty fields), should decode as NMEA0183_ProcessDBx");
+            CheckSchema<NMEA0183::Schema::DBx>("10.5,f,3.2,M,1.7*", NMEA0183_ProcessDBx, L"Test (Schema DBx missing field), should fail as NMEA0183_ProcessDBx");
+#endif
+#ifdef NMEA0183_DECODE_DPT
+            CheckSchema<NMEA0183::Schema::DPT>("2.8,-0.7*", NMEA0183_ProcessDPT, L"Test (Schema DPT valid), should decode as NMEA0183_ProcessDPT");
+            CheckSchema<NMEA0183::Schema::DPT>("2.8,0.5,100*", NMEA0183_ProcessDPT, L"Test (Schema DPT with range scale), should decode as NMEA0183_ProcessDPT");
+            CheckSchema<NMEA0183::Schema::DPT>("2.8,,*", NMEA0183_ProcessDPT, L"Test (Schema DPT empty offset), should decode as NMEA0183_ProcessDPT");
+            CheckSchema<NMEA0183::Schema::DPT>("2.8*", NMEA0183_ProcessDPT, L"Test (Schema DPT missing field), should fail as NMEA0183_ProcessDPT");
+#endif
+#ifdef NMEA0183_DECODE_FSI
+            CheckSchema<NMEA0183::Schema::FSI>("002085,004165,d,0*", NMEA0183_ProcessFSI, L"Test (Schema FSI valid), should decode as NMEA0183_ProcessFSI");
+            CheckSchema<NMEA0183::Schema::FSI>(",,,*", NMEA0183_ProcessFSI, L"Test (Schema FSI empty fields), should decode as NMEA0183_ProcessFSI");
+            CheckSchema<NMEA0183::Schema::FSI>("002085,004165,d*", NMEA0183_ProcessFSI, L"Test (Schema FSI missing field), should fail as NMEA0183_ProcessFSI");
+#endif
+#ifdef NMEA0183_DECODE_GGA
+            CheckSchema<NMEA0183::Schema::GGA>("002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E", NMEA0183_ProcessGGA, L"Test (Schema GGA valid), should decode as NMEA0183_ProcessGGA");
+            CheckSchema<NMEA0183::Schema::GGA>("001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,M,-21.3,M*47", NMEA0183_ProcessGGA, L"Test (Schema GGA without optional fields), should decode as NMEA0183_ProcessGGA");
+            CheckSchema<NMEA0183::Schema::GGA>("001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,M,-21.3,M,2.5*47", NMEA0183_ProcessGGA, L"Test (Schema GGA with one optional field), should decode as NMEA0183_ProcessGGA");
+            CheckSchema<NMEA0183::Schema::GGA>(",,,,,0,00,,,M,,M,,*66", NMEA0183_ProcessGGA, L"Test (Schema GGA empty fields), should decode as NMEA0183_ProcessGGA");
+            CheckSchema<NMEA0183::Schema::GGA>(",,,,,,,,,M,,M,,*66", NMEA0183_ProcessGGA, L"Test (Schema GGA all fields empty), should decode as NMEA0183_ProcessGGA");
+            CheckSchema<NMEA0183::Schema::GGA>("001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,F,-21.3,M*47", NMEA0183_ProcessGGA, L"Test (Schema GGA bad unit), should fail as NMEA0183_ProcessGGA");
+#endif
+#ifdef NMEA0183_DECODE_GLL
+            CheckSchema<NMEA0183::Schema::GLL>("4916.45,N,12311.12,W,225444,A*", NMEA0183_ProcessGLL, L"Test (Schema GLL valid), should decode as NMEA0183_ProcessGLL");
+            CheckSchema<NMEA0183::Schema::GLL>("4916.45,N,12311.12,W,225444,A,D*", NMEA0183_ProcessGLL, L"Test (Schema GLL with FAA mode), should decode as NMEA0183_ProcessGLL");
+            CheckSchema<NMEA0183::Schema::GLL>(",,,,,*", NMEA0183_ProcessGLL, L"Test (Schema GLL empty fields), should decode as NMEA0183_ProcessGLL");
+            CheckSchema<NMEA0183::Schema::GLL>("4916.45,N,12311.12,W,225444*", NMEA0183_ProcessGLL, L"Test (Schema GLL missing field), should fail as NMEA0183_ProcessGLL");
+#endif
+#ifdef NMEA0183_DECODE_GSA
+            CheckSchema<NMEA0183::Schema::GSA>("A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39", NMEA0183_ProcessGSA, L"Test (Schema GSA valid), should decode as NMEA0183_ProcessGSA");
+            CheckSchema<NMEA0183::Schema::GSA>(",,,,,,,,,,,,,,,,*", NMEA0183_ProcessGSA, L"Test (Schema GSA empty fields), should decode as NMEA0183_ProcessGSA");
+            CheckSchema<NMEA0183::Schema::GSA>("A,3,04,05,,09,12,,,24,,,2.5,1.3,2.1*", NMEA0183_ProcessGSA, L"Test (Schema GSA missing satellite IDs), should fail as NMEA0183_ProcessGSA");
+            CheckSchema<NMEA0183::Schema::GSA>("A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1,1*", NMEA0183_ProcessGSA, L"Test (Schema GSA too many fields), should fail as NMEA0183_ProcessGSA");
+#endif
+#ifdef NMEA0183_DECODE_GSV
+            CheckSchema<NMEA0183::Schema::GSV>("3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74", NMEA0183_ProcessGSV, L"Test (Schema GSV 4 satellites), should decode as NMEA0183_ProcessGSV");
+            CheckSchema<NMEA0183::Schema::GSV>("1,1,01,03,03,111,00*", NMEA0183_ProcessGSV, L"Test (Schema GSV 1 satellite), should decode as NMEA0183_ProcessGSV");
+            CheckSchema<NMEA0183::Schema::GSV>("1,1,02,03,03,111,00,04,15*", NMEA0183_ProcessGSV, L"Test (Schema GSV partial satellite), should decode as NMEA0183_ProcessGSV");
+            CheckSchema<NMEA0183::Schema::GSV>("1,1,00,,,,*", NMEA0183_ProcessGSV, L"Test (Schema GSV empty satellite), should decode as NMEA0183_ProcessGSV");
+            CheckSchema<NMEA0183::Schema::GSV>("1,1,01,03,03,111,123*", NMEA0183_ProcessGSV, L"Test (Schema GSV SNR too long), should fail as NMEA0183_ProcessGSV");
+            CheckSchema<NMEA0183::Schema::GSV>("1,1,01,03,03,111*", NMEA0183_ProcessGSV, L"Test (Schema GSV missing field), should fail as NMEA0183_ProcessGSV");
+            CheckSchema<NMEA0183::Schema::GSV>("3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00,14*", NMEA0183_ProcessGSV, L"Test (Schema GSV too many fields), should fail as NMEA0183_ProcessGSV");
+#endif
+#ifdef NMEA0183_DECODE_HDG
+            CheckSchema<NMEA0183::Schema::HDG>("101.1,,,7.1,W*", NMEA0183_ProcessHDG, L"Test (Schema HDG valid), should decode as NMEA0183_ProcessHDG");
+            CheckSchema<NMEA0183::Schema::HDG>("101.1,1.5,E,7.1,W*", NMEA0183_ProcessHDG, L"Test (Schema HDG with deviation), should decode as NMEA0183_ProcessHDG");
+            CheckSchema<NMEA0183::Schema::HDG>("101.1,,,7.1*", NMEA0183_ProcessHDG, L"Test (Schema HDG missing field), should fail as NMEA0183_ProcessHDG");
+#endif
+#ifdef NMEA0183_DECODE_HDM
+            CheckSchema<NMEA0183::Schema::HDM>("101.1,M*", NMEA0183_ProcessHDM, L"Test (Schema HDM valid), should decode as NMEA0183_ProcessHDM");
+            CheckSchema<NMEA0183::Schema::HDM>(",M*", NMEA0183_ProcessHDM, L"Test (Schema HDM empty field), should decode as NMEA0183_ProcessHDM");
+            CheckSchema<NMEA0183::Schema::HDM>("101.1,T*", NMEA0183_ProcessHDM, L"Test (Schema HDM bad unit), should fail as NMEA0183_ProcessHDM");
+#endif
+#ifdef NMEA0183_DECODE_HDT
+            CheckSchema<NMEA0183::Schema::HDT>("101.1,T*", NMEA0183_ProcessHDT, L"Test (Schema HDT valid), should decode as NMEA0183_ProcessHDT");
+            CheckSchema<NMEA0183::Schema::HDT>(",T*", NMEA0183_ProcessHDT, L"Test (Schema HDT empty field), should decode as NMEA0183_ProcessHDT");
+            CheckSchema<NMEA0183::Schema::HDT>("101.1,M*", NMEA0183_ProcessHDT, L"Test (Schema HDT bad unit), should fail as NMEA0183_ProcessHDT");
+#endif
+#ifdef NMEA0183_DECODE_MTW
+            CheckSchema<NMEA0183::Schema::MTW>("17.9,C*", NMEA0183_ProcessMTW, L"Test (Schema MTW valid), should decode as NMEA0183_ProcessMTW");
+            CheckSchema<NMEA0183::Schema::MTW>("-3.25,C*", NMEA0183_ProcessMTW, L"Test (Schema MTW negative value), should decode as NMEA0183_ProcessMTW");
+            CheckSchema<NMEA0183::Schema::MTW>("17.9,F*", NMEA0183_ProcessMTW, L"Test (Schema MTW bad unit), should fail as NMEA0183_ProcessMTW");
+#endif
+#ifdef NMEA0183_DECODE_MWV
+            CheckSchema<NMEA0183::Schema::MWV>("214.8,R,0.1,K,A*28", NMEA0183_ProcessMWV, L"Test (Schema MWV valid), should decode as NMEA0183_ProcessMWV");
+            CheckSchema<NMEA0183::Schema::MWV>(",,,,*", NMEA0183_ProcessMWV, L"Test (Schema MWV empty fields), should decode as NMEA0183_ProcessMWV");
+            CheckSchema<NMEA0183::Schema::MWV>("214.8,R,0.1,K*28", NMEA0183_ProcessMWV, L"Test (Schema MWV missing field), should fail as NMEA0183_ProcessMWV");
+#endif
+#ifdef NMEA0183_DECODE_RMC
+            CheckSchema<NMEA0183::Schema::RMC>("225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E*68", NMEA0183_ProcessRMC, L"Test (Schema RMC valid), should decode as NMEA0183_ProcessRMC");
+            CheckSchema<NMEA0183::Schema::RMC>("225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A*", NMEA0183_ProcessRMC, L"Test (Schema RMC with FAA mode), should decode as NMEA0183_ProcessRMC");
+            CheckSchema<NMEA0183::Schema::RMC>("225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*", NMEA0183_ProcessRMC, L"Test (Schema RMC with navigation status), should decode as NMEA0183_ProcessRMC");
+            CheckSchema<NMEA0183::Schema::RMC>(",,,,,,,,,,*", NMEA0183_ProcessRMC, L"Test (Schema RMC empty fields), should decode as NMEA0183_ProcessRMC");
+            CheckSchema<NMEA0183::Schema::RMC>("225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3*", NMEA0183_ProcessRMC, L"Test (Schema RMC missing field), should fail as NMEA0183_ProcessRMC");
+#endif
+#ifdef NMEA0183_DECODE_TXT
+            CheckSchema<NMEA0183::Schema::TXT>("01,01,02,u-blox ag - www.u-blox.com*50", NMEA0183_ProcessTXT, L"Test (Schema TXT valid), should decode as NMEA0183_ProcessTXT");
+            CheckSchema<NMEA0183::Schema::TXT>("01,01,02,A^2CB^5eC,D*", NMEA0183_ProcessTXT, L"Test (Schema TXT escaped chars), should decode as NMEA0183_ProcessTXT");
+            CheckSchema<NMEA0183::Schema::TXT>("01,01,02,*", NMEA0183_ProcessTXT, L"Test (Schema TXT empty text), should decode as NMEA0183_ProcessTXT");
+            CheckSchema<NMEA0183::Schema::TXT>("01,01,02,AB^*", NMEA0183_ProcessTXT, L"Test (Schema TXT bad escaped char), should fail as NMEA0183_ProcessTXT");
+            CheckSchema<NMEA0183::Schema::TXT>("01,01*", NMEA0183_ProcessTXT, L"Test (Schema TXT missing field), should fail as NMEA0183_ProcessTXT");
+#endif
+#ifdef NMEA0183_DECODE_VHW
+            CheckSchema<NMEA0183::Schema::VHW>("245.1,T,245.1,M,000.01,N,000.01,K*", NMEA0183_ProcessVHW, L"Test (Schema VHW valid), should decode as NMEA0183_ProcessVHW");
+            CheckSchema<NMEA0183::Schema::VHW>(",T,,M,,N,,K*", NMEA0183_ProcessVHW, L"Test (Schema VHW empty fields), should decode as NMEA0183_ProcessVHW");
+            CheckSchema<NMEA0183::Schema::VHW>("245.1,T,245.1,M,000.01,N,000.01,M*", NMEA0183_ProcessVHW, L"Test (Schema VHW bad unit), should fail as NMEA0183_ProcessVHW");
+#endif
+#ifdef NMEA0183_DECODE_VTG
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,T,034.4,M,005.5,N,010.2,K*48", NMEA0183_ProcessVTG, L"Test (Schema VTG valid), should decode as NMEA0183_ProcessVTG");
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,T,034.4,M,005.5,N,010.2,K,A*", NMEA0183_ProcessVTG, L"Test (Schema VTG with FAA mode), should decode as NMEA0183_ProcessVTG");
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,,034.4,,005.5,,010.2,*", NMEA0183_ProcessVTG, L"Test (Schema VTG empty units), should decode as NMEA0183_ProcessVTG");
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,034.4,005.5,010.2*", NMEA0183_ProcessVTG, L"Test (Schema VTG older format), should decode as NMEA0183_ProcessVTG");
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,034.4,005.5*", NMEA0183_ProcessVTG, L"Test (Schema VTG older format missing field), should fail as NMEA0183_ProcessVTG");
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,034.4,005.5,010.2,A*", NMEA0183_ProcessVTG, L"Test (Schema VTG older format too many fields), should fail as NMEA0183_ProcessVTG");
+            CheckSchema<NMEA0183::Schema::VTG>("054.7,X,034.4,M,005.5,N,010.2,K*", NMEA0183_ProcessVTG, L"Test (Schema VTG bad unit), should fail as NMEA0183_ProcessVTG");
+#endif
+#ifdef NMEA0183_DECODE_ZDA
+            CheckSchema<NMEA0183::Schema::ZDA>("201530.00,04,07,2002,00,00*60", NMEA0183_ProcessZDA, L"Test (Schema ZDA valid), should decode as NMEA0183_ProcessZDA");
+            CheckSchema<NMEA0183::Schema::ZDA>("201530.00,04,07,2002,-05,30*", NMEA0183_ProcessZDA, L"Test (Schema ZDA negative zone), should decode as NMEA0183_ProcessZDA");
+            CheckSchema<NMEA0183::Schema::ZDA>("201530.00,04,07,2002,-00,30*", NMEA0183_ProcessZDA, L"Test (Schema ZDA zone -00), should decode as NMEA0183_ProcessZDA");
+            CheckSchema<NMEA0183::Schema::ZDA>(",,,,,*", NMEA0183_ProcessZDA, L"Test (Schema ZDA empty fields), should decode as NMEA0183_ProcessZDA");
+            CheckSchema<NMEA0183::Schema::ZDA>("201530.00,04,07,2002,00*", NMEA0183_ProcessZDA, L"Test (Schema ZDA missing field), should fail as NMEA0183_ProcessZDA");
+#endif
+
+            //--- Test (Sentence unknown by the library) ---
+            ROTdata ROT;
+            Assert::AreEqual(ERR_OK, ROTschema::Parse("-12.5,A,xx,RUDDER*00", &ROT), L"Test (Schema ROT), error should be ERR_OK");
+            Assert::AreEqual((int32_t)-125, ROT.Rate, L"Test (Schema ROT), Rate should be -125");
+            Assert::AreEqual('A', ROT.Status, L"Test (Schema ROT), Status should be 'A'");
+            Assert::AreEqual(0, strcmp(ROT.Name, "RUDDER"), L"Test (Schema ROT), Name should be \"RUDDER\"");
+            Assert::AreEqual(ERR_OK, ROTschema::Parse("3.0,V,*00", &ROT), L"Test (Schema ROT without optional field), error should be ERR_OK");
+            Assert::AreEqual((int32_t)30, ROT.Rate, L"Test (Schema ROT without optional field), Rate should be 30");
+            Assert::AreEqual('\0', ROT.Name[0], L"Test (Schema ROT without optional field), Name should be empty");
+#ifdef NMEA0183_PARSE_ERROR_DIAGNOSTICS
+            Assert::AreEqual(NMEA0183_PARSE_ERROR_AT(5), ROTschema::Parse("3.0,V*00", &ROT), L"Test (Schema ROT missing field), error should be ERR__PARSE_ERROR at the '*'");
+#else
+            Assert::AreEqual(ERR__PARSE_ERROR, ROTschema::Parse("3.0,V*00", &ROT), L"Test (Schema ROT missing field), error should be ERR__PARSE_ERROR");
+#endif
+        }
     };
 
 
@@ -268,10 +580,1285 @@ namespace NMEA0183test
             Assert::AreEqual('A', FrameData.RMC.FAAmode, L"Test (Full Data), FAAmode should be 'A'");
             Assert::AreEqual('S', FrameData.RMC.NavigationStatus, L"Test (Full Data), NavigationStatus should be 'S'");
         }
+
+        TEST_METHOD(TestMethod_ProcessLineN)
+        {
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+            const char TEST_BUFFER[] = { "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n$XXZZZ,data,00*4A\r\n$GP*17" };
+            const size_t RMC_SIZE = 70, UNKNOWN_POS = RMC_SIZE + 2, UNKNOWN_SIZE = 17, SHORT_POS = UNKNOWN_POS + UNKNOWN_SIZE + 2;
+
+            //--- Test (No data) ---
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[0], 0, &FrameData);
+            Assert::AreEqual(ERR__BAD_FRAME_TYPE, LastError, L"Test (No data), error should be ERR__BAD_FRAME_TYPE");
+
+            //--- Test (Truncated lines) ---
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[0], RMC_SIZE - 3, &FrameData);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Truncated before '*'), error should be ERR__CRC_ERROR");
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[0], RMC_SIZE - 2, &FrameData);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Truncated after '*'), error should be ERR__CRC_ERROR");
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[0], RMC_SIZE - 1, &FrameData);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Truncated checksum), error should be ERR__CRC_ERROR");
+            Assert::AreEqual(false, FrameData.ParseIsValid, L"Test (Truncated checksum), ParseIsValid should be false");
+
+            //--- Test (Line without terminal) ---
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[0], RMC_SIZE, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Line without terminal), error should be ERR_OK");
+            Assert::AreEqual(true, FrameData.ParseIsValid, L"Test (Line without terminal), ParseIsValid should be true");
+            Assert::AreEqual(NMEA0183_RMC, FrameData.SentenceID, L"Test (Line without terminal), SentenceID should be NMEA0183_RMC");
+            Assert::AreEqual('S', FrameData.RMC.NavigationStatus, L"Test (Line without terminal), NavigationStatus should be 'S'");
+
+            //--- Test (Unknown frame in the middle of the buffer) ---
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[UNKNOWN_POS], UNKNOWN_SIZE + 2, &FrameData);
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Unknown frame), error should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual(NMEA0183_UNKNOWN, FrameData.SentenceID, L"Test (Unknown frame), SentenceID should be NMEA0183_UNKNOWN");
+            Assert::AreEqual(0, strncmp(&TEST_BUFFER[UNKNOWN_POS], &FrameData.Frame[0], UNKNOWN_SIZE), L"Test (Unknown frame), FrameData.Frame should be the unknown frame");
+            Assert::AreEqual('\0', FrameData.Frame[UNKNOWN_SIZE], L"Test (Unknown frame), FrameData.Frame should end after the checksum");
+
+            //--- Test (No field) ---
+            LastError = NMEA0183_ProcessLineN(&TEST_BUFFER[SHORT_POS], 6, &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test (No field), error should be ERR__PARSE_ERROR");
+        }
+
+        TEST_METHOD(TestMethod_SentenceView)
+        {
+            NMEA0183_SentenceView View;
+            NMEA0183_DecodedData FrameData;
+            NMEA0183_Coordinate Coordinate;
+            NMEA0183_Time Time;
+            eERRORRESULT LastError = ERR_OK;
+            int32_t Value = 0;
+            char Char = '\0';
+            const char* pField = NULL;
+            size_t Size = 0;
+
+            //--- Test (Known sentence) ---
+            const char* const TEST_GGA = "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n";
+            LastError = Init_NMEA0183SentenceView(&View, TEST_GGA, strlen(TEST_GGA));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Known sentence), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_GGA, View.SentenceID, L"Test (Known sentence), SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual((uint16_t)NMEA0183_GP, (uint16_t)View.TalkerID, L"Test (Known sentence), TalkerID should be NMEA0183_GP");
+            Assert::AreEqual((uint8_t)14, View.FieldCount, L"Test (Known sentence), FieldCount should be 14");
+            LastError = NMEA0183_SentenceView_GetTime(&View, 0, &Time);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Known sentence), GetTime error should be ERR_OK");
+            Assert::AreEqual((uint8_t)0, Time.Hour, L"Test (Known sentence), Time.Hour should be 0");
+            Assert::AreEqual((uint8_t)21, Time.Minute, L"Test (Known sentence), Time.Minute should be 21");
+            Assert::AreEqual((uint8_t)53, Time.Second, L"Test (Known sentence), Time.Second should be 53");
+            Assert::AreEqual((uint16_t)0, Time.MilliS, L"Test (Known sentence), Time.MilliS should be 0");
+            LastError = NMEA0183_SentenceView_GetCoordinate(&View, 3, &Coordinate);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Known sentence), GetCoordinate error should be ERR_OK");
+            Assert::AreEqual((uint8_t)11, Coordinate.Degree, L"Test (Known sentence), Coordinate.Degree should be 11");
+            Assert::AreEqual(157385800u, Coordinate.Minute, L"Test (Known sentence), Coordinate.Minute should be 157385800");
+            Assert::AreEqual('W', Coordinate.Direction, L"Test (Known sentence), Coordinate.Direction should be 'W'");
+            LastError = NMEA0183_SentenceView_GetChar(&View, 2, &Char);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Known sentence), GetChar error should be ERR_OK");
+            Assert::AreEqual('N', Char, L"Test (Known sentence), Char should be 'N'");
+            LastError = NMEA0183_SentenceView_GetInt(&View, 10, 2, &Value);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Known sentence), GetInt error should be ERR_OK");
+            Assert::AreEqual(-3420, Value, L"Test (Known sentence), Value should be -3420");
+            LastError = NMEA0183_SentenceView_GetInt(&View, 12, 0, &Value);
+            Assert::AreEqual(ERR__EMPTY_DATA, LastError, L"Test (Empty field), error should be ERR__EMPTY_DATA");
+            LastError = NMEA0183_SentenceView_GetInt(&View, 13, 0, &Value);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Last field), error should be ERR_OK");
+            Assert::AreEqual(0, Value, L"Test (Last field), Value should be 0");
+            LastError = NMEA0183_SentenceView_GetField(&View, 14, &pField, &Size);
+            Assert::AreEqual(ERR__OUT_OF_RANGE, LastError, L"Test (No field), error should be ERR__OUT_OF_RANGE");
+
+            //--- Test (Sentence unknown by the library, no '\0' terminal) ---
+            const char TEST_XDR[] = { '$','I','I','X','D','R',',','C',',','1','9','.','5',',','C',',','A','I','R','T','E','M','P',',','C',',','-','2','.','5',',','C',',','W','A','T','E','R','*','5','A' };
+            LastError = Init_NMEA0183SentenceView(&View, TEST_XDR, sizeof(TEST_XDR));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Unknown sentence), error should be ERR_OK");
+            Assert::AreEqual((uint32_t)NMEA0183_SENTENCE_ID('X', 'D', 'R'), (uint32_t)View.SentenceID, L"Test (Unknown sentence), SentenceID should be 'XDR'");
+            Assert::AreEqual((uint8_t)8, View.FieldCount, L"Test (Unknown sentence), FieldCount should be 8");
+            LastError = NMEA0183_SentenceView_GetInt(&View, 5, 1, &Value);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Unknown sentence), GetInt error should be ERR_OK");
+            Assert::AreEqual(-25, Value, L"Test (Unknown sentence), Value should be -25");
+            LastError = NMEA0183_SentenceView_GetField(&View, 7, &pField, &Size);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Unknown sentence), GetField error should be ERR_OK");
+            Assert::AreEqual((size_t)5, Size, L"Test (Unknown sentence), Size should be 5");
+            Assert::AreEqual(0, strncmp("WATER", pField, Size), L"Test (Unknown sentence), field should be 'WATER'");
+
+            //--- Test (View of an unknown decoded frame) ---
+            LastError = NMEA0183_ProcessLine("$PGRME,15.0,M,45.0,M,25.0,M*1C\r\n", &FrameData);
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Unknown decoded frame), error should be ERR__UNKNOWN_ELEMENT");
+            LastError = Init_NMEA0183SentenceView(&View, &FrameData.Frame[0], strlen(&FrameData.Frame[0]));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Unknown decoded frame), error should be ERR_OK");
+            Assert::AreEqual((uint8_t)5, View.AddressSize, L"Test (Unknown decoded frame), AddressSize should be 5");
+            Assert::AreEqual(0, strncmp("PGRME", &View.pSentence[1], View.AddressSize), L"Test (Unknown decoded frame), address should be 'PGRME'");
+            LastError = NMEA0183_SentenceView_GetInt(&View, 4, 1, &Value);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Unknown decoded frame), GetInt error should be ERR_OK");
+            Assert::AreEqual(250, Value, L"Test (Unknown decoded frame), Value should be 250");
+
+            //--- Test (Bad checksum) ---
+            LastError = Init_NMEA0183SentenceView(&View, "$PGRME,15.0,M,45.0,M,25.0,M*1D", 30);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Bad checksum), error should be ERR__CRC_ERROR");
+            Assert::AreEqual((uint8_t)0, View.FieldCount, L"Test (Bad checksum), FieldCount should be 0");
+
+            //--- Test (Only empty fields) ---
+            char Line[NMEA0183_FRAME_BUFFER_SIZE + 8];
+            size_t Pos = 0;
+            uint8_t CRC = 0;
+            memcpy(&Line[0], "$GPXXX", 6); Pos += 6;
+            while (Pos < (NMEA0183_FRAME_BUFFER_SIZE - 4)) Line[Pos++] = ','; // Longest frame, all its fields are empty
+            for (size_t z = 1; z < Pos; ++z) CRC ^= (uint8_t)Line[z];
+            snprintf(&Line[Pos], 6, "*%02X\r\n", (unsigned)CRC);
+            LastError = Init_NMEA0183SentenceView(&View, &Line[0], Pos + 5);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Only empty fields), error should be ERR_OK");
+            Assert::AreEqual((uint32_t)(Pos - 6), (uint32_t)View.FieldCount, L"Test (Only empty fields), FieldCount should be the count of ','");
+            LastError = NMEA0183_SentenceView_GetField(&View, View.FieldCount - 1, &pField, &Size);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Only empty fields), GetField error should be ERR_OK");
+            Assert::AreEqual(0u, (uint32_t)Size, L"Test (Only empty fields), Size of the last field should be 0");
+            Assert::AreEqual('*', pField[0], L"Test (Only empty fields), the last field should end at the '*'");
+
+            //--- Test (C++ class) ---
+            NMEA0183sentenceView ViewClass;
+            LastError = ViewClass.Open(TEST_GGA, strlen(TEST_GGA));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (C++ class), error should be ERR_OK");
+            LastError = ViewClass.GetInt(6, 0, &Value);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (C++ class), GetInt error should be ERR_OK");
+            Assert::AreEqual(10, Value, L"Test (C++ class), Value should be 10");
+        }
+
+        TEST_METHOD(TestMethod_ProcessLineChecksum)
+        {
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+            char Line[NMEA0183_FRAME_BUFFER_SIZE + 32 + 8];
+
+            //--- Test all frame sizes at all alignments (vectorized and scalar checksum paths should agree) ---
+            for (size_t zOffset = 0; zOffset < 32; ++zOffset)
+                for (size_t zPayload = 0; zPayload <= (NMEA0183_FRAME_BUFFER_SIZE - 7 - 3 - 2); ++zPayload)
+                {
+                    char* pLine = &Line[zOffset];
+                    size_t Pos = 0;
+                    uint8_t CRC = 0;
+                    memcpy(pLine, "$XXZZZ,", 7); Pos += 7;
+                    for (size_t z = 0; z < zPayload; ++z) pLine[Pos++] = (z % 5 == 4 ? ',' : (char)('A' + ((z * 7) % 26)));
+                    for (size_t z = 1; z < Pos; ++z) CRC ^= (uint8_t)pLine[z];
+                    snprintf(&pLine[Pos], 6, "*%02X\r\n", (unsigned)CRC);
+                    LastError = NMEA0183_ProcessLine(pLine, &FrameData);
+                    Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Checksum), error should be ERR__UNKNOWN_ELEMENT");
+                    snprintf(&pLine[Pos], 6, "*%02X\r\n", (unsigned)(CRC ^ 0x01));
+                    LastError = NMEA0183_ProcessLine(pLine, &FrameData);
+                    Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Bad checksum), error should be ERR__CRC_ERROR");
+                    pLine[Pos] = '\0';
+                    LastError = NMEA0183_ProcessLine(pLine, &FrameData);
+                    Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (No checksum), error should be ERR__CRC_ERROR");
+                }
+        }
+
+        TEST_METHOD(TestMethod_ProcessLineFusedScan)
+        {
+            NMEA0183_DecodedData FrameData;
+            NMEA0183_SentenceView View;
+            eERRORRESULT LastError = ERR_OK;
+            char Line[NMEA0183_FRAME_BUFFER_SIZE + 32 + 8];
+
+            //--- Test (Fields tokenized with the checksum at all alignments) ---
+            for (size_t zOffset = 0; zOffset < 32; ++zOffset)
+                for (size_t zPayload = 0; zPayload <= (NMEA0183_FRAME_BUFFER_SIZE - 7 - 3 - 2); ++zPayload)
+                {
+                    char* pLine = &Line[zOffset];
+                    size_t Pos = 0;
+                    uint8_t CRC = 0;
+                    memcpy(pLine, "$XXZZZ,", 7); Pos += 7;
+                    for (size_t z = 0; z < zPayload; ++z) pLine[Pos++] = (z % 3 == 2 ? ',' : (char)('A' + ((z * 7) % 26)));
+                    for (size_t z = 1; z < Pos; ++z) CRC ^= (uint8_t)pLine[z];
+                    snprintf(&pLine[Pos], 6, "*%02X,,", (unsigned)CRC); // ',' after the '*' are not fields
+                    LastError = Init_NMEA0183SentenceView(&View, pLine, Pos + 5);
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Fields tokenized), error should be ERR_OK");
+                    size_t FieldCount = 0;
+                    for (size_t z = 1; z < Pos; ++z)
+                        if (pLine[z] == ',') Assert::AreEqual((uint32_t)z, (uint32_t)View.FieldPos[FieldCount++], L"Test (Fields tokenized), FieldPos should be the position of the ','");
+                    Assert::AreEqual((uint32_t)FieldCount, (uint32_t)View.FieldCount, L"Test (Fields tokenized), FieldCount should be the count of ','");
+                    Assert::AreEqual((uint32_t)Pos, (uint32_t)View.FieldPos[FieldCount], L"Test (Fields tokenized), the last field should end at the '*'");
+                }
+
+            //--- Test (Checksum error before parse error) ---
+            LastError = NMEA0183_ProcessLine("$GPGGA*00\r\n", &FrameData);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Checksum error before parse error), error should be ERR__CRC_ERROR");
+            LastError = NMEA0183_ProcessLine("$GPGGA*56\r\n", &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test (No field), error should be ERR__PARSE_ERROR");
+
+            //--- Test (Line with '\0' terminal cut at each position, same errors as the line of a known length) ---
+            const char TEST_CUT_LINE[] = "$GPZDA,160012.71,11,03,2004,-1,00*7D\r\n";
+            for (size_t zLength = 0; zLength < sizeof(TEST_CUT_LINE); ++zLength)
+            {
+                char Cut[sizeof(TEST_CUT_LINE)];
+                memcpy(&Cut[0], &TEST_CUT_LINE[0], zLength);
+                Cut[zLength] = '\0';
+                const eERRORRESULT ErrorN = NMEA0183_ProcessLineN(&Cut[0], zLength, &FrameData);
+                LastError = NMEA0183_ProcessLine(&Cut[0], &FrameData);
+                Assert::AreEqual(ErrorN, LastError, L"Test (Line cut), error should be the one of NMEA0183_ProcessLineN()");
+            }
+            LastError = NMEA0183_ProcessLine(TEST_CUT_LINE, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Line not cut), error should be ERR_OK");
+
+            //--- Test (Fields parsed with the checksum) ---
+            const char* const TEST_FUSED_LINES[] =
+            {
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,",
+                "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W",
+                "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K",            // Older format of the VTG sentence
+                "$GPTXT,01,01,02,ANTSTATUS=OK,more",                 // ',' in the last text field
+                "$GPGGA,12x519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,", // Parse error in the first field
+                "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,,,,,", // Too many fields
+            };
+            for (size_t zLine = 0; zLine < (sizeof(TEST_FUSED_LINES) / sizeof(TEST_FUSED_LINES[0])); ++zLine)
+            {
+                NMEA0183_DecodedData ExpectedData;
+                uint8_t LineCRC = 0;
+                const size_t LineSize = strlen(TEST_FUSED_LINES[zLine]);
+                for (size_t z = 1; z < LineSize; ++z) LineCRC ^= (uint8_t)TEST_FUSED_LINES[zLine][z];
+                snprintf(&Line[0], sizeof(Line), "%s*%02X", TEST_FUSED_LINES[zLine], (unsigned)LineCRC);
+                memset(&ExpectedData, 0, sizeof(ExpectedData));
+                memset(&FrameData, 0, sizeof(FrameData));
+                const eERRORRESULT ExpectedError = NMEA0183_ProcessLineN(&Line[0], strlen(&Line[0]), &ExpectedData); // Checksum checked before the parse
+                LastError = NMEA0183_ProcessLine(&Line[0], &FrameData);
+                Assert::AreEqual(ExpectedError, LastError, L"Test (Fields parsed with the checksum), error should be the one of NMEA0183_ProcessLineN()");
+                Assert::AreEqual(0, memcmp(&ExpectedData, &FrameData, sizeof(FrameData)), L"Test (Fields parsed with the checksum), data should be the one of NMEA0183_ProcessLineN()");
+                Line[LineSize + 1] ^= 0x01;                          // Wrong checksum
+                LastError = NMEA0183_ProcessLine(&Line[0], &FrameData);
+                Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Fields parsed with the checksum), error should be ERR__CRC_ERROR");
+                Assert::IsFalse(FrameData.ParseIsValid, L"Test (Fields parsed with the checksum), ParseIsValid should be false");
+                Line[LineSize] = '\0';                               // No checksum
+                LastError = NMEA0183_ProcessLine(&Line[0], &FrameData);
+                Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Fields parsed with the checksum), error should be ERR__CRC_ERROR without '*'");
+            }
+
+            //--- Test ('\0' in the address field) ---
+            const char TEST_NULL_ADDRESS[] = "$GP\0GA,1*0C";
+            LastError = NMEA0183_ProcessLineN(TEST_NULL_ADDRESS, sizeof(TEST_NULL_ADDRESS) - 1, &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test ('\\0' in the address field), error should be ERR__PARSE_ERROR");
+        }
+
+#if defined(NMEA0183_COMPACT_OUTPUT) && defined(NMEA0183_DECODE_GGA) && defined(NMEA0183_DECODE_RMC)
+        TEST_METHOD(TestMethod_ProcessLineCompact)
+        {
+            NMEA0183_DecodedData FrameData;
+            uint64_t Buffer[256 / sizeof(uint64_t)];
+            eERRORRESULT LastError = ERR_OK;
+            size_t RecordSize = 0, Used = 0;
+
+            const char* const TEST_LINES[] =
+            {
+                "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n",
+                "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n",
+                "$XXZZZ,data,00*4A\r\n",
+            };
+            const eERRORRESULT TEST_ERRORS[] = { ERR_OK, ERR_OK, ERR__UNKNOWN_ELEMENT };
+
+            //--- Test (Batch of records) ---
+            for (size_t zLine = 0; zLine < (sizeof(TEST_LINES) / sizeof(TEST_LINES[0])); ++zLine)
+            {
+                LastError = NMEA0183_ProcessLineCompact(TEST_LINES[zLine], strlen(TEST_LINES[zLine]), (uint8_t*)&Buffer[0] + Used, sizeof(Buffer) - Used, &RecordSize);
+                Assert::AreEqual(TEST_ERRORS[zLine], LastError, L"Test (Batch of records), error should be the one of NMEA0183_ProcessLineN");
+                Assert::IsTrue(RecordSize > 0, L"Test (Batch of records), a record should be written");
+                Used += RecordSize;
+            }
+            Assert::IsTrue(Used < (2 * sizeof(NMEA0183_DecodedData)), L"Test (Batch of records), the records should be smaller than the decoded data");
+
+            //--- Test (Read the records) ---
+            NMEA0183_CompactHeader* pRecord = (NMEA0183_CompactHeader*)&Buffer[0];
+            (void)NMEA0183_ProcessLine(TEST_LINES[0], &FrameData);
+            Assert::AreEqual(NMEA0183_GGA, pRecord->SentenceID, L"Test (GGA record), SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual(NMEA0183_GP, pRecord->TalkerID, L"Test (GGA record), TalkerID should be NMEA0183_GP");
+            Assert::AreEqual((uint8_t)1, pRecord->ParseIsValid, L"Test (GGA record), ParseIsValid should be 1");
+            Assert::AreEqual((uint32_t)sizeof(NMEA0183_GGAdata), (uint32_t)pRecord->PayloadSize, L"Test (GGA record), PayloadSize should be the size of NMEA0183_GGAdata");
+            NMEA0183_GGAdata GGA;
+            memcpy(&GGA, NMEA0183_COMPACT_PAYLOAD(pRecord), sizeof(GGA));
+            Assert::AreEqual(FrameData.GGA.Time.Second, GGA.Time.Second, L"Test (GGA record), Time.Second should be the one of NMEA0183_ProcessLine");
+            Assert::AreEqual(FrameData.GGA.Longitude.Minute, GGA.Longitude.Minute, L"Test (GGA record), Longitude.Minute should be the one of NMEA0183_ProcessLine");
+            Assert::AreEqual(FrameData.GGA.SatellitesUsed, GGA.SatellitesUsed, L"Test (GGA record), SatellitesUsed should be the one of NMEA0183_ProcessLine");
+            Assert::AreEqual(FrameData.GGA.GeoidSeparation, GGA.GeoidSeparation, L"Test (GGA record), GeoidSeparation should be the one of NMEA0183_ProcessLine");
+            pRecord = NMEA0183_COMPACT_NEXT_RECORD(pRecord);
+            (void)NMEA0183_ProcessLine(TEST_LINES[1], &FrameData);
+            Assert::AreEqual(NMEA0183_RMC, pRecord->SentenceID, L"Test (RMC record), SentenceID should be NMEA0183_RMC");
+            NMEA0183_RMCdata RMC;
+            memcpy(&RMC, NMEA0183_COMPACT_PAYLOAD(pRecord), sizeof(RMC));
+            Assert::AreEqual(FrameData.RMC.Speed, RMC.Speed, L"Test (RMC record), Speed should be the one of NMEA0183_ProcessLine");
+            Assert::AreEqual(FrameData.RMC.Date.Year, RMC.Date.Year, L"Test (RMC record), Date.Year should be the one of NMEA0183_ProcessLine");
+            Assert::AreEqual(FrameData.RMC.NavigationStatus, RMC.NavigationStatus, L"Test (RMC record), NavigationStatus should be the one of NMEA0183_ProcessLine");
+            pRecord = NMEA0183_COMPACT_NEXT_RECORD(pRecord);
+            Assert::AreEqual(NMEA0183_UNKNOWN, pRecord->SentenceID, L"Test (Unknown record), SentenceID should be NMEA0183_UNKNOWN");
+            Assert::AreEqual((uint8_t)0, pRecord->ParseIsValid, L"Test (Unknown record), ParseIsValid should be 0");
+            Assert::AreEqual((uint32_t)(strlen(TEST_LINES[2]) - 2), (uint32_t)pRecord->PayloadSize, L"Test (Unknown record), PayloadSize should be the size of the frame without \\r\\n");
+            Assert::AreEqual(0, memcmp(NMEA0183_COMPACT_PAYLOAD(pRecord), TEST_LINES[2], pRecord->PayloadSize), L"Test (Unknown record), payload should be the raw frame");
+            Assert::AreEqual((uint32_t)Used, (uint32_t)((uint8_t*)NMEA0183_COMPACT_NEXT_RECORD(pRecord) - (uint8_t*)&Buffer[0]), L"Test (Read the records), the records should end at the size used");
+
+            //--- Test (Buffer full) ---
+            LastError = NMEA0183_ProcessLineCompact(TEST_LINES[0], strlen(TEST_LINES[0]), &Buffer[0], NMEA0183_COMPACT_RECORD_SIZE(sizeof(NMEA0183_GGAdata)) - 1, &RecordSize);
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (Buffer full), error should be ERR__BUFFER_FULL");
+            Assert::AreEqual(0u, (uint32_t)RecordSize, L"Test (Buffer full), RecordSize should be 0");
+
+            //--- Test (Bad checksum) ---
+            LastError = NMEA0183_ProcessLineCompact("$XXZZZ,data,00*4B\r\n", 19, &Buffer[0], sizeof(Buffer), &RecordSize);
+            Assert::AreEqual(ERR__CRC_ERROR, LastError, L"Test (Bad checksum), error should be ERR__CRC_ERROR");
+            Assert::AreEqual(0u, (uint32_t)RecordSize, L"Test (Bad checksum), RecordSize should be 0");
+        }
+#endif
+
+#if defined(NMEA0183_PARSE_ERROR_DIAGNOSTICS) && defined(NMEA0183_DECODE_GGA)
+        TEST_METHOD(TestMethod_ParseErrorDiagnostics)
+        {
+            NMEA0183_DecodedData FrameData;
+            NMEA0183_GGAdata GGA;
+            eERRORRESULT LastError = ERR_OK;
+
+            const char* const TEST_BAD_UNIT = "$GPGGA,001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,F,-21.3,M*52\r\n";
+
+            //--- Test (Sentence parser) ---
+            LastError = NMEA0183_ProcessGGA(&TEST_BAD_UNIT[7], &GGA);
+            Assert::AreEqual(ERR__PARSE_ERROR, ERR_ERROR_Get(LastError), L"Test (Sentence parser), error should be ERR__PARSE_ERROR");
+            Assert::AreEqual((uint32_t)54, (uint32_t)NMEA0183_PARSE_ERROR_OFFSET_Get(LastError), L"Test (Sentence parser), offset should be the 'F'");
+
+            //--- Test (Line decoder) ---
+            memset(&FrameData, 0, sizeof(FrameData));
+            LastError = NMEA0183_ProcessLine(TEST_BAD_UNIT, &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test (Line decoder), error should be ERR__PARSE_ERROR without context");
+            Assert::AreEqual(NMEA0183_GGA, FrameData.SentenceID, L"Test (Line decoder), SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual((uint8_t)9, FrameData.ParseErrorField, L"Test (Line decoder), ParseErrorField should be 9 (unit of the altitude)");
+            Assert::AreEqual((uint8_t)61, FrameData.ParseErrorOffset, L"Test (Line decoder), ParseErrorOffset should be the 'F'");
+            Assert::AreEqual('F', TEST_BAD_UNIT[FrameData.ParseErrorOffset], L"Test (Line decoder), char at ParseErrorOffset should be 'F'");
+
+            //--- Test (Parse error without position) ---
+            LastError = NMEA0183_ProcessLine("$GPGGA*56\r\n", &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test (No field), error should be ERR__PARSE_ERROR");
+            Assert::AreEqual((uint8_t)NMEA0183_NO_ERROR_POSITION, FrameData.ParseErrorField, L"Test (No field), ParseErrorField should be NMEA0183_NO_ERROR_POSITION");
+            Assert::AreEqual((uint8_t)NMEA0183_NO_ERROR_POSITION, FrameData.ParseErrorOffset, L"Test (No field), ParseErrorOffset should be NMEA0183_NO_ERROR_POSITION");
+        }
+#endif
+
+#if defined(NMEA0183_PRESENT_FIELDS) && defined(NMEA0183_DECODE_GGA)
+        TEST_METHOD(TestMethod_PresentFields)
+        {
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+
+            //--- Test (Empty optional field) ---
+            LastError = NMEA0183_ProcessLine("$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Empty optional field), error should be ERR_OK");
+            Assert::AreEqual(0x2FFFu, FrameData.PresentFields, L"Test (Empty optional field), PresentFields should be 0x2FFF");
+            Assert::IsFalse(NMEA0183_IS_FIELD_PRESENT(&FrameData, 12), L"Test (Empty optional field), the age of differential GPS data should not be present");
+            Assert::IsTrue(NMEA0183_IS_FIELD_PRESENT(&FrameData, 13), L"Test (Empty optional field), the differential reference station ID should be present");
+
+            //--- Test (Missing optional fields) ---
+            LastError = NMEA0183_ProcessLine("$GNGGA,001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,M,-21.3,M*47\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Missing optional fields), error should be ERR_OK");
+            Assert::AreEqual(0x0FFFu, FrameData.PresentFields, L"Test (Missing optional fields), PresentFields should be 0x0FFF");
+
+            //--- Test (Empty fields) ---
+            LastError = NMEA0183_ProcessLine("$GPGGA,,,,,,0,00,,,M,,M,,*66\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Empty fields), error should be ERR_OK");
+            Assert::AreEqual(0x0A60u, FrameData.PresentFields, L"Test (Empty fields), PresentFields should be 0x0A60");
+            const uint32_t POSITION_FIELDS = NMEA0183_FIELD_BIT(0) | NMEA0183_FIELD_BIT(1) | NMEA0183_FIELD_BIT(2) | NMEA0183_FIELD_BIT(3) | NMEA0183_FIELD_BIT(4);
+            Assert::IsFalse(NMEA0183_ARE_FIELDS_PRESENT(&FrameData, POSITION_FIELDS), L"Test (Empty fields), the position should not be present");
+
+#ifdef NMEA0183_COMPACT_OUTPUT
+            //--- Test (Compact record) ---
+            uint64_t Buffer[256 / sizeof(uint64_t)];
+            size_t RecordSize = 0;
+            const char* const TEST_EMPTY_GGA = "$GPGGA,,,,,,0,00,,,M,,M,,*66\r\n";
+            LastError = NMEA0183_ProcessLineCompact(TEST_EMPTY_GGA, strlen(TEST_EMPTY_GGA), &Buffer[0], sizeof(Buffer), &RecordSize);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Compact record), error should be ERR_OK");
+            Assert::AreEqual(0x0A60u, ((NMEA0183_CompactHeader*)&Buffer[0])->PresentFields, L"Test (Compact record), PresentFields should be 0x0A60");
+#endif
+
+            //--- Test (Schema) ---
+            struct POSdata { NMEA0183_Coordinate Position; char Status; uint32_t PresentFields; };
+            typedef NMEA0183::Schema::Sentence<POSdata, NMEA0183_SCHEMA_COORDINATE(POSdata, Position), NMEA0183_SCHEMA_CHAR_OR_SPACE(POSdata, Status)> POSschema;
+            POSdata Position;
+            Assert::AreEqual(ERR_OK, POSschema::Parse("4404.14036,N,A*00", &Position), L"Test (Schema), error should be ERR_OK");
+            Assert::AreEqual(0x7u, Position.PresentFields, L"Test (Schema), PresentFields should be 0x7");
+            Assert::AreEqual(ERR_OK, POSschema::Parse(",N,*00", &Position), L"Test (Schema empty fields), error should be ERR_OK");
+            Assert::AreEqual(0x2u, Position.PresentFields, L"Test (Schema empty fields), the direction only should be present");
+
+            //--- Test (Field 31 and more) ---
+            Assert::AreEqual(0x80000001u, NMEA0183_GetPresentFields("1,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,x*00"), L"Test (Field 31 and more), the fields 31 and more should share the bit 31");
+            Assert::AreEqual(0u, NMEA0183_GetPresentFields("*00"), L"Test (No field), PresentFields should be 0");
+        }
+#endif
+
+        TEST_METHOD(TestMethod_StringView)
+        {
+            NMEA0183_StringView View;
+            char String[8];
+            eERRORRESULT LastError = ERR_OK;
+
+            //--- Test (Code delimiters) ---
+            const char* const TEST_TEXT = "FAULT^21^5e*00";
+            View.pChars = TEST_TEXT; View.Size = 11;
+            LastError = NMEA0183_StringViewToString(&View, &String[0], sizeof(String));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Code delimiters), error should be ERR_OK");
+            Assert::AreEqual(0, strcmp("FAULT!^", String), L"Test (Code delimiters), String should be 'FAULT!^'");
+
+            //--- Test (String truncated) ---
+            LastError = NMEA0183_StringViewToString(&View, &String[0], 4);
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (String truncated), error should be ERR__BUFFER_FULL");
+            Assert::AreEqual(0, strcmp("FAU", String), L"Test (String truncated), String should be 'FAU'");
+
+            //--- Test (Bad code delimiter) ---
+            View.Size = 7;
+            LastError = NMEA0183_StringViewToString(&View, &String[0], sizeof(String));
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test (Bad code delimiter), error should be ERR__PARSE_ERROR");
+
+            //--- Test (Empty view) ---
+            View.Size = 0;
+            LastError = NMEA0183_StringViewToString(&View, &String[0], sizeof(String));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Empty view), error should be ERR_OK");
+            Assert::AreEqual(0, strcmp("", String), L"Test (Empty view), String should be empty");
+
+#if defined(NMEA0183_STRING_VIEWS) && defined(NMEA0183_DECODE_BOD)
+            //--- Test (Views in the line) ---
+            NMEA0183_DecodedData FrameData;
+            const char* const TEST_BOD_LINE = "$GPBOD,097.0,T,103.2,M,POINTB,POINTA*4A\r\n";
+            LastError = NMEA0183_ProcessLine(TEST_BOD_LINE, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Views in the line), error should be ERR_OK");
+            Assert::IsTrue(&TEST_BOD_LINE[23] == FrameData.BOD.DestWaypointID.pChars, L"Test (Views in the line), DestWaypointID should be in the line");
+            Assert::AreEqual((uint8_t)6u, FrameData.BOD.DestWaypointID.Size, L"Test (Views in the line), DestWaypointID.Size should be 6");
+            Assert::IsTrue(&TEST_BOD_LINE[30] == FrameData.BOD.OriginWaypointID.pChars, L"Test (Views in the line), OriginWaypointID should be in the line");
+            Assert::AreEqual((uint8_t)6u, FrameData.BOD.OriginWaypointID.Size, L"Test (Views in the line), OriginWaypointID.Size should be 6");
+#endif
+        }
+    };
+
+
+    //-----------------------------------------------------------------------------
+    #define FRAME_READY_CONTEXT_SIZE  6
+
+    struct FrameReadyContext
+    {
+        size_t Count;
+        eERRORRESULT Errors[FRAME_READY_CONTEXT_SIZE];
+        NMEA0183_DecodedData Data[FRAME_READY_CONTEXT_SIZE];
     };
 
+    static void FrameReadyCallback(NMEA0183_DecodeInput* pDecoder, void* pContext)
+    {
+        FrameReadyContext* pCtx = (FrameReadyContext*)pContext;
+        if (pCtx->Count < FRAME_READY_CONTEXT_SIZE) pCtx->Errors[pCtx->Count] = NMEA0183_ProcessFrame(pDecoder, &pCtx->Data[pCtx->Count]);
+        ++pCtx->Count;
+    }
+
+
+    TEST_CLASS(DecodeInputTest)
+    {
+    public:
+
+        TEST_METHOD(TestMethod_AddReceivedBuffer)
+        {
+            NMEA0183_DecodeInput BufferDecoder, CharDecoder;
+            NMEA0183_DecodedData FrameData;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+
+            const char* const TEST_STREAM = "garbage*12\r\n$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n$XXZZZ,data,00*4A\r\n$TestFrame*FF\r\n$GPGGA,092750.000,53";
+            const size_t TEST_STREAM_SIZE = strlen(TEST_STREAM);
+
+            //--- Test (Buffer split in chunks) ---
+            for (size_t ChunkSize = 1; ChunkSize <= TEST_STREAM_SIZE; ++ChunkSize)
+            {
+                (void)Init_NMEA0183(&BufferDecoder);
+                memset(&Context, 0, sizeof(Context));
+                for (size_t z = 0; z < TEST_STREAM_SIZE; z += ChunkSize)
+                {
+                    const size_t Size = ((TEST_STREAM_SIZE - z) < ChunkSize ? (TEST_STREAM_SIZE - z) : ChunkSize);
+                    LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, &TEST_STREAM[z], Size, FrameReadyCallback, &Context);
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Buffer split in chunks), error should be ERR_OK");
+                }
+                Assert::AreEqual(3u, (uint32_t)Context.Count, L"Test (Buffer split in chunks), Count should be 3");
+                Assert::AreEqual(ERR_OK, Context.Errors[0], L"Test (Buffer split in chunks), Errors[0] should be ERR_OK");
+                Assert::AreEqual(NMEA0183_RMC, Context.Data[0].SentenceID, L"Test (Buffer split in chunks), Data[0].SentenceID should be NMEA0183_RMC");
+                Assert::AreEqual(547000u, Context.Data[0].RMC.Track, L"Test (Buffer split in chunks), Data[0].RMC.Track should be 547000");
+                Assert::AreEqual(ERR__UNKNOWN_ELEMENT, Context.Errors[1], L"Test (Buffer split in chunks), Errors[1] should be ERR__UNKNOWN_ELEMENT");
+                Assert::AreEqual(ERR__CRC_ERROR, Context.Errors[2], L"Test (Buffer split in chunks), Errors[2] should be ERR__CRC_ERROR");
+                Assert::AreEqual(NMEA0183_ACCUMULATE, NMEA0183_GetDecoderState(&BufferDecoder), L"Test (Buffer split in chunks), state should be NMEA0183_ACCUMULATE");
+            }
+
+            //--- Test (Same result as character per character) ---
+            (void)Init_NMEA0183(&BufferDecoder);
+            (void)Init_NMEA0183(&CharDecoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, TEST_STREAM, TEST_STREAM_SIZE, FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Same result as character per character), error should be ERR_OK");
+            for (size_t z = 0; z < TEST_STREAM_SIZE; ++z)
+            {
+                (void)NMEA0183_AddReceivedCharacter(&CharDecoder, TEST_STREAM[z]);
+                if (NMEA0183_IsFrameReadyToProcess(&CharDecoder)) (void)NMEA0183_ProcessFrame(&CharDecoder, &FrameData);
+            }
+            Assert::AreEqual((uint32_t)NMEA0183_DECODER_INPUT(&CharDecoder)->BufferPos, (uint32_t)NMEA0183_DECODER_INPUT(&BufferDecoder)->BufferPos, L"Test (Same result as character per character), BufferPos should be the same");
+            Assert::AreEqual(NMEA0183_DECODER_INPUT(&CharDecoder)->CurrCalcCRC, NMEA0183_DECODER_INPUT(&BufferDecoder)->CurrCalcCRC, L"Test (Same result as character per character), CurrCalcCRC should be the same");
+            Assert::AreEqual(0, memcmp(&NMEA0183_DECODER_INPUT(&CharDecoder)->RawFrame[0], &NMEA0183_DECODER_INPUT(&BufferDecoder)->RawFrame[0], NMEA0183_DECODER_INPUT(&CharDecoder)->BufferPos), L"Test (Same result as character per character), RawFrame should be the same");
+            Assert::AreEqual(NMEA0183_DECODER_INPUT(&CharDecoder)->FieldCount, NMEA0183_DECODER_INPUT(&BufferDecoder)->FieldCount, L"Test (Same result as character per character), FieldCount should be the same");
+            Assert::AreEqual(0, memcmp(&NMEA0183_DECODER_INPUT(&CharDecoder)->FieldPos[0], &NMEA0183_DECODER_INPUT(&BufferDecoder)->FieldPos[0], NMEA0183_DECODER_INPUT(&CharDecoder)->FieldCount), L"Test (Same result as character per character), FieldPos should be the same");
+
+            //--- Test (Buffer full) ---
+            char LongFrame[NMEA0183_FRAME_BUFFER_SIZE + 10];
+            memset(&LongFrame[0], 'A', sizeof(LongFrame));
+            LongFrame[0] = '$';
+            (void)Init_NMEA0183(&BufferDecoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, &LongFrame[0], sizeof(LongFrame), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (Buffer full), error should be ERR__BUFFER_FULL");
+            Assert::AreEqual((uint32_t)NMEA0183_FRAME_BUFFER_SIZE, (uint32_t)NMEA0183_DECODER_INPUT(&BufferDecoder)->BufferPos, L"Test (Buffer full), BufferPos should be NMEA0183_FRAME_BUFFER_SIZE");
+            Assert::AreEqual(0u, (uint32_t)Context.Count, L"Test (Buffer full), Count should be 0");
+        }
+
+        TEST_METHOD(TestMethod_FieldIndex)
+        {
+            NMEA0183_DecodeInput Decoder;
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+
+            //--- Test (Field delimiters positions) ---
+            const char* const TEST_GGA_FRAME = "$GPGGA,092750.000,5321.6802,N,00630.3372,W,1,8,1.03,61.7,M,55.2,M,,*76\r\n";
+            (void)Init_NMEA0183(&Decoder);
+            for (size_t z = 0; z < strlen(TEST_GGA_FRAME); ++z) (void)NMEA0183_AddReceivedCharacter(&Decoder, TEST_GGA_FRAME[z]);
+            Assert::AreEqual((uint8_t)14, NMEA0183_DECODER_INPUT(&Decoder)->FieldCount, L"Test (Field delimiters positions), FieldCount should be 14");
+            Assert::AreEqual((uint8_t)6, NMEA0183_DECODER_INPUT(&Decoder)->FieldPos[0], L"Test (Field delimiters positions), FieldPos[0] should be 6");
+            Assert::AreEqual((uint8_t)17, NMEA0183_DECODER_INPUT(&Decoder)->FieldPos[1], L"Test (Field delimiters positions), FieldPos[1] should be 17");
+            for (size_t z = 0; z < NMEA0183_DECODER_INPUT(&Decoder)->FieldCount; ++z)
+                Assert::AreEqual(',', NMEA0183_DECODER_INPUT(&Decoder)->RawFrame[NMEA0183_DECODER_INPUT(&Decoder)->FieldPos[z]], L"Test (Field delimiters positions), each FieldPos should be on a ','");
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Field delimiters positions), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_GGA, FrameData.SentenceID, L"Test (Field delimiters positions), SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual((uint8_t)53, FrameData.GGA.Latitude.Degree, L"Test (Field delimiters positions), GGA.Latitude.Degree should be 53");
+
+            //--- Test (Field index reset on new frame) ---
+            const char* const TEST_NO_FIELD_FRAME = "$GPGGA*56\r\n";
+            for (size_t z = 0; z < strlen(TEST_NO_FIELD_FRAME); ++z) (void)NMEA0183_AddReceivedCharacter(&Decoder, TEST_NO_FIELD_FRAME[z]);
+            Assert::AreEqual((uint8_t)0, NMEA0183_DECODER_INPUT(&Decoder)->FieldCount, L"Test (Field index reset on new frame), FieldCount should be 0");
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, LastError, L"Test (Field index reset on new frame), error should be ERR__PARSE_ERROR");
+            Assert::AreEqual(false, FrameData.ParseIsValid, L"Test (Field index reset on new frame), ParseIsValid should be false");
+
+#ifdef NMEA0183_DECODE_VTG
+            //--- Test (Older format selected with the field index) ---
+            const char* const TEST_VTG_OLD_FRAME = "$GPVTG,054.7,034.4,005.5,010.2*54\r\n";
+            for (size_t z = 0; z < strlen(TEST_VTG_OLD_FRAME); ++z) (void)NMEA0183_AddReceivedCharacter(&Decoder, TEST_VTG_OLD_FRAME[z]);
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Older format selected with the field index), error should be ERR_OK");
+            Assert::AreEqual((uint32_t)344000u, FrameData.VTG.CourseMagnetic, L"Test (Older format selected with the field index), VTG.CourseMagnetic should be 344000");
+            Assert::AreEqual((uint32_t)102000u, FrameData.VTG.SpeedKmHr, L"Test (Older format selected with the field index), VTG.SpeedKmHr should be 102000");
+            Assert::AreEqual(' ', FrameData.VTG.FAAmode, L"Test (Older format selected with the field index), VTG.FAAmode should be ' '");
+
+            //--- Test (Format with missing fields) ---
+            LastError = NMEA0183_ProcessLine("$GPVTG,054.7,T,034.4,M,005.5*4C", &FrameData);
+            Assert::AreEqual(ERR__PARSE_ERROR, ERR_ERROR_Get(LastError), L"Test (Format with missing fields), error should be ERR__PARSE_ERROR");
+#endif
+        }
+
+#ifdef NMEA0183_SENTENCE_SUBSCRIPTION
+        TEST_METHOD(TestMethod_SentenceSubscription)
+        {
+            NMEA0183_DecodeInput BufferDecoder, CharDecoder;
+            NMEA0183_DecodedData FrameData;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+
+            const char* const TEST_STREAM = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n$GNGGA,001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,M,-21.3,M*47\r\n"
+                                            "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n$PUBX,00,081350.00*3E\r\n$XXZZZ,data,00*4A\r\n";
+            const size_t TEST_STREAM_SIZE = strlen(TEST_STREAM);
+
+            //--- Test (All sentences subscribed by default) ---
+            (void)Init_NMEA0183(&BufferDecoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, TEST_STREAM, TEST_STREAM_SIZE, FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (All sentences subscribed), error should be ERR_OK");
+            Assert::AreEqual(5u, (uint32_t)Context.Count, L"Test (All sentences subscribed), Count should be 5");
+
+            //--- Test (GGA of GP talker and other sentences) ---
+            (void)Init_NMEA0183(&BufferDecoder);
+            LastError = NMEA0183_SetSentenceSubscription(&BufferDecoder, NMEA0183_SUBSCRIBE(NMEA0183_GGA) | NMEA0183_SUBSCRIBE_OTHERS, NMEA0183_GP);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Subscription), error should be ERR_OK");
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, TEST_STREAM, TEST_STREAM_SIZE, FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Subscription), error should be ERR_OK");
+            Assert::AreEqual(2u, (uint32_t)Context.Count, L"Test (Subscription), Count should be 2");
+            Assert::AreEqual(NMEA0183_GGA, Context.Data[0].SentenceID, L"Test (Subscription), Data[0].SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual((uint16_t)NMEA0183_GP, (uint16_t)Context.Data[0].TalkerID, L"Test (Subscription), Data[0].TalkerID should be NMEA0183_GP");
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, Context.Errors[1], L"Test (Subscription), Errors[1] should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual(0, strncmp("$PUBX,", &Context.Data[1].Frame[0], 6), L"Test (Subscription), Data[1].Frame should be the PUBX frame");
+
+            //--- Test (Same result as character per character) ---
+            (void)Init_NMEA0183(&CharDecoder);
+            (void)NMEA0183_SetSentenceSubscription(&CharDecoder, NMEA0183_SUBSCRIBE(NMEA0183_GGA) | NMEA0183_SUBSCRIBE_OTHERS, NMEA0183_GP);
+            size_t FrameCount = 0;
+            for (size_t z = 0; z < TEST_STREAM_SIZE; ++z)
+            {
+                (void)NMEA0183_AddReceivedCharacter(&CharDecoder, TEST_STREAM[z]);
+                if (NMEA0183_IsFrameReadyToProcess(&CharDecoder))
+                {
+                    LastError = NMEA0183_ProcessFrame(&CharDecoder, &FrameData);
+                    Assert::AreEqual(Context.Errors[FrameCount], LastError, L"Test (Same result as character per character), error should be the same");
+                    Assert::AreEqual(Context.Data[FrameCount].SentenceID, FrameData.SentenceID, L"Test (Same result as character per character), SentenceID should be the same");
+                    ++FrameCount;
+                }
+            }
+            Assert::AreEqual(2u, (uint32_t)FrameCount, L"Test (Same result as character per character), FrameCount should be 2");
+
+            //--- Test (Proprietary sentence with a talker filter) ---
+            const char* const TEST_PROPRIETARY_STREAM = "$GNGGA,001043.00,4404.14036,N,12118.85961,W,1,12,0.98,1113.0,M,-21.3,M*47\r\n$PGRME,15.0,M,45.0,M,25.0,M*1C\r\n";
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, TEST_PROPRIETARY_STREAM, strlen(TEST_PROPRIETARY_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Proprietary sentence with a talker filter), error should be ERR_OK");
+            Assert::AreEqual(1u, (uint32_t)Context.Count, L"Test (Proprietary sentence with a talker filter), Count should be 1");
+            Assert::AreEqual(0, strncmp("$PGRME,", &Context.Data[0].Frame[0], 7), L"Test (Proprietary sentence with a talker filter), Data[0].Frame should be the PGRME frame");
+
+            //--- Test (Nothing subscribed) ---
+            (void)NMEA0183_SetSentenceSubscription(&BufferDecoder, 0, NMEA0183_ANY_TALKER);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&BufferDecoder, TEST_STREAM, TEST_STREAM_SIZE, FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Nothing subscribed), error should be ERR_OK");
+            Assert::AreEqual(0u, (uint32_t)Context.Count, L"Test (Nothing subscribed), Count should be 0");
+            Assert::AreEqual(NMEA0183_WAIT_START, NMEA0183_GetDecoderState(&BufferDecoder), L"Test (Nothing subscribed), state should be NMEA0183_WAIT_START");
+        }
+#endif
+
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+        TEST_METHOD(TestMethod_DifferentialDecoding)
+        {
+            NMEA0183_DecodeInput Decoder;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+
+            const char* const TEST_STREAM = "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n"
+                                            "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,11,1.2,27.0,M,-34.2,M,,0000*68\r\n";
+
+            (void)Init_NMEA0183(&Decoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_STREAM, strlen(TEST_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Differential decoding), error should be ERR_OK");
+            Assert::AreEqual(4u, (uint32_t)Context.Count, L"Test (Differential decoding), Count should be 4");
+
+            //--- Test (First frame of each address) ---
+            Assert::AreEqual(ERR_OK, Context.Errors[0], L"Test (First GGA), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_ALL_FIELDS_CHANGED, Context.Data[0].ChangedFields, L"Test (First GGA), ChangedFields should be NMEA0183_ALL_FIELDS_CHANGED");
+            Assert::AreEqual(NMEA0183_ALL_FIELDS_CHANGED, Context.Data[1].ChangedFields, L"Test (First RMC), ChangedFields should be NMEA0183_ALL_FIELDS_CHANGED");
+
+            //--- Test (Same frame) ---
+            Assert::AreEqual(ERR_OK, Context.Errors[2], L"Test (Same GGA), error should be ERR_OK");
+            Assert::AreEqual(0u, Context.Data[2].ChangedFields, L"Test (Same GGA), ChangedFields should be 0");
+            Assert::AreEqual(true, Context.Data[2].ParseIsValid, L"Test (Same GGA), ParseIsValid should be true");
+            Assert::AreEqual(NMEA0183_GGA, Context.Data[2].SentenceID, L"Test (Same GGA), SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual(0, memcmp(&Context.Data[0].GGA, &Context.Data[2].GGA, sizeof(NMEA0183_GGAdata)), L"Test (Same GGA), GGA should be the same as the first GGA");
+
+            //--- Test (Changed fields) ---
+            Assert::AreEqual(ERR_OK, Context.Errors[3], L"Test (Changed GGA), error should be ERR_OK");
+            Assert::AreEqual((1u << 0) | (1u << 6), Context.Data[3].ChangedFields, L"Test (Changed GGA), ChangedFields should be the time and the satellites used");
+            Assert::AreEqual((uint8_t)54, Context.Data[3].GGA.Time.Second, L"Test (Changed GGA), Time.Second should be 54");
+            Assert::AreEqual((uint8_t)11, Context.Data[3].GGA.SatellitesUsed, L"Test (Changed GGA), SatellitesUsed should be 11");
+
+            //--- Test (Removed field) ---
+            const char* const TEST_REMOVED_STREAM = "$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,11,1.2,27.0,M,-34.2,M,*44\r\n";
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_REMOVED_STREAM, strlen(TEST_REMOVED_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Removed field), error should be ERR_OK");
+            Assert::AreEqual(1u, (uint32_t)Context.Count, L"Test (Removed field), Count should be 1");
+            Assert::AreEqual((1u << 13), Context.Data[0].ChangedFields, L"Test (Removed field), ChangedFields should be the differential reference station ID");
+
+#if defined(NMEA0183_STRING_VIEWS) && defined(NMEA0183_DECODE_BOD)
+            //--- Test (Views of the same frame) ---
+            const char* const TEST_BOD_STREAM = "$GPBOD,097.0,T,103.2,M,POINTB,POINTA*4A\r\n$GPBOD,097.0,T,103.2,M,POINTB,POINTA*4A\r\n"
+                                                "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_BOD_STREAM, strlen(TEST_BOD_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Views of the same frame), error should be ERR_OK");
+            Assert::AreEqual(0u, Context.Data[1].ChangedFields, L"Test (Views of the same frame), ChangedFields should be 0");
+            Assert::AreEqual((uint8_t)6u, Context.Data[1].BOD.DestWaypointID.Size, L"Test (Views of the same frame), DestWaypointID.Size should be 6");
+            Assert::AreEqual(0, strncmp("POINTB", Context.Data[1].BOD.DestWaypointID.pChars, 6), L"Test (Views of the same frame), DestWaypointID should still be 'POINTB' after the next frame");
+            Assert::AreEqual(0, strncmp("POINTA", Context.Data[1].BOD.OriginWaypointID.pChars, 6), L"Test (Views of the same frame), OriginWaypointID should still be 'POINTA' after the next frame");
+#endif
+        }
+#endif
+
+#if defined(NMEA0183_DIFFERENTIAL_DECODING) && defined(NMEA0183_DECODE_GGA) && defined(NMEA0183_DECODE_TXT) && defined(NMEA0183_DECODE_ZDA)
+        TEST_METHOD(TestMethod_DifferentialChangedFieldsOnly)
+        {
+            NMEA0183_DecodeInput Decoder;
+            NMEA0183_DecodedData Expected;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+
+            const char* const TEST_ZDA = "$GPZDA,160013.71,11,03,2004,-0,30*7E\r\n";
+            const char* const TEST_TXT = "$GPTXT,02,01,02,ANTENNA OK*35\r\n";
+            const char* const TEST_GGA = "$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,10,1.3,27.0,M,-34.2,M,,0000*68\r\n";
+            const char* const TEST_STREAM = "$GPZDA,160012.71,11,03,2004,-1,30*7E\r\n$GPZDA,160013.71,11,03,2004,-0,30*7E\r\n"
+                                            "$GPTXT,01,01,02,ANTENNA OK*36\r\n$GPTXT,02,01,02,ANTENNA OK*35\r\n"
+                                            "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,9,1.2,27.0,M,-34.2,M,,0000*56\r\n$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,10,1.3,27.0,M,-34.2,M,,0000*68\r\n";
+
+            (void)Init_NMEA0183(&Decoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_STREAM, strlen(TEST_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Changed fields only), error should be ERR_OK");
+            Assert::AreEqual(6u, (uint32_t)Context.Count, L"Test (Changed fields only), Count should be 6");
+
+            //--- Test (Field that reads another field) ---
+            Assert::AreEqual(ERR_OK, NMEA0183_ProcessLine(TEST_ZDA, &Expected), L"Test (ZDA full parse), error should be ERR_OK");
+            Assert::AreEqual(ERR_OK, Context.Errors[1], L"Test (ZDA), error should be ERR_OK");
+            Assert::AreEqual((1u << 0) | (1u << 4), Context.Data[1].ChangedFields, L"Test (ZDA), ChangedFields should be the time and the local zone hour");
+            Assert::AreEqual(Expected.ZDA.Time.Second, Context.Data[1].ZDA.Time.Second, L"Test (ZDA), Time.Second should be the same as a full parse");
+            Assert::AreEqual(Expected.ZDA.LocalZoneHour, Context.Data[1].ZDA.LocalZoneHour, L"Test (ZDA), LocalZoneHour should be the same as a full parse");
+            Assert::AreEqual((int8_t)-30, Context.Data[1].ZDA.LocalZoneMinute, L"Test (ZDA), LocalZoneMinute should be -30 as a full parse");
+
+            //--- Test (Field that overwrites another field) ---
+            Assert::AreEqual(ERR_OK, NMEA0183_ProcessLine(TEST_TXT, &Expected), L"Test (TXT full parse), error should be ERR_OK");
+            Assert::AreEqual(ERR_OK, Context.Errors[3], L"Test (TXT), error should be ERR_OK");
+            Assert::AreEqual((1u << 0), Context.Data[3].ChangedFields, L"Test (TXT), ChangedFields should be the total of sentences");
+            Assert::AreEqual(Expected.TXT.TotalSentence, Context.Data[3].TXT.TotalSentence, L"Test (TXT), TotalSentence should be the same as a full parse");
+#ifndef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strcmp(Expected.TXT.TextMessage, Context.Data[3].TXT.TextMessage), L"Test (TXT), TextMessage should be the same as a full parse");
+#endif
+
+            //--- Test (Field of another size) ---
+            Assert::AreEqual(ERR_OK, NMEA0183_ProcessLine(TEST_GGA, &Expected), L"Test (GGA full parse), error should be ERR_OK");
+            Assert::AreEqual(ERR_OK, Context.Errors[5], L"Test (GGA), error should be ERR_OK");
+            Assert::AreEqual((1u << 0) | (1u << 6) | (1u << 7), Context.Data[5].ChangedFields, L"Test (GGA), ChangedFields should be the time, the satellites used and the HDOP");
+            Assert::AreEqual(Expected.GGA.Time.Second, Context.Data[5].GGA.Time.Second, L"Test (GGA), Time.Second should be the same as a full parse");
+            Assert::AreEqual(Expected.GGA.SatellitesUsed, Context.Data[5].GGA.SatellitesUsed, L"Test (GGA), SatellitesUsed should be the same as a full parse");
+            Assert::AreEqual(Expected.GGA.HDOP, Context.Data[5].GGA.HDOP, L"Test (GGA), HDOP should be the same as a full parse");
+            Assert::AreEqual(Expected.GGA.Altitude, Context.Data[5].GGA.Altitude, L"Test (GGA), Altitude should be the same as a full parse");
+            Assert::AreEqual(Expected.GGA.DiffRefStationID, Context.Data[5].GGA.DiffRefStationID, L"Test (GGA), DiffRefStationID should be the same as a full parse");
+#ifdef NMEA0183_PRESENT_FIELDS
+            Assert::AreEqual(Expected.PresentFields, Context.Data[5].PresentFields, L"Test (GGA), PresentFields should be the same as a full parse");
+#endif
+
+#if defined(NMEA0183_STRING_VIEWS) && defined(NMEA0183_DECODE_BOD)
+            //--- Test (Views of the fields moved) ---
+            const char* const TEST_BOD_STREAM = "$GPBOD,097.0,T,103.2,M,POINTB,POINTA*4A\r\n$GPBOD,97.0,T,103.2,M,POINTB,POINTA*7A\r\n";
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_BOD_STREAM, strlen(TEST_BOD_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Views of the fields moved), error should be ERR_OK");
+            Assert::AreEqual((1u << 0), Context.Data[1].ChangedFields, L"Test (Views of the fields moved), ChangedFields should be the true bearing");
+            Assert::AreEqual((uint8_t)6u, Context.Data[1].BOD.DestWaypointID.Size, L"Test (Views of the fields moved), DestWaypointID.Size should be 6");
+            Assert::AreEqual(0, strncmp("POINTB", Context.Data[1].BOD.DestWaypointID.pChars, 6), L"Test (Views of the fields moved), DestWaypointID should be 'POINTB'");
+            Assert::AreEqual(0, strncmp("POINTA", Context.Data[1].BOD.OriginWaypointID.pChars, 6), L"Test (Views of the fields moved), OriginWaypointID should be 'POINTA'");
+#endif
+        }
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+        TEST_METHOD(TestMethod_FrameCache)
+        {
+            NMEA0183_DecodeInput Decoder;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+            uint32_t Hits = 0, Misses = 0;
+
+            const char* const TEST_STREAM = "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,11,1.2,27.0,M,-34.2,M,,0000*68\r\n"
+                                            "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,11,1.2,27.0,M,-34.2,M,,0000*68\r\n"
+                                            "$XXZZZ,data,00*4A\r\n$XXZZZ,data,00*4A\r\n";
+
+            (void)Init_NMEA0183(&Decoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_STREAM, strlen(TEST_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Frame cache), error should be ERR_OK");
+            Assert::AreEqual(6u, (uint32_t)Context.Count, L"Test (Frame cache), Count should be 6");
+
+            //--- Test (Frames already decoded) ---
+            Assert::AreEqual(ERR_OK, Context.Errors[2], L"Test (First GGA again), error should be ERR_OK");
+            Assert::AreEqual(0, memcmp(&Context.Data[0].GGA, &Context.Data[2].GGA, sizeof(NMEA0183_GGAdata)), L"Test (First GGA again), GGA should be the same as the first GGA");
+            Assert::AreEqual(ERR_OK, Context.Errors[3], L"Test (Second GGA again), error should be ERR_OK");
+            Assert::AreEqual(0, memcmp(&Context.Data[1].GGA, &Context.Data[3].GGA, sizeof(NMEA0183_GGAdata)), L"Test (Second GGA again), GGA should be the same as the second GGA");
+            Assert::AreEqual((uint8_t)54, Context.Data[3].GGA.Time.Second, L"Test (Second GGA again), Time.Second should be 54");
+
+            //--- Test (Unknown sentences are not kept) ---
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, Context.Errors[4], L"Test (Unknown sentence), error should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, Context.Errors[5], L"Test (Unknown sentence again), error should be ERR__UNKNOWN_ELEMENT");
+
+            //--- Test (Statistics) ---
+            LastError = NMEA0183_GetFrameCacheStatistics(&Decoder, &Hits, &Misses);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Statistics), error should be ERR_OK");
+            Assert::AreEqual(2u, Hits, L"Test (Statistics), Hits should be 2");
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+            Assert::AreEqual(3u, Misses, L"Test (Statistics), Misses should be 3"); // The same unknown frame twice in a row is not decoded again
+#else
+            Assert::AreEqual(4u, Misses, L"Test (Statistics), Misses should be 4");
+#endif
+        }
+#endif
+
+        TEST_METHOD(TestMethod_Resynchronization)
+        {
+            NMEA0183_DecodeInput Decoder;
+            NMEA0183_DecodedData FrameData;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+            uint32_t ResyncCount = 0;
+
+            //--- Test (Lost end delimiter with a complete checksum, buffer split in chunks) ---
+            const char* const TEST_CUT_STREAM = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n";
+            const size_t TEST_CUT_STREAM_SIZE = strlen(TEST_CUT_STREAM);
+            for (size_t ChunkSize = 1; ChunkSize <= TEST_CUT_STREAM_SIZE; ++ChunkSize)
+            {
+                (void)Init_NMEA0183(&Decoder);
+                memset(&Context, 0, sizeof(Context));
+                for (size_t z = 0; z < TEST_CUT_STREAM_SIZE; z += ChunkSize)
+                {
+                    const size_t Size = ((TEST_CUT_STREAM_SIZE - z) < ChunkSize ? (TEST_CUT_STREAM_SIZE - z) : ChunkSize);
+                    LastError = NMEA0183_AddReceivedBuffer(&Decoder, &TEST_CUT_STREAM[z], Size, FrameReadyCallback, &Context);
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Lost end delimiter), error should be ERR_OK");
+                }
+                Assert::AreEqual(2u, (uint32_t)Context.Count, L"Test (Lost end delimiter), Count should be 2");
+                Assert::AreEqual(ERR_OK, Context.Errors[0], L"Test (Lost end delimiter), Errors[0] should be ERR_OK");
+                Assert::AreEqual(NMEA0183_RMC, Context.Data[0].SentenceID, L"Test (Lost end delimiter), Data[0].SentenceID should be NMEA0183_RMC");
+                Assert::AreEqual(ERR_OK, Context.Errors[1], L"Test (Lost end delimiter), Errors[1] should be ERR_OK");
+                Assert::AreEqual(NMEA0183_GGA, Context.Data[1].SentenceID, L"Test (Lost end delimiter), Data[1].SentenceID should be NMEA0183_GGA");
+                LastError = NMEA0183_GetResyncCount(&Decoder, &ResyncCount);
+                Assert::AreEqual(ERR_OK, LastError, L"Test (Lost end delimiter), error should be ERR_OK");
+                Assert::AreEqual(1u, ResyncCount, L"Test (Lost end delimiter), ResyncCount should be 1");
+            }
+
+            //--- Test (Truncated frame followed by an encapsulation sentence) ---
+            const char* const TEST_ENCAPSULATION_STREAM = "$GPGGA,002153.000,3342!AIVDM,1,1,,A,13aEOK?P00PD2wVMdLDRhgvL289?,0*26\r\n$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+            (void)Init_NMEA0183(&Decoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, TEST_ENCAPSULATION_STREAM, strlen(TEST_ENCAPSULATION_STREAM), FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Encapsulation sentence), error should be ERR_OK");
+            Assert::AreEqual(1u, (uint32_t)Context.Count, L"Test (Encapsulation sentence), Count should be 1");
+            Assert::AreEqual(ERR_OK, Context.Errors[0], L"Test (Encapsulation sentence), Errors[0] should be ERR_OK");
+            Assert::AreEqual(NMEA0183_RMC, Context.Data[0].SentenceID, L"Test (Encapsulation sentence), Data[0].SentenceID should be NMEA0183_RMC");
+            (void)NMEA0183_GetResyncCount(&Decoder, &ResyncCount);
+            Assert::AreEqual(1u, ResyncCount, L"Test (Encapsulation sentence), ResyncCount should be 1");
+
+            //--- Test (Frame too long followed by a frame without end delimiter, character per character) ---
+            const char* const TEST_RMC_FRAME = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+            (void)Init_NMEA0183(&Decoder);
+            LastError = NMEA0183_AddReceivedCharacter(&Decoder, '$');
+            for (size_t z = 0; z < (NMEA0183_FRAME_BUFFER_SIZE + 10); ++z) LastError = NMEA0183_AddReceivedCharacter(&Decoder, 'A');
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (Frame too long), error should be ERR__BUFFER_FULL");
+            for (size_t z = 0; z < strlen(TEST_RMC_FRAME); ++z)
+            {
+                LastError = NMEA0183_AddReceivedCharacter(&Decoder, TEST_RMC_FRAME[z]);
+                Assert::AreEqual(ERR_OK, LastError, L"Test (Frame too long), error should be ERR_OK");
+            }
+            Assert::AreEqual(true, NMEA0183_IsFrameReadyToProcess(&Decoder), L"Test (Frame too long), IsFrameReadyToProcess should be true");
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Frame too long), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_RMC, FrameData.SentenceID, L"Test (Frame too long), SentenceID should be NMEA0183_RMC");
+            (void)NMEA0183_GetResyncCount(&Decoder, &ResyncCount);
+            Assert::AreEqual(1u, ResyncCount, L"Test (Frame too long), ResyncCount should be 1");
+
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+            //--- Test (Lost end delimiter with a complete checksum, frame queue) ---
+            NMEA0183queueDecoder NMEA;
+            for (size_t z = 0; z < TEST_CUT_STREAM_SIZE; ++z) (void)NMEA.AddReceivedCharacter(TEST_CUT_STREAM[z]);
+            Assert::AreEqual(2u, (uint32_t)NMEA.GetFrameCount(), L"Test (Frame queue), GetFrameCount should be 2");
+            LastError = NMEA.ProcessFrame(&FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Frame queue), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_RMC, FrameData.SentenceID, L"Test (Frame queue), SentenceID should be NMEA0183_RMC");
+            (void)NMEA.GetResyncCount(&ResyncCount);
+            Assert::AreEqual(1u, ResyncCount, L"Test (Frame queue), ResyncCount should be 1");
+#endif
+        }
+
+        TEST_METHOD(TestMethod_FrameBufferSize)
+        {
+            NMEA0183_DecodeInput Decoder;
+            FrameReadyContext Context;
+            eERRORRESULT LastError = ERR_OK;
+            char Frame[NMEA0183_FRAME_BUFFER_SIZE + 1 + 2];
+
+            //--- Test (Longest frame) ---
+            size_t Pos = 0;                                             // Proprietary frame of NMEA0183_FRAME_BUFFER_SIZE chars, from the '$' to the checksum
+            uint8_t CRC = 0;
+            Frame[Pos++] = '$';
+            while (Pos < (NMEA0183_FRAME_BUFFER_SIZE - 3)) { Frame[Pos] = (Pos < 6 ? 'P' : ((Pos % 8) == 0 ? ',' : 'A')); CRC ^= (uint8_t)Frame[Pos]; ++Pos; }
+            Frame[Pos++] = '*';
+            Frame[Pos++] = "0123456789ABCDEF"[CRC >> 4];
+            Frame[Pos++] = "0123456789ABCDEF"[CRC & 0xF];
+            Frame[Pos++] = '\r';
+            Frame[Pos++] = '\n';
+            (void)Init_NMEA0183(&Decoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, &Frame[0], Pos, FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Longest frame), error should be ERR_OK");
+            Assert::AreEqual(1u, (uint32_t)Context.Count, L"Test (Longest frame), Count should be 1");
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, Context.Errors[0], L"Test (Longest frame), Errors[0] should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual(0, memcmp(&Frame[0], &Context.Data[0].Frame[0], NMEA0183_DECODED_FRAME_SIZE), L"Test (Longest frame), Frame should be the first chars of the frame");
+
+            //--- Test (Frame one char too long) ---
+            memmove(&Frame[2], &Frame[1], Pos - 1);                    // The checksum is not checked before the end of the frame
+            (void)Init_NMEA0183(&Decoder);
+            memset(&Context, 0, sizeof(Context));
+            LastError = NMEA0183_AddReceivedBuffer(&Decoder, &Frame[0], Pos + 1, FrameReadyCallback, &Context);
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (Frame one char too long), error should be ERR__BUFFER_FULL");
+        }
+
+#ifdef NMEA0183_RECEIVE_TIMESTAMPS
+        static NMEA0183_Timestamp TestClock(void* pContext)
+        {
+            NMEA0183_Timestamp* pTime = (NMEA0183_Timestamp*)pContext;
+            return ++(*pTime);                                          // Each read of the clock is one tick later
+        }
+
+        TEST_METHOD(TestMethod_ReceiveTimestamps)
+        {
+            NMEA0183_DecodeInput Decoder;
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+            NMEA0183_Timestamp Time = 0;
+
+            const char* const TEST_RMC_FRAME = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+
+            //--- Test (No clock) ---
+            (void)Init_NMEA0183(&Decoder);
+            for (size_t z = 0; z < strlen(TEST_RMC_FRAME); ++z) (void)NMEA0183_AddReceivedCharacter(&Decoder, TEST_RMC_FRAME[z]);
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (No clock), error should be ERR_OK");
+            Assert::AreEqual((NMEA0183_Timestamp)0, FrameData.StartTimestamp, L"Test (No clock), StartTimestamp should be 0");
+            Assert::AreEqual((NMEA0183_Timestamp)0, FrameData.EndTimestamp, L"Test (No clock), EndTimestamp should be 0");
+
+            //--- Test (Clock read on the start and end delimiters) ---
+            LastError = NMEA0183_SetReceiveClock(&Decoder, TestClock, &Time);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Clock), error should be ERR_OK");
+            for (size_t z = 0; z < strlen(TEST_RMC_FRAME); ++z) (void)NMEA0183_AddReceivedCharacter(&Decoder, TEST_RMC_FRAME[z]);
+            Assert::AreEqual((NMEA0183_Timestamp)2, Time, L"Test (Clock), the clock should be read twice");
+            Time = 100;                                                 // The main loop processes the frame later
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Clock), error should be ERR_OK");
+            Assert::AreEqual((NMEA0183_Timestamp)1, FrameData.StartTimestamp, L"Test (Clock), StartTimestamp should be 1");
+            Assert::AreEqual((NMEA0183_Timestamp)2, FrameData.EndTimestamp, L"Test (Clock), EndTimestamp should be 2");
+
+            //--- Test (Same frame again, the data can be kept from the previous frame) ---
+            for (size_t z = 0; z < strlen(TEST_RMC_FRAME); ++z) (void)NMEA0183_AddReceivedCharacter(&Decoder, TEST_RMC_FRAME[z]);
+            LastError = NMEA0183_ProcessFrame(&Decoder, &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Same frame again), error should be ERR_OK");
+            Assert::AreEqual((NMEA0183_Timestamp)101, FrameData.StartTimestamp, L"Test (Same frame again), StartTimestamp should be 101");
+            Assert::AreEqual((NMEA0183_Timestamp)102, FrameData.EndTimestamp, L"Test (Same frame again), EndTimestamp should be 102");
+
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+            //--- Test (Frame queue) ---
+            NMEA0183queueDecoder NMEA;
+            Time = 0;
+            LastError = NMEA.SetReceiveClock(TestClock, &Time);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Frame queue), error should be ERR_OK");
+            for (size_t zFrame = 0; zFrame < 2; ++zFrame)
+                for (size_t z = 0; z < strlen(TEST_RMC_FRAME); ++z) (void)NMEA.AddReceivedCharacter(TEST_RMC_FRAME[z]);
+            for (size_t zFrame = 0; zFrame < 2; ++zFrame)
+            {
+                LastError = NMEA.ProcessFrame(&FrameData);
+                Assert::AreEqual(ERR_OK, LastError, L"Test (Frame queue), error should be ERR_OK");
+                Assert::AreEqual((NMEA0183_Timestamp)(2 * zFrame + 1), FrameData.StartTimestamp, L"Test (Frame queue), StartTimestamp should be the one of the frame");
+                Assert::AreEqual((NMEA0183_Timestamp)(2 * zFrame + 2), FrameData.EndTimestamp, L"Test (Frame queue), EndTimestamp should be the one of the frame");
+            }
+#endif
+        }
+#endif
+
+#ifdef NMEA0183_FRAME_QUEUE_DEPTH
+        TEST_METHOD(TestMethod_FrameQueue)
+        {
+            NMEA0183queueDecoder NMEA;
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+
+            const char* const TEST_RMC_FRAME = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n";
+            const char* const TEST_UNKNOWN_FRAME = "$XXZZZ,data,00*4A\r\n";
+
+            //--- Test (Queue create) ---
+            Assert::AreEqual(false, NMEA.IsFrameReadyToProcess(), L"Test (Queue create), IsFrameReadyToProcess should be false");
+            LastError = NMEA.ProcessFrame(&FrameData);
+            Assert::AreEqual(ERR__NO_DATA_AVAILABLE, LastError, L"Test (Queue create), error should be ERR__NO_DATA_AVAILABLE");
+
+            //--- Test (Fill the queue without processing) ---
+            for (size_t zFrame = 0; zFrame < (NMEA0183_FRAME_QUEUE_DEPTH - 1); ++zFrame)
+            {
+                const char* pFrame = ((zFrame & 1) == 0 ? TEST_RMC_FRAME : TEST_UNKNOWN_FRAME);
+                for (size_t z = 0; z < strlen(pFrame); ++z)
+                {
+                    LastError = NMEA.AddReceivedCharacter(pFrame[z]);
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Fill the queue without processing), error should be ERR_OK");
+                }
+                Assert::AreEqual((uint32_t)(zFrame + 1), (uint32_t)NMEA.GetFrameCount(), L"Test (Fill the queue without processing), GetFrameCount should be the count of frames added");
+            }
+
+            //--- Test (Frame received while the queue is full) ---
+            for (size_t z = 0; z < strlen(TEST_UNKNOWN_FRAME); ++z) (void)NMEA.AddReceivedCharacter(TEST_UNKNOWN_FRAME[z]);
+            Assert::AreEqual((uint32_t)(NMEA0183_FRAME_QUEUE_DEPTH - 1), (uint32_t)NMEA.GetFrameCount(), L"Test (Frame received while the queue is full), GetFrameCount should be NMEA0183_FRAME_QUEUE_DEPTH-1");
+            LastError = NMEA.ProcessFrame(&FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Frame received while the queue is full), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_RMC, FrameData.SentenceID, L"Test (Frame received while the queue is full), SentenceID should be NMEA0183_RMC");
+            LastError = NMEA.AddReceivedCharacter('$');                 // The pending frame is published before the new one starts
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Frame received while the queue is full), error should be ERR_OK");
+            Assert::AreEqual((uint32_t)(NMEA0183_FRAME_QUEUE_DEPTH - 1), (uint32_t)NMEA.GetFrameCount(), L"Test (Frame received while the queue is full), GetFrameCount should be NMEA0183_FRAME_QUEUE_DEPTH-1");
+
+            //--- Test (Drain the queue in order) ---
+            for (size_t zFrame = 1; zFrame < NMEA0183_FRAME_QUEUE_DEPTH; ++zFrame)
+            {
+                LastError = NMEA.ProcessFrame(&FrameData);
+                if ((zFrame & 1) == 0)
+                {
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Drain the queue in order), error should be ERR_OK");
+                    Assert::AreEqual(NMEA0183_RMC, FrameData.SentenceID, L"Test (Drain the queue in order), SentenceID should be NMEA0183_RMC");
+                }
+                else Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Drain the queue in order), error should be ERR__UNKNOWN_ELEMENT");
+            }
+            Assert::AreEqual(false, NMEA.IsFrameReadyToProcess(), L"Test (Drain the queue in order), IsFrameReadyToProcess should be false");
+
+            //--- Test (Frame lost when the queue stays full) ---
+            for (size_t zFrame = 0; zFrame < NMEA0183_FRAME_QUEUE_DEPTH; ++zFrame)
+                for (size_t z = 0; z < strlen(TEST_UNKNOWN_FRAME); ++z) (void)NMEA.AddReceivedCharacter(TEST_UNKNOWN_FRAME[z]);
+            LastError = NMEA.AddReceivedCharacter('$');
+            Assert::AreEqual(ERR__BUFFER_OVERRIDE, LastError, L"Test (Frame lost when the queue stays full), error should be ERR__BUFFER_OVERRIDE");
+
+#ifdef NMEA0183_DIFFERENTIAL_DECODING
+            //--- Test (Previous frames shared by the slots) ---
+            NMEA0183queueDecoder HistoryQueue;
+            for (size_t zFrame = 0; zFrame < 2; ++zFrame)                  // The same frame in two different slots
+                for (size_t z = 0; z < strlen(TEST_RMC_FRAME); ++z) (void)HistoryQueue.AddReceivedCharacter(TEST_RMC_FRAME[z]);
+            LastError = HistoryQueue.ProcessFrame(&FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Previous frames shared by the slots), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_ALL_FIELDS_CHANGED, FrameData.ChangedFields, L"Test (Previous frames shared by the slots), ChangedFields should be NMEA0183_ALL_FIELDS_CHANGED");
+            LastError = HistoryQueue.ProcessFrame(&FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Previous frames shared by the slots), error should be ERR_OK");
+            Assert::AreEqual(0u, FrameData.ChangedFields, L"Test (Previous frames shared by the slots), ChangedFields should be 0");
+#endif
+
+#ifdef NMEA0183_FRAME_CACHE_SIZE
+            //--- Test (Cache shared by the slots) ---
+            const char* const TEST_GGA_FRAMES[] = { "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n",
+                                                    "$GPGGA,002154.000,3342.6618,N,01115.73858,W,1,11,1.2,27.0,M,-34.2,M,,0000*68\r\n",
+                                                    "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n" };
+            NMEA0183queueDecoder CacheQueue;
+            uint32_t Hits = 0, Misses = 0;
+            for (size_t zFrame = 0; zFrame < 3; ++zFrame)                  // Each frame in its own slot
+            {
+                for (size_t z = 0; z < strlen(TEST_GGA_FRAMES[zFrame]); ++z) (void)CacheQueue.AddReceivedCharacter(TEST_GGA_FRAMES[zFrame][z]);
+                LastError = CacheQueue.ProcessFrame(&FrameData);
+                Assert::AreEqual(ERR_OK, LastError, L"Test (Cache shared by the slots), error should be ERR_OK");
+            }
+            LastError = CacheQueue.GetFrameCacheStatistics(&Hits, &Misses);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Cache shared by the slots), error should be ERR_OK");
+            Assert::AreEqual(1u, Hits, L"Test (Cache shared by the slots), Hits should be 1");
+            Assert::AreEqual(2u, Misses, L"Test (Cache shared by the slots), Misses should be 2");
+            Assert::AreEqual((uint8_t)10, FrameData.GGA.SatellitesUsed, L"Test (Cache shared by the slots), SatellitesUsed should be 10");
+#endif
+        }
+#endif
+    };
+
+
+#ifdef NMEA0183_RING_FRAMER
+    TEST_CLASS(RingFramerTest)
+    {
+    public:
+
+        TEST_METHOD(TestMethod_RingFramer)
+        {
+            char Ring[NMEA0183_FRAME_BUFFER_SIZE + 2 + 37];             // The frames wrap around the end of the ring at different positions
+            NMEA0183_RingFramer Framer;
+            NMEA0183_RingSpan Span;
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+            uint32_t ResyncCount = 0;
+
+            const char* const TEST_STREAM = "$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\ngarbage*12\r\n$XXZZZ,data,00*4A\r\n"
+                                            "$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E,A,S*7A\r\n"
+                                            "$GPGGA,002153.000,3342!AIVDM,1,1,,A,13aEOK?P00PD2wVMdLDRhgvL289?,0*26\r\n";
+            const size_t TEST_STREAM_SIZE = strlen(TEST_STREAM);
+            const eERRORRESULT EXPECTED_ERRORS[4] = { ERR_OK, ERR__UNKNOWN_ELEMENT, ERR_OK, ERR_OK };
+            const eNMEA0183_SentencesID EXPECTED_SENTENCES[4] = { NMEA0183_RMC, NMEA0183_UNKNOWN, NMEA0183_GGA, NMEA0183_RMC };
+
+            //--- Test (Stream written in chunks in the ring) ---
+            LastError = Init_NMEA0183RingFramer(&Framer, &Ring[0], sizeof(Ring));
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Ring framer init), error should be ERR_OK");
+            size_t WritePos = 0, FrameCount = 0, WrappedCount = 0;
+            for (size_t zPass = 0; zPass < 5; ++zPass)
+            {
+                size_t z = 0;
+                while (z < TEST_STREAM_SIZE)
+                {
+                    for (size_t zChunk = 0; (zChunk < 7) && (z < TEST_STREAM_SIZE); ++zChunk) // Write like a DMA, without writing over the chars still needed
+                    {
+                        const size_t NextPos = (WritePos + 1) % sizeof(Ring);
+                        Assert::AreNotEqual((uint32_t)NMEA0183_RingFramer_GetReadPos(&Framer), (uint32_t)NextPos, L"Test (Ring framer), the ring should not be full");
+                        Ring[WritePos] = TEST_STREAM[z++];
+                        WritePos = NextPos;
+                    }
+                    while ((LastError = NMEA0183_RingFramer_GetFrame(&Framer, WritePos, &Span)) == ERR_OK)
+                    {
+                        Assert::IsTrue((Span.pFirst >= &Ring[0]) && (Span.pFirst < &Ring[sizeof(Ring)]), L"Test (Ring framer), the frame should be in the ring");
+                        if (Span.SecondSize > 0) ++WrappedCount;
+                        Assert::AreEqual(ERR__BUSY, NMEA0183_RingFramer_GetFrame(&Framer, WritePos, &Span), L"Test (Ring framer), error should be ERR__BUSY before the release");
+                        LastError = NMEA0183_RingFramer_ProcessFrame(&Framer, &Span, &FrameData);
+                        Assert::AreEqual(EXPECTED_ERRORS[FrameCount % 4], LastError, L"Test (Ring framer), error should be the expected one");
+                        if (LastError == ERR_OK) Assert::AreEqual(EXPECTED_SENTENCES[FrameCount % 4], FrameData.SentenceID, L"Test (Ring framer), SentenceID should be the expected one");
+                        if (FrameData.SentenceID == NMEA0183_RMC) Assert::AreEqual(547000u, FrameData.RMC.Track, L"Test (Ring framer), RMC.Track should be 547000");
+                        LastError = NMEA0183_RingFramer_ReleaseFrame(&Framer);
+                        Assert::AreEqual(ERR_OK, LastError, L"Test (Ring framer), error should be ERR_OK");
+                        ++FrameCount;
+                    }
+                    Assert::AreEqual(ERR__NO_DATA_AVAILABLE, LastError, L"Test (Ring framer), error should be ERR__NO_DATA_AVAILABLE");
+                }
+            }
+            Assert::AreEqual(20u, (uint32_t)FrameCount, L"Test (Ring framer), FrameCount should be 20");
+            Assert::IsTrue(WrappedCount > 0, L"Test (Ring framer), some frames should wrap around the end of the ring");
+            Assert::AreEqual((uint32_t)WritePos, (uint32_t)NMEA0183_RingFramer_GetReadPos(&Framer), L"Test (Ring framer), all the chars should be released");
+            (void)NMEA0183_RingFramer_GetResyncCount(&Framer, &ResyncCount);
+            Assert::AreEqual(10u, ResyncCount, L"Test (Ring framer), ResyncCount should be 10");
+
+            //--- Test (Frame too long) ---
+            (void)Init_NMEA0183RingFramer(&Framer, &Ring[0], sizeof(Ring));
+            Ring[0] = '$';
+            memset(&Ring[1], 'A', NMEA0183_FRAME_BUFFER_SIZE + 5);
+            LastError = NMEA0183_RingFramer_GetFrame(&Framer, NMEA0183_FRAME_BUFFER_SIZE + 6, &Span);
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (Frame too long), error should be ERR__BUFFER_FULL");
+            LastError = NMEA0183_RingFramer_GetFrame(&Framer, NMEA0183_FRAME_BUFFER_SIZE + 6, &Span);
+            Assert::AreEqual(ERR__NO_DATA_AVAILABLE, LastError, L"Test (Frame too long), error should be ERR__NO_DATA_AVAILABLE");
+            Assert::AreEqual((uint32_t)(NMEA0183_FRAME_BUFFER_SIZE + 6), (uint32_t)NMEA0183_RingFramer_GetReadPos(&Framer), L"Test (Frame too long), all the chars should be released");
+
+            //--- Test (Frame too long cut by a start delimiter, counted as a resynchronization like the receive path) ---
+            char TEST_LONG_STREAM[7 + NMEA0183_FRAME_BUFFER_SIZE + 40 + 39 + 1];
+            memcpy(&TEST_LONG_STREAM[0], "$GPXXX,", 7);
+            memset(&TEST_LONG_STREAM[7], 'A', NMEA0183_FRAME_BUFFER_SIZE + 40);
+            strcpy(&TEST_LONG_STREAM[7 + NMEA0183_FRAME_BUFFER_SIZE + 40], "$GPZDA,160012.71,11,03,2004,-1,00*7D\r\n");
+            (void)Init_NMEA0183RingFramer(&Framer, &Ring[0], sizeof(Ring));
+            WritePos = 0, FrameCount = 0;
+            size_t DroppedCount = 0;
+            for (size_t z = 0; z < strlen(TEST_LONG_STREAM); ++z)
+            {
+                Ring[WritePos] = TEST_LONG_STREAM[z];
+                WritePos = (WritePos + 1) % sizeof(Ring);
+                while ((LastError = NMEA0183_RingFramer_GetFrame(&Framer, WritePos, &Span)) != ERR__NO_DATA_AVAILABLE)
+                {
+                    if (LastError == ERR__BUFFER_FULL) { ++DroppedCount; continue; }
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Frame too long cut), error should be ERR_OK");
+                    LastError = NMEA0183_RingFramer_ProcessFrame(&Framer, &Span, &FrameData);
+                    Assert::AreEqual(ERR_OK, LastError, L"Test (Frame too long cut), error should be ERR_OK");
+                    Assert::AreEqual(NMEA0183_ZDA, FrameData.SentenceID, L"Test (Frame too long cut), SentenceID should be NMEA0183_ZDA");
+                    (void)NMEA0183_RingFramer_ReleaseFrame(&Framer);
+                    ++FrameCount;
+                }
+            }
+            Assert::AreEqual(1u, (uint32_t)DroppedCount, L"Test (Frame too long cut), DroppedCount should be 1");
+            Assert::AreEqual(1u, (uint32_t)FrameCount, L"Test (Frame too long cut), FrameCount should be 1");
+            (void)NMEA0183_RingFramer_GetResyncCount(&Framer, &ResyncCount);
+            Assert::AreEqual(1u, ResyncCount, L"Test (Frame too long cut), ResyncCount should be 1");
+        }
+    };
+#endif
+
 
 #ifdef NMEA0183_FLOAT_BASED_TOOLS
+#ifdef NMEA0183_USER_SENTENCE_DECODERS_COUNT
+    //-----------------------------------------------------------------------------
+    struct SentenceDecoderContext
+    {
+        size_t Count;
+        char FirstField;
+    };
+
+    static eERRORRESULT SentenceDecoderCallback(const char* pFields, NMEA0183_DecodedData* pData, void* pContext)
+    {
+        SentenceDecoderContext* pCtx = (SentenceDecoderContext*)pContext;
+        ++pCtx->Count;
+        pCtx->FirstField = pFields[0];
+        pData->Frame[0] = pFields[0];
+        return ERR_OK;
+    }
+#endif
+
+
+    TEST_CLASS(SentenceDispatchTest)
+    {
+    public:
+
+        TEST_METHOD(TestMethod_SentenceHash)
+        {
+            const uint32_t SENTENCES[] =
+            {
+                NMEA0183_AAM, NMEA0183_ALM, NMEA0183_APB, NMEA0183_BEC, NMEA0183_BOD, NMEA0183_BWW, NMEA0183_DBK, NMEA0183_DBS, NMEA0183_DBT,
+                NMEA0183_DPT, NMEA0183_FSI, NMEA0183_GGA, NMEA0183_GLL, NMEA0183_GSA, NMEA0183_GSV, NMEA0183_HDG, NMEA0183_HDM, NMEA0183_HDT,
+                NMEA0183_MTW, NMEA0183_MWV, NMEA0183_RMC, NMEA0183_TXT, NMEA0183_VHW, NMEA0183_VTG, NMEA0183_ZDA,
+            };
+            const size_t SENTENCES_COUNT = sizeof(SENTENCES) / sizeof(SENTENCES[0]);
+
+            //--- Test (Each known sentence has its own slot) ---
+            uint32_t UsedSlots = 0;
+            for (size_t z = 0; z < SENTENCES_COUNT; ++z)
+            {
+                const uint32_t Slot = NMEA0183_SENTENCE_HASH(SENTENCES[z]);
+                Assert::IsTrue(Slot < NMEA0183_SENTENCE_HASH_SLOTS, L"Test (Sentence hash), slot should be in the dispatch table");
+                Assert::AreNotEqual((uint32_t)NMEA0183_SENTENCE_HASH_OTHERS, Slot, L"Test (Sentence hash), slot should not be the others slot");
+                Assert::AreEqual(0u, UsedSlots & (1u << Slot), L"Test (Sentence hash), slot should not be shared");
+                UsedSlots |= (1u << Slot);
+            }
+        }
+
+#ifdef NMEA0183_USER_SENTENCE_DECODERS_COUNT
+        TEST_METHOD(TestMethod_RegisterSentenceDecoder)
+        {
+            NMEA0183_DecodedData FrameData;
+            eERRORRESULT LastError = ERR_OK;
+            SentenceDecoderContext Context1 = { 0, '\0' }, Context2 = { 0, '\0' };
+
+            //--- Test (Bad address) ---
+            LastError = NMEA0183_RegisterSentenceDecoder("XD", SentenceDecoderCallback, &Context1);
+            Assert::AreEqual(ERR__PARAMETER_ERROR, LastError, L"Test (Address too short), error should be ERR__PARAMETER_ERROR");
+            LastError = NMEA0183_RegisterSentenceDecoder("PTOOLONGID", SentenceDecoderCallback, &Context1);
+            Assert::AreEqual(ERR__PARAMETER_ERROR, LastError, L"Test (Address too long), error should be ERR__PARAMETER_ERROR");
+
+            //--- Test (Sentence ID of any talker) ---
+            LastError = NMEA0183_RegisterSentenceDecoder("XDR", SentenceDecoderCallback, &Context1);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Register XDR), error should be ERR_OK");
+            LastError = NMEA0183_ProcessLine("$IIXDR,C,19.5,C,AIRTEMP*0B\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Decode XDR), error should be ERR_OK");
+            Assert::AreEqual(true, FrameData.ParseIsValid, L"Test (Decode XDR), ParseIsValid should be true");
+            Assert::AreEqual((uint32_t)NMEA0183_SENTENCE_ID('X', 'D', 'R'), (uint32_t)FrameData.SentenceID, L"Test (Decode XDR), SentenceID should be 'XDR'");
+            Assert::AreEqual((uint16_t)NMEA0183_TALKER_ID('I', 'I'), (uint16_t)FrameData.TalkerID, L"Test (Decode XDR), TalkerID should be 'II'");
+            Assert::AreEqual((size_t)1, Context1.Count, L"Test (Decode XDR), decoder should be called once");
+            Assert::AreEqual('C', Context1.FirstField, L"Test (Decode XDR), first field should be 'C'");
+
+            //--- Test (Whole proprietary addresses) ---
+            LastError = NMEA0183_RegisterSentenceDecoder("PGRME", SentenceDecoderCallback, &Context2);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Register PGRME), error should be ERR_OK");
+            LastError = NMEA0183_RegisterSentenceDecoder("PUBX", SentenceDecoderCallback, &Context2);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Register PUBX), error should be ERR_OK");
+            LastError = NMEA0183_ProcessLine("$PGRME,15.0,M,45.0,M,25.0,M*1C\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Decode PGRME), error should be ERR_OK");
+            Assert::AreEqual('1', Context2.FirstField, L"Test (Decode PGRME), first field should be '1'");
+            LastError = NMEA0183_ProcessLine("$PUBX,00,081350.00*3E\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Decode PUBX), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_UNKNOWN, FrameData.SentenceID, L"Test (Decode PUBX), SentenceID should be NMEA0183_UNKNOWN");
+            Assert::AreEqual('0', FrameData.Frame[0], L"Test (Decode PUBX), FrameData should be filled by the decoder");
+            Assert::AreEqual((size_t)2, Context2.Count, L"Test (Decode PGRME and PUBX), decoder should be called twice");
+
+            //--- Test (Known sentences have priority) ---
+            LastError = NMEA0183_RegisterSentenceDecoder("GGA", SentenceDecoderCallback, &Context1);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Register GGA), error should be ERR_OK");
+            LastError = NMEA0183_ProcessLine("$GPGGA,002153.000,3342.6618,N,01115.73858,W,1,10,1.2,27.0,M,-34.2,M,,0000*6E\r\n", &FrameData);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Decode GGA), error should be ERR_OK");
+            Assert::AreEqual(NMEA0183_GGA, FrameData.SentenceID, L"Test (Decode GGA), SentenceID should be NMEA0183_GGA");
+            Assert::AreEqual((size_t)1, Context1.Count, L"Test (Decode GGA), registered decoder should not be called");
+
+            //--- Test (Registry full) ---
+            LastError = NMEA0183_RegisterSentenceDecoder("PSRF", SentenceDecoderCallback, &Context1);
+            Assert::AreEqual(ERR__BUFFER_FULL, LastError, L"Test (Registry full), error should be ERR__BUFFER_FULL");
+
+            //--- Test (Replace and unregister) ---
+            LastError = NMEA0183_RegisterSentenceDecoder("XDR", SentenceDecoderCallback, &Context2);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Replace XDR), error should be ERR_OK");
+            LastError = NMEA0183_ProcessLine("$IIXDR,C,19.5,C,AIRTEMP*0B\r\n", &FrameData);
+            Assert::AreEqual((size_t)3, Context2.Count, L"Test (Replace XDR), new context should be used");
+            LastError = NMEA0183_RegisterSentenceDecoder("XDR", NULL, NULL);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Unregister XDR), error should be ERR_OK");
+            LastError = NMEA0183_ProcessLine("$IIXDR,C,19.5,C,AIRTEMP*0B\r\n", &FrameData);
+            Assert::AreEqual(ERR__UNKNOWN_ELEMENT, LastError, L"Test (Unregistered XDR), error should be ERR__UNKNOWN_ELEMENT");
+            Assert::AreEqual(NMEA0183_UNKNOWN, FrameData.SentenceID, L"Test (Unregistered XDR), SentenceID should be NMEA0183_UNKNOWN");
+            LastError = NMEA0183_RegisterSentenceDecoder("PSRF", SentenceDecoderCallback, &Context1);
+            Assert::AreEqual(ERR_OK, LastError, L"Test (Register in the freed slot), error should be ERR_OK");
+
+            //--- Clean up ---
+            NMEA0183_RegisterSentenceDecoder("PGRME", NULL, NULL);
+            NMEA0183_RegisterSentenceDecoder("PUBX", NULL, NULL);
+            NMEA0183_RegisterSentenceDecoder("GGA", NULL, NULL);
+            NMEA0183_RegisterSentenceDecoder("PSRF", NULL, NULL);
+        }
+#endif
+    };
+
+
     TEST_CLASS(ToolsClassTest)
     {
 
@@ -51,7 +51,11 @@ namespace NMEA0183test
             Assert::AreEqual('V', FrameData.AAM.ArrivalStatus, L"Test (Low Data), ArrivalStatus should be 'V'");
             Assert::AreEqual('V', FrameData.AAM.PassedWaypoint, L"Test (Low Data), PassedWaypoint should be 'V'");
             Assert::AreEqual(2000u, FrameData.AAM.CircleRadius, L"Test (Low Data), CircleRadius should be 2000");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("", FrameData.AAM.WaypointID.pChars, FrameData.AAM.WaypointID.Size), L"Test (Full Data), WaypointID should be '\0'");
+#else
             Assert::AreEqual(0, strncmp("", &FrameData.AAM.WaypointID[0], strlen(FrameData.AAM.WaypointID)), L"Test (Full Data), WaypointID should be '\0'");
+#endif
 
             //=== Test (Full Data) ===========================================
             const char* const TEST_AAM_FULL_DATA_FRAME = "$GPAAM,A,A,0.10,N,WPTNME*32\r\n";
@@ -69,7 +73,11 @@ namespace NMEA0183test
             Assert::AreEqual('A', FrameData.AAM.ArrivalStatus, L"Test (Full Data), ArrivalStatus should be 'A'");
             Assert::AreEqual('A', FrameData.AAM.PassedWaypoint, L"Test (Full Data), PassedWaypoint should be 'A'");
             Assert::AreEqual(1000u, FrameData.AAM.CircleRadius, L"Test (Full Data), CircleRadius should be 1000");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("WPTNME", FrameData.AAM.WaypointID.pChars, FrameData.AAM.WaypointID.Size), L"Test (Full Data), WaypointID should be 'WPTNME'");
+#else
             Assert::AreEqual(0, strncmp("WPTNME", &FrameData.AAM.WaypointID[0], strlen(FrameData.AAM.WaypointID)), L"Test (Full Data), WaypointID should be 'WPTNME'");
+#endif
         }
 #endif
 
@@ -138,8 +146,16 @@ namespace NMEA0183test
             Assert::AreEqual(NMEA0183_BOD, FrameData.SentenceID, L"Test (GOTO mode Data), SentenceID should be NMEA0183_BOD");
             Assert::AreEqual((uint16_t)9930u, FrameData.BOD.BearingTrue, L"Test (GOTO mode Data), BearingTrue should be 9930");
             Assert::AreEqual((uint16_t)10560u, FrameData.BOD.BearingMagnetic, L"Test (GOTO mode Data), BearingMagnetic should be 10560");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("POINTB", FrameData.BOD.DestWaypointID.pChars, FrameData.BOD.DestWaypointID.Size), L"Test (GOTO mode Data), DestWaypointID should be 'POINTB'");
+#else
             Assert::AreEqual(0, strncmp("POINTB", &FrameData.BOD.DestWaypointID[0], strlen(FrameData.BOD.DestWaypointID)), L"Test (GOTO mode Data), DestWaypointID should be 'POINTB'");
+#endif
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("", FrameData.BOD.OriginWaypointID.pChars, FrameData.BOD.OriginWaypointID.Size), L"Test (GOTO mode Data), OriginWaypointID should be ''");
+#else
             Assert::AreEqual(0, strncmp("", &FrameData.BOD.OriginWaypointID[0], strlen(FrameData.BOD.OriginWaypointID)), L"Test (GOTO mode Data), OriginWaypointID should be ''");
+#endif
 
             //=== Test (Route active Data) ============================================
             const char* const TEST_BOD_ROUTE_MODE_DATA_FRAME = "$GPBOD,097.0,T,103.2,M,POINTB,POINTA*4A\r\n";
@@ -156,8 +172,16 @@ namespace NMEA0183test
             Assert::AreEqual(NMEA0183_BOD, FrameData.SentenceID, L"Test (Route active Data), SentenceID should be NMEA0183_BOD");
             Assert::AreEqual((uint16_t)9700u, FrameData.BOD.BearingTrue, L"Test (Route active Data), BearingTrue should be 9700");
             Assert::AreEqual((uint16_t)10320u, FrameData.BOD.BearingMagnetic, L"Test (Route active Data), BearingMagnetic should be 10320");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("POINTB", FrameData.BOD.DestWaypointID.pChars, FrameData.BOD.DestWaypointID.Size), L"Test (Route active Data), DestWaypointID should be 'POINTB'");
+#else
             Assert::AreEqual(0, strncmp("POINTB", &FrameData.BOD.DestWaypointID[0], strlen(FrameData.BOD.DestWaypointID)), L"Test (Route active Data), DestWaypointID should be 'POINTB'");
+#endif
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("POINTA", FrameData.BOD.OriginWaypointID.pChars, FrameData.BOD.OriginWaypointID.Size), L"Test (Route active Data), OriginWaypointID should be 'POINTA'");
+#else
             Assert::AreEqual(0, strncmp("POINTA", &FrameData.BOD.OriginWaypointID[0], strlen(FrameData.BOD.OriginWaypointID)), L"Test (Route active Data), OriginWaypointID should be 'POINTA'");
+#endif
         }
 #endif
 
@@ -184,8 +208,16 @@ namespace NMEA0183test
             Assert::AreEqual(NMEA0183_BWW, FrameData.SentenceID, L"Test (Full Data), SentenceID should be NMEA0183_BWW");
             Assert::AreEqual((uint16_t)16430u, FrameData.BWW.BearingTrue, L"Test (Full Data), BearingTrue should be 16430");
             Assert::AreEqual((uint16_t)16450u, FrameData.BWW.BearingMagnetic, L"Test (Full Data), BearingMagnetic should be 16450");
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("POINTB", FrameData.BWW.FromWaypointID.pChars, FrameData.BWW.FromWaypointID.Size), L"Test (Full Data), FromWaypointID should be 'POINTB'");
+#else
             Assert::AreEqual(0, strncmp("POINTB", &FrameData.BWW.FromWaypointID[0], strlen(FrameData.BWW.FromWaypointID)), L"Test (Full Data), FromWaypointID should be 'POINTB'");
+#endif
+#ifdef NMEA0183_STRING_VIEWS
+            Assert::AreEqual(0, strncmp("POINTA", FrameData.BWW.ToWaypointID.pChars, FrameData.BWW.ToWaypointID.Size), L"Test (Full Data), ToWaypointID should be 'POINTA'");
+#else
             Assert::AreEqual(0, strncmp("POINTA", &FrameData.BWW.ToWaypointID[0], strlen(FrameData.BWW.ToWaypointID)), L"Test (Full Data), ToWaypointID should be 'POINTA'");
+#endif
         }
 #endif
 
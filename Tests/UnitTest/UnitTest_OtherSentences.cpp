@@ -49,7 +49,13 @@ namespace NMEA0183test
             Assert::AreEqual((uint8_t)1u, FrameData.TXT.TotalSentence, L"Test (Full Data), TotalSentence should be 1");
             Assert::AreEqual((uint8_t)1u, FrameData.TXT.SentenceNumber, L"Test (Full Data), SentenceNumber should be 1");
             Assert::AreEqual((uint8_t)25u, FrameData.TXT.TextIdentifier, L"Test (Full Data), TextIdentifier should be 25");
+#ifdef NMEA0183_STRING_VIEWS
+            char TextMessage[NMEA0183_TXT_MESSAGE_MAX_SIZE+1];
+            Assert::AreEqual(ERR_OK, NMEA0183_StringViewToString(&FrameData.TXT.TextMessage, &TextMessage[0], sizeof(TextMessage)), L"Test (Full Data), TextMessage should be decoded");
+            Assert::AreEqual(0, strcmp("DR MODE - ANTENNA FAULT!", &TextMessage[0]), L"Test (Full Data), TextMessage should be 'DR MODE - ANTENNA FAULT!'");
+#else
             Assert::AreEqual(0, strncmp("DR MODE - ANTENNA FAULT!", &FrameData.TXT.TextMessage[0], strlen(FrameData.TXT.TextMessage)), L"Test (Full Data), TextMessage should be 'DR MODE - ANTENNA FAULT!'");
+#endif
         }
 #endif
 